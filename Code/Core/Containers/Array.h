@@ -49,10 +49,15 @@ public:
 	void Swap( Array< T > & other );
 
 	// sorting
-	void Sort() { ShellSort( m_Begin, m_End, AscendingCompare() ); }
-	void SortDeref() { ShellSort( m_Begin, m_End, AscendingCompareDeref() ); }
+	void Sort() { IntroSort( m_Begin, m_End, AscendingCompare() ); }
+	void SortDeref() { IntroSort( m_Begin, m_End, AscendingCompareDeref() ); }
 	template < class COMPARER >
-	void Sort( const COMPARER & comp ) { ShellSort( m_Begin, m_End, comp ); }
+	void Sort( const COMPARER & comp ) { IntroSort( m_Begin, m_End, comp ); }
+
+	// append already sorted items, keeping a sorted array sorted
+	void MergeSorted( const Array< T > & sortedItems ) { MergeSorted( sortedItems, AscendingCompare() ); }
+	template < class COMPARER >
+	void MergeSorted( const Array< T > & sortedItems, const COMPARER & comp );
 
 	// find
 	template < class U >
@@ -365,6 +370,21 @@ void Array< T >::Append( const U * begin, const U * end )
 	}	
 }
 
+// MergeSorted
+//------------------------------------------------------------------------------
+template < class T >
+template < class COMPARER >
+void Array< T >::MergeSorted( const Array< T > & sortedItems, const COMPARER & comp )
+{
+	ASSERT( &sortedItems != this );
+
+	// extend (values are overwritten by the merge)
+	const size_t oldSize = GetSize();
+	Append( sortedItems );
+
+	::MergeSorted( m_Begin, oldSize, sortedItems.Begin(), sortedItems.GetSize(), comp );
+}
+
 // Pop
 //------------------------------------------------------------------------------
 template < class T >
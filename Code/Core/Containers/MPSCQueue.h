@@ -0,0 +1,87 @@
+// MPSCQueue.h
+//------------------------------------------------------------------------------
+#pragma once
+#ifndef CORE_CONTAINERS_MPSCQUEUE_H
+#define CORE_CONTAINERS_MPSCQUEUE_H
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/Env/Assert.h"
+#include "Core/Process/Atomic.h"
+
+// MPSCQueue
+//------------------------------------------------------------------------------
+// Lock-free, intrusive queue for many producer threads and a single consumer.
+// Items are linked through a pointer member (NEXT) of T, so no allocations
+// are made, and an item can only be in one queue at a time.
+//
+// Producers push onto a shared list head with a CAS. The consumer detaches
+// the entire list at once, so there is no ABA problem.
+template < class T, T * T::* NEXT >
+class MPSCQueue
+{
+public:
+	inline MPSCQueue() : m_Head( nullptr ) {}
+	inline ~MPSCQueue() { ASSERT( m_Head == nullptr ); }
+
+	// Producers: returns true if the queue was empty
+	inline bool	Push( T * item );
+
+	// Consumer: remove all items, returning them linked in the order they were pushed
+	inline T *	PopAll();
+
+	// a snapshot which may be immediately out of date if producers are active
+	inline bool IsEmpty() const { return ( m_Head == nullptr ); }
+
+private:
+	MPSCQueue & operator = ( const MPSCQueue & ) = delete;
+
+	void * volatile m_Head; // most recently pushed item
+};
+
+// Push
+//------------------------------------------------------------------------------
+template < class T, T * T::* NEXT >
+bool MPSCQueue< T, NEXT >::Push( T * item )
+{
+	ASSERT( item );
+	void * head = m_Head;
+	for ( ;; )
+	{
+		item->*NEXT = static_cast< T * >( head );
+		void * prevHead = AtomicCompareExchangePtr( &m_Head, item, head );
+		if ( prevHead == head )
+		{
+			return ( head == nullptr );
+		}
+		head = prevHead; // lost race with another producer - try again
+	}
+}
+
+// PopAll
+//------------------------------------------------------------------------------
+template < class T, T * T::* NEXT >
+T * MPSCQueue< T, NEXT >::PopAll()
+{
+	if ( m_Head == nullptr )
+	{
+		return nullptr; // avoid atomic op when empty
+	}
+
+	// detach list (most recent first)
+	T * item = static_cast< T * >( AtomicExchangePtr( &m_Head, nullptr ) );
+
+	// reverse into push order
+	T * first = nullptr;
+	while ( item )
+	{
+		T * next = item->*NEXT;
+		item->*NEXT = first;
+		first = item;
+		item = next;
+	}
+	return first;
+}
+
+//------------------------------------------------------------------------------
+#endif // CORE_CONTAINERS_MPSCQUEUE_H
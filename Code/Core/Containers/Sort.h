@@ -32,39 +32,190 @@ public:
 	}
 };
 
-// ShellSort
+// InsertionSort
 //------------------------------------------------------------------------------
 template < class T, class COMPARE >
-void ShellSort( T * begin, T * end, const COMPARE & compare )
+void InsertionSort( T * begin, T * end, const COMPARE & compare )
 {
-	size_t numItems = end - begin;
-	size_t increment = 3;
-	while ( increment > 0 )
+	for ( T * i = begin + 1; i < end; ++i )
 	{
-		for ( size_t i=0; i < numItems; i++ )
+		if ( compare( *i, *( i - 1 ) ) == false )
 		{
-			size_t j = i;
-			T temp( begin[ i ] );
-			while ( ( j >= increment ) && ( compare( temp, begin[ j - increment ]  ) ) )
+			continue; // already in place
+		}
+		T temp( *i );
+		T * j = i;
+		do
+		{
+			*j = *( j - 1 );
+			--j;
+		}
+		while ( ( j > begin ) && compare( temp, *( j - 1 ) ) );
+		*j = temp;
+	}
+}
+
+// SortSwap
+//------------------------------------------------------------------------------
+template < class T >
+inline void SortSwap( T & a, T & b )
+{
+	T temp( a );
+	a = b;
+	b = temp;
+}
+
+// HeapSiftDown
+//------------------------------------------------------------------------------
+template < class T, class COMPARE >
+void HeapSiftDown( T * begin, size_t root, size_t numItems, const COMPARE & compare )
+{
+	T temp( begin[ root ] );
+	for ( ;; )
+	{
+		size_t child = ( root * 2 ) + 1;
+		if ( child >= numItems )
+		{
+			break;
+		}
+		if ( ( child + 1 < numItems ) && compare( begin[ child ], begin[ child + 1 ] ) )
+		{
+			++child; // larger child
+		}
+		if ( compare( temp, begin[ child ] ) == false )
+		{
+			break;
+		}
+		begin[ root ] = begin[ child ];
+		root = child;
+	}
+	begin[ root ] = temp;
+}
+
+// HeapSort
+//------------------------------------------------------------------------------
+template < class T, class COMPARE >
+void HeapSort( T * begin, T * end, const COMPARE & compare )
+{
+	const size_t numItems = (size_t)( end - begin );
+	if ( numItems < 2 )
+	{
+		return;
+	}
+	for ( size_t i = ( numItems / 2 ); i > 0; --i )
+	{
+		HeapSiftDown( begin, i - 1, numItems, compare );
+	}
+	for ( size_t i = numItems - 1; i > 0; --i )
+	{
+		SortSwap( begin[ 0 ], begin[ i ] );
+		HeapSiftDown( begin, 0, i, compare );
+	}
+}
+
+// IntroSortRecurse
+//------------------------------------------------------------------------------
+template < class T, class COMPARE >
+void IntroSortRecurse( T * begin, T * end, uint32_t depthLimit, const COMPARE & compare )
+{
+	// small partitions are left for a final insertion sort pass
+	while ( ( end - begin ) > 16 )
+	{
+		// degenerate partitioning - fall back to a guaranteed O(n log n) sort
+		if ( depthLimit == 0 )
+		{
+			HeapSort( begin, end, compare );
+			return;
+		}
+		--depthLimit;
+
+		// median of three pivot, moved to the front
+		T * mid = begin + ( ( end - begin ) / 2 );
+		T * last = end - 1;
+		if ( compare( *mid, *begin ) ) { SortSwap( *mid, *begin ); }
+		if ( compare( *last, *mid ) )
+		{
+			SortSwap( *last, *mid );
+			if ( compare( *mid, *begin ) ) { SortSwap( *mid, *begin ); }
+		}
+		SortSwap( *begin, *mid );
+		const T pivot( *begin );
+
+		// Hoare partition (begin[ 0 ] <= pivot and end[ -1 ] >= pivot act as sentinels)
+		T * left = begin;
+		T * right = end;
+		for ( ;; )
+		{
+			do { ++left; } while ( compare( *left, pivot ) );
+			do { --right; } while ( compare( pivot, *right ) );
+			if ( left >= right )
 			{
-				begin[ j ] = begin[ j - increment ];
-				j = j - increment;
+				break;
 			}
-			begin[ j ] = temp;
+			SortSwap( *left, *right );
 		}
-		if ( increment / 2 != 0 )
+		SortSwap( *begin, *right );
+
+		// recurse into the smaller side, iterate on the larger to bound stack use
+		if ( ( right - begin ) < ( end - ( right + 1 ) ) )
 		{
-			increment = increment / 2 ;
+			IntroSortRecurse( begin, right, depthLimit, compare );
+			begin = right + 1;
 		}
-		else if ( increment == 1 )
+		else
 		{
-			increment = 0;
+			IntroSortRecurse( right + 1, end, depthLimit, compare );
+			end = right;
+		}
+	}
+}
+
+// IntroSort
+//  - Quicksort, falling back to HeapSort if partitioning degenerates and
+//    finishing with an InsertionSort. Not stable.
+//------------------------------------------------------------------------------
+template < class T, class COMPARE >
+void IntroSort( T * begin, T * end, const COMPARE & compare )
+{
+	const size_t numItems = (size_t)( end - begin );
+	if ( numItems < 2 )
+	{
+		return;
+	}
+
+	// limit depth to 2 * log2( n )
+	uint32_t depthLimit = 0;
+	for ( size_t n = numItems; n > 1; n >>= 1 )
+	{
+		depthLimit += 2;
+	}
+
+	IntroSortRecurse( begin, end, depthLimit, compare );
+	InsertionSort( begin, end, compare );
+}
+
+// MergeSorted
+//  - Merge a sorted range into a sorted range which has been extended to fit
+//    it. Merging from the back means no extra storage is needed. Items from
+//    the destination come before equal items being merged in.
+//------------------------------------------------------------------------------
+template < class T, class U, class COMPARE >
+void MergeSorted( T * dstBegin, size_t dstSize, const U * srcBegin, size_t srcSize, const COMPARE & compare )
+{
+	T * dst = dstBegin + dstSize;				// one past last existing item
+	const U * src = srcBegin + srcSize;			// one past last item to merge
+	T * out = dstBegin + dstSize + srcSize;		// one past last output slot
+	while ( src > srcBegin )
+	{
+		if ( ( dst > dstBegin ) && compare( *( src - 1 ), *( dst - 1 ) ) )
+		{
+			*( --out ) = *( --dst );
 		}
 		else
 		{
-			increment = 1;
+			*( --out ) = *( --src );
 		}
-	}    
+	}
 }
 
 //------------------------------------------------------------------------------
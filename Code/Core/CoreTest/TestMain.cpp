@@ -20,11 +20,13 @@ int main(int , char * [])
 	REGISTER_TESTGROUP( TestHash )
 	REGISTER_TESTGROUP( TestLevenshteinDistance )
 	REGISTER_TESTGROUP( TestMemPoolBlock )
+	REGISTER_TESTGROUP( TestMPSCQueue )
 	REGISTER_TESTGROUP( TestMutex )
 	REGISTER_TESTGROUP( TestPathUtils )
 	REGISTER_TESTGROUP( TestReflection )
 	REGISTER_TESTGROUP( TestSemaphore )
 	REGISTER_TESTGROUP( TestSharedMemory )
+	REGISTER_TESTGROUP( TestSort )
 	REGISTER_TESTGROUP( TestSystemMutex )
 	REGISTER_TESTGROUP( TestTestTCPConnectionPool )
 	REGISTER_TESTGROUP( TestTimer )
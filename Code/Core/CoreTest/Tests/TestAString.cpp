@@ -6,8 +6,11 @@
 #include "TestFramework/UnitTest.h"
 
 #include "Core/Containers/AutoPtr.h"
+#include "Core/Math/CRC32.h"
 #include "Core/Strings/AString.h"
 #include "Core/Strings/AStackString.h"
+#include "Core/Time/Timer.h"
+#include "Core/Tracing/Tracing.h"
 
 #include <memory.h>
 
@@ -30,6 +33,11 @@ private:
 	void PatternMatch() const;
 	void PatternMatchI() const;
 	void Trim() const;
+	void ShortString() const;
+	void HashLower() const;
+	void StringSpeed() const;
+	void CaseInsensitive() const;
+	void PathSpeed() const;
 };
 
 // Register Tests
@@ -47,6 +55,11 @@ REGISTER_TESTS_BEGIN( TestAString )
 	REGISTER_TEST( PatternMatch )
 	REGISTER_TEST( PatternMatchI )
 	REGISTER_TEST( Trim )
+	REGISTER_TEST( ShortString )
+	REGISTER_TEST( HashLower )
+	REGISTER_TEST( StringSpeed )
+	REGISTER_TEST( CaseInsensitive )
+	REGISTER_TEST( PathSpeed )
 REGISTER_TESTS_END
 
 // AStringConstructors
@@ -65,7 +78,15 @@ void TestAString::AStringConstructors() const
 		// AString with reserve capacity argument
 		AString empty( 16 );
 		TEST_ASSERT( empty.GetLength() == 0 );
-		TEST_ASSERT( empty.GetReserved() == 16 );
+		TEST_ASSERT( empty.GetReserved() >= 16 );
+		TEST_ASSERT( empty.IsEmpty() == true );
+		TEST_ASSERT( empty.MemoryMustBeFreed() == false ); // fits in internal buffer
+	}
+	{
+		// AString with reserve capacity argument (larger than internal buffer)
+		AString empty( 64 );
+		TEST_ASSERT( empty.GetLength() == 0 );
+		TEST_ASSERT( empty.GetReserved() == 64 );
 		TEST_ASSERT( empty.IsEmpty() == true );
 		TEST_ASSERT( empty.MemoryMustBeFreed() == true );
 	}
@@ -75,14 +96,14 @@ void TestAString::AStringConstructors() const
 		TEST_ASSERT( fromCharStar.GetLength() == 5 );
 		TEST_ASSERT( fromCharStar.GetReserved() >= 5 );
 		TEST_ASSERT( fromCharStar.IsEmpty() == false );
-		TEST_ASSERT( fromCharStar.MemoryMustBeFreed() == true );
+		TEST_ASSERT( fromCharStar.MemoryMustBeFreed() == false );
 
 		// AString from AString
 		AString fromAString( fromCharStar );
 		TEST_ASSERT( fromAString.GetLength() == 5 );
 		TEST_ASSERT( fromAString.GetReserved() >= 5 );
 		TEST_ASSERT( fromAString.IsEmpty() == false );
-		TEST_ASSERT( fromAString.MemoryMustBeFreed() == true );
+		TEST_ASSERT( fromAString.MemoryMustBeFreed() == false );
 	}
 	{
 		const char * hello = "hellohellohello";
@@ -90,7 +111,7 @@ void TestAString::AStringConstructors() const
 		TEST_ASSERT( fromCharStarPair.GetLength() == 5 );
 		TEST_ASSERT( fromCharStarPair.GetReserved() >= 5 );
 		TEST_ASSERT( fromCharStarPair.IsEmpty() == false );
-		TEST_ASSERT( fromCharStarPair.MemoryMustBeFreed() == true );
+		TEST_ASSERT( fromCharStarPair.MemoryMustBeFreed() == false );
 	}
 }
 
@@ -103,14 +124,14 @@ void TestAString::AStringAssignment() const
 	TEST_ASSERT( str.GetLength() == 4 );
 	TEST_ASSERT( str.GetReserved() >= 4 );
 	TEST_ASSERT( str.IsEmpty() == false );
-	TEST_ASSERT( str.MemoryMustBeFreed() == true );
+	TEST_ASSERT( str.MemoryMustBeFreed() == false );
 
 	AString str2;
 	str2 = str;
 	TEST_ASSERT( str2.GetLength() == 4 );
 	TEST_ASSERT( str2.GetReserved() >= 4 );
 	TEST_ASSERT( str2.IsEmpty() == false );
-	TEST_ASSERT( str2.MemoryMustBeFreed() == true );
+	TEST_ASSERT( str2.MemoryMustBeFreed() == false );
 
 	const char * testData = "hellozzzzzzzzz";
 	AString str3;
@@ -118,7 +139,14 @@ void TestAString::AStringAssignment() const
 	TEST_ASSERT( str3.GetLength() == 5 );
 	TEST_ASSERT( str3.GetReserved() >= 5 );
 	TEST_ASSERT( str3.IsEmpty() == false );
-	TEST_ASSERT( str3.MemoryMustBeFreed() == true );
+	TEST_ASSERT( str3.MemoryMustBeFreed() == false );
+
+	const char * longData = "Some/Longer/Path/To/A/File.cpp";
+	AString str4;
+	str4 = longData;
+	TEST_ASSERT( str4.GetLength() == 30 );
+	TEST_ASSERT( str4.GetReserved() >= 30 );
+	TEST_ASSERT( str4.MemoryMustBeFreed() == true );
 
 	// assign empty
 	{
@@ -501,4 +529,418 @@ void TestAString::Trim() const
 	}
 }
 
+// ShortString
+//------------------------------------------------------------------------------
+void TestAString::ShortString() const
+{
+	const char * shortData = "File.cpp";
+	const char * longData = "Some/Longer/Path/To/A/File.cpp";
+
+	// short strings use the internal buffer
+	{
+		AString str( shortData );
+		TEST_ASSERT( str.IsShortString() );
+		TEST_ASSERT( str == shortData );
+
+		// copies do too
+		AString copy( str );
+		TEST_ASSERT( copy.IsShortString() );
+		TEST_ASSERT( copy.Get() != str.Get() );
+		TEST_ASSERT( copy == shortData );
+	}
+
+	// growing beyond the internal buffer moves to the heap
+	{
+		AString str( shortData );
+		while ( str.GetLength() <= AString::SHORT_STRING_CAPACITY )
+		{
+			str += shortData;
+		}
+		TEST_ASSERT( str.IsShortString() == false );
+		TEST_ASSERT( str.MemoryMustBeFreed() );
+		TEST_ASSERT( str.BeginsWith( "File.cppFile.cppFile.cpp" ) );
+	}
+
+	// exactly at capacity
+	{
+		AStackString<> data;
+		while ( data.GetLength() < AString::SHORT_STRING_CAPACITY )
+		{
+			data += 'x';
+		}
+		AString str( data );
+		TEST_ASSERT( str.IsShortString() );
+		TEST_ASSERT( str.GetLength() == AString::SHORT_STRING_CAPACITY );
+		str += 'y';
+		TEST_ASSERT( str.IsShortString() == false );
+		TEST_ASSERT( str.EndsWith( "xxy" ) );
+	}
+
+	// long strings stay on the heap when re-assigned shorter strings
+	{
+		AString str( longData );
+		const char * heapMem = str.Get();
+		str = shortData;
+		TEST_ASSERT( str.Get() == heapMem );
+		TEST_ASSERT( str == shortData );
+	}
+
+	// AStackStrings smaller than the internal buffer can grow into it
+	{
+		AStackString< 8 > str( "abc" );
+		str += "defghijkl";
+		TEST_ASSERT( str.IsShortString() );
+		TEST_ASSERT( str == "abcdefghijkl" );
+	}
+
+	// shrinking the reserve of a heap string returns to the internal buffer
+	{
+		AString str( longData );
+		str.SetReserved( 4 );
+		TEST_ASSERT( str.IsShortString() );
+		TEST_ASSERT( str == "Some" );
+	}
+
+	// strings in containers are copied safely
+	{
+		Array< AString > strings;
+		for ( uint32_t i = 0; i < 100; ++i )
+		{
+			strings.Append( AString( ( i % 2 ) ? shortData : longData ) );
+		}
+		for ( uint32_t i = 0; i < 100; ++i )
+		{
+			TEST_ASSERT( strings[ i ] == ( ( i % 2 ) ? shortData : longData ) );
+			TEST_ASSERT( strings[ i ].IsShortString() == ( ( i % 2 ) == 1 ) );
+		}
+	}
+}
+
+// HashLower
+//------------------------------------------------------------------------------
+void TestAString::HashLower() const
+{
+	const char * path = "C:\\Some\\Path\\To\\File.cpp";
+	const uint32_t expected = CRC32::CalcLower( path, AString::StrLen( path ) );
+
+	// hash matches the uncached version, and is case-insensitive
+	AString str( path );
+	TEST_ASSERT( str.GetHashLower() == expected );
+	TEST_ASSERT( CRC32::CalcLower( str ) == expected );
+	str.ToUpper();
+	TEST_ASSERT( str.GetHashLower() == expected );
+
+	// copies inherit the cached hash
+	AString copy( str );
+	TEST_ASSERT( copy.GetHashLower() == expected );
+	AString assigned;
+	assigned = str;
+	TEST_ASSERT( assigned.GetHashLower() == expected );
+
+	// modifications invalidate the hash
+	str += ".obj";
+	TEST_ASSERT( str.GetHashLower() == CRC32::CalcLower( str.Get(), str.GetLength() ) );
+	TEST_ASSERT( str.GetHashLower() != expected );
+	str.SetLength( str.GetLength() - 4 );
+	TEST_ASSERT( str.GetHashLower() == expected );
+	str.Replace( '\\', '/' );
+	TEST_ASSERT( str.GetHashLower() == CRC32::CalcLower( str.Get(), str.GetLength() ) );
+	str.Get()[ 0 ] = 'D';
+	TEST_ASSERT( str.GetHashLower() == CRC32::CalcLower( str.Get(), str.GetLength() ) );
+	str.Clear();
+	TEST_ASSERT( str.GetHashLower() == CRC32::CalcLower( "", 0 ) );
+
+	// stack strings too
+	AStackString<> stackStr( path );
+	TEST_ASSERT( stackStr.GetHashLower() == expected );
+	stackStr.Trim( 3, 0 );
+	TEST_ASSERT( stackStr.GetHashLower() == CRC32::CalcLower( path + 3, AString::StrLen( path + 3 ) ) );
+}
+
+// StringSpeed
+//------------------------------------------------------------------------------
+void TestAString::StringSpeed() const
+{
+	// typical strings: file names, relative includes and full paths
+	const char * strings[] =
+	{
+		"stdafx.h",
+		"Core/Env/Types.h",
+		"Core/Strings/AString.h",
+		"Tools/FBuild/FBuildCore/Graph/Node.h",
+		"C:\\p4\\Code\\Tools\\FBuild\\FBuildCore\\Graph\\NodeGraph.cpp",
+	};
+	const size_t numStrings = sizeof( strings ) / sizeof( const char * );
+	const size_t numIterations = 200000;
+
+	for ( size_t s = 0; s < numStrings; ++s )
+	{
+		const char * src = strings[ s ];
+		const AString srcString( src );
+
+		// construct, copy and append
+		uint32_t sum = 0;
+		Timer t;
+		for ( size_t i = 0; i < numIterations; ++i )
+		{
+			AString a( src );
+			AString b( a );
+			b += ".d";
+			sum += b.GetLength();
+		}
+		const float createTime = t.GetElapsed();
+		TEST_ASSERT( sum == ( numIterations * ( srcString.GetLength() + 2 ) ) );
+
+		// repeated hashing
+		uint32_t hash = 0;
+		t.Start();
+		for ( size_t i = 0; i < numIterations; ++i )
+		{
+			hash += CRC32::CalcLower( srcString.Get(), srcString.GetLength() );
+		}
+		const float hashTime = t.GetElapsed();
+
+		uint32_t cachedHash = 0;
+		t.Start();
+		for ( size_t i = 0; i < numIterations; ++i )
+		{
+			cachedHash += srcString.GetHashLower();
+		}
+		const float cachedHashTime = t.GetElapsed();
+		TEST_ASSERT( hash == cachedHash );
+
+		OUTPUT( "Len %2u (%s) : Create+Copy+Append %2.3fs | Hash %2.3fs | Cached Hash %2.3fs\n",
+				srcString.GetLength(),
+				srcString.IsShortString() ? "short" : "heap ",
+				createTime, hashTime, cachedHashTime );
+	}
+}
+
+// CaseInsensitive
+//------------------------------------------------------------------------------
+void TestAString::CaseInsensitive() const
+{
+	// lengths either side of the vector width
+	const char * lower = "c:\\folder\\subfolder\\another_folder\\file.cpp";
+	const char * mixed = "C:\\Folder\\SubFolder\\Another_Folder\\File.CPP";
+	const size_t len = AString::StrLen( lower );
+	for ( size_t i = 0; i <= len; ++i )
+	{
+		TEST_ASSERT( AString::MemCmpI( lower, mixed, i ) == 0 );
+
+		// a difference at every position is found
+		AStackString<> different( mixed );
+		if ( i < len )
+		{
+			different[ i ] = '~';
+			TEST_ASSERT( AString::MemCmpI( mixed, different.Get(), len ) < 0 );
+			TEST_ASSERT( AString::MemCmpI( different.Get(), lower, len ) > 0 );
+			TEST_ASSERT( AString::MemCmpI( different.Get(), lower, i ) == 0 );
+		}
+	}
+
+	// chars outside of A-Z are not folded
+	TEST_ASSERT( AString::MemCmpI( "@[`{", "`{@[", 4 ) != 0 );
+	TEST_ASSERT( AString::MemCmpI( "\xC0\xC1", "\xE0\xE1", 2 ) != 0 );
+	TEST_ASSERT( AString::MemCmpI( "a\xC0", "A\xC0", 2 ) == 0 );
+	TEST_ASSERT( AString::MemCmpI( "a\xC0", "A\x40", 2 ) > 0 ); // compared unsigned
+
+	// CompareI ordering
+	TEST_ASSERT( AString( "abc" ).CompareI( AString( "ABC" ) ) == 0 );
+	TEST_ASSERT( AString( "abc" ).CompareI( AString( "ABCD" ) ) < 0 );
+	TEST_ASSERT( AString( "abcd" ).CompareI( AString( "ABC" ) ) > 0 );
+	TEST_ASSERT( AString( "abd" ).CompareI( AString( "ABC" ) ) > 0 );
+	TEST_ASSERT( AString( "" ).CompareI( AString( "" ) ) == 0 );
+	TEST_ASSERT( AString( mixed ).CompareI( AString( lower ) ) == 0 );
+
+	// BeginsWithI / EndsWithI
+	TEST_ASSERT( AString( mixed ).BeginsWithI( "c:\\folder\\subfolder\\another" ) );
+	TEST_ASSERT( AString( mixed ).BeginsWithI( "c:\\folder\\subfolder\\anotherX" ) == false );
+	TEST_ASSERT( AString( mixed ).EndsWithI( "subfolder\\another_folder\\file.cpp" ) );
+	TEST_ASSERT( AString( mixed ).EndsWithI( "Xsubfolder\\another_folder\\file.cpp" ) == false );
+
+	// CopyLower
+	{
+		AStackString<> copy( mixed );
+		AString::CopyLower( copy.Get(), copy.Get(), copy.GetLength() );
+		TEST_ASSERT( copy == lower );
+		AString::CopyLower( "ABC@[`{\xC0", copy.Get(), 8 );
+		TEST_ASSERT( copy.BeginsWith( "abc@[`{\xC0" ) );
+	}
+
+	// FindFirstOf
+	{
+		const char * path = "folder_one\\folder_two_is_longer/file.name.cpp";
+		const char * end = path + AString::StrLen( path );
+		const char * pos = path;
+		Array< uint32_t > found;
+		for ( ;; )
+		{
+			pos = AString::FindFirstOf( pos, end, '\\', '/', '.' );
+			if ( pos == end )
+			{
+				break;
+			}
+			found.Append( (uint32_t)( pos - path ) );
+			++pos;
+		}
+		TEST_ASSERT( found.GetSize() == 4 );
+		TEST_ASSERT( found[ 0 ] == 10 );
+		TEST_ASSERT( found[ 1 ] == 31 );
+		TEST_ASSERT( found[ 2 ] == 36 );
+		TEST_ASSERT( found[ 3 ] == 41 );
+		TEST_ASSERT( AString::FindFirstOf( path, path + 10, '\\', '/', '.' ) == ( path + 10 ) );
+	}
+}
+
+// PathSpeed
+//------------------------------------------------------------------------------
+void TestAString::PathSpeed() const
+{
+	// a set of paths as might be seen during graph lookups and include processing
+	Array< AString > paths( 1024, true );
+	Array< AString > pathsUpper( 1024, true );
+	const char * dirs[] = { "Code\\", "Core\\", "Strings\\", "Tools\\", "FBuild\\", "FBuildCore\\", "Graph\\", "External\\SDK\\" };
+	const char * files[] = { "AString.cpp", "NodeGraph.h", "PrecompiledHeader.h", "FileNode.cpp", "x.h" };
+	for ( uint32_t i = 0; i < 1024; ++i )
+	{
+		AStackString<> path( "C:\\p4\\depot\\" );
+		for ( uint32_t j = 0; j < ( i % 6 ); ++j )
+		{
+			path += dirs[ ( i + j ) % 8 ];
+		}
+		path += files[ i % 5 ];
+		paths.Append( path );
+		path.ToUpper();
+		pathsUpper.Append( path );
+	}
+	const size_t numIterations = 1000;
+
+	// equality (as for node lookups)
+	{
+		uint32_t matches = 0;
+		Timer t;
+		for ( size_t j = 0; j < numIterations; ++j )
+		{
+			for ( size_t i = 0; i < paths.GetSize(); ++i )
+			{
+				matches += ( AString::StrNCmpI( paths[ i ].Get(), pathsUpper[ i ].Get(), paths[ i ].GetLength() ) == 0 ) ? 1 : 0;
+			}
+		}
+		const float scalarTime = t.GetElapsed();
+
+		uint32_t matches2 = 0;
+		t.Start();
+		for ( size_t j = 0; j < numIterations; ++j )
+		{
+			for ( size_t i = 0; i < paths.GetSize(); ++i )
+			{
+				matches2 += ( paths[ i ].CompareI( pathsUpper[ i ] ) == 0 ) ? 1 : 0;
+			}
+		}
+		const float time = t.GetElapsed();
+		TEST_ASSERT( matches == ( paths.GetSize() * numIterations ) );
+		TEST_ASSERT( matches2 == matches );
+		OUTPUT( "CompareI        : %2.3fs (per-char: %2.3fs)\n", time, scalarTime );
+	}
+
+	// prefix matching (as for exclusion filtering)
+	{
+		const AStackString<> prefix( "C:\\P4\\DEPOT\\CODE\\CORE\\" );
+		uint32_t matches = 0;
+		Timer t;
+		for ( size_t j = 0; j < numIterations; ++j )
+		{
+			for ( size_t i = 0; i < paths.GetSize(); ++i )
+			{
+				const AString & path = paths[ i ];
+				matches += ( ( path.GetLength() >= prefix.GetLength() ) &&
+							 ( AString::StrNCmpI( path.Get(), prefix.Get(), prefix.GetLength() ) == 0 ) ) ? 1 : 0;
+			}
+		}
+		const float scalarTime = t.GetElapsed();
+
+		uint32_t matches2 = 0;
+		t.Start();
+		for ( size_t j = 0; j < numIterations; ++j )
+		{
+			for ( size_t i = 0; i < paths.GetSize(); ++i )
+			{
+				matches2 += paths[ i ].BeginsWithI( prefix ) ? 1 : 0;
+			}
+		}
+		const float time = t.GetElapsed();
+		TEST_ASSERT( matches2 == matches );
+		OUTPUT( "BeginsWithI     : %2.3fs (per-char: %2.3fs)\n", time, scalarTime );
+	}
+
+	// case-insensitive hashing
+	{
+		uint32_t hash = 0;
+		Timer t;
+		for ( size_t j = 0; j < numIterations; ++j )
+		{
+			for ( size_t i = 0; i < paths.GetSize(); ++i )
+			{
+				hash += CRC32::Stop( CRC32::UpdateLower( CRC32::Start(), paths[ i ].Get(), paths[ i ].GetLength() ) );
+			}
+		}
+		const float scalarTime = t.GetElapsed();
+
+		uint32_t hash2 = 0;
+		t.Start();
+		for ( size_t j = 0; j < numIterations; ++j )
+		{
+			for ( size_t i = 0; i < paths.GetSize(); ++i )
+			{
+				hash2 += CRC32::CalcLower( paths[ i ].Get(), paths[ i ].GetLength() );
+			}
+		}
+		const float time = t.GetElapsed();
+		TEST_ASSERT( hash2 == hash );
+		OUTPUT( "CRC32::CalcLower: %2.3fs (per-char: %2.3fs)\n", time, scalarTime );
+	}
+
+	// finding path separators
+	{
+		uint32_t count = 0;
+		Timer t;
+		for ( size_t j = 0; j < numIterations; ++j )
+		{
+			for ( size_t i = 0; i < paths.GetSize(); ++i )
+			{
+				for ( const char * pos = paths[ i ].Get(); *pos; ++pos )
+				{
+					count += ( ( *pos == '\\' ) || ( *pos == '/' ) || ( *pos == '.' ) ) ? 1 : 0;
+				}
+			}
+		}
+		const float scalarTime = t.GetElapsed();
+
+		uint32_t count2 = 0;
+		t.Start();
+		for ( size_t j = 0; j < numIterations; ++j )
+		{
+			for ( size_t i = 0; i < paths.GetSize(); ++i )
+			{
+				const char * pos = paths[ i ].Get();
+				const char * end = paths[ i ].GetEnd();
+				for ( ;; )
+				{
+					pos = AString::FindFirstOf( pos, end, '\\', '/', '.' );
+					if ( pos == end )
+					{
+						break;
+					}
+					++count2;
+					++pos;
+				}
+			}
+		}
+		const float time = t.GetElapsed();
+		TEST_ASSERT( count2 == count );
+		OUTPUT( "FindFirstOf     : %2.3fs (per-char: %2.3fs)\n", time, scalarTime );
+	}
+}
+
 //------------------------------------------------------------------------------
@@ -6,12 +6,17 @@
 #include "TestFramework/UnitTest.h"
 
 // Core
+#include "Core/FileIO/DirectoryWalker.h"
 #include "Core/FileIO/FileIO.h"
 #include "Core/FileIO/FileStream.h"
+#include "Core/FileIO/PathUtils.h"
+#include "Core/Math/Conversions.h"
 #include "Core/Math/Random.h"
 #include "Core/Process/Process.h"
 #include "Core/Process/Thread.h"
 #include "Core/Strings/AStackString.h"
+#include "Core/Time/Timer.h"
+#include "Core/Tracing/Tracing.h"
 
 // TestFileIO
 //------------------------------------------------------------------------------
@@ -24,14 +29,19 @@ private:
 	void FileDelete() const;
 	void FileCopy() const;
 	void FileMove() const;
+	void WriteFromFile() const;
+	void CopyMethods() const;
 
 	void ReadOnly() const;
 
 	void FileTime() const;
 
+	void DirectoryWalk() const;
+
 	// Helpers
 	mutable Random m_Random;
 	void GenerateTempFileName( AString & tmpFileName ) const;
+	static void CreateFile( const AString & path, Array< AString > & createdFiles );
 };
 
 // Register Tests
@@ -41,8 +51,11 @@ REGISTER_TESTS_BEGIN( TestFileIO )
 	REGISTER_TEST( FileDelete )
 	REGISTER_TEST( FileCopy )
 	REGISTER_TEST( FileMove )
+	REGISTER_TEST( WriteFromFile )
+	REGISTER_TEST( CopyMethods )
 	REGISTER_TEST( ReadOnly )
 	REGISTER_TEST( FileTime )
+	REGISTER_TEST( DirectoryWalk )
 REGISTER_TESTS_END
 
 // FileExists
@@ -157,6 +170,128 @@ void TestFileIO::FileMove() const
 	VERIFY( FileIO::FileDelete( pathCopy.Get() ) );
 }
 
+// WriteFromFile
+//------------------------------------------------------------------------------
+void TestFileIO::WriteFromFile() const
+{
+	// generate a process unique file path
+	AStackString<> path;
+	GenerateTempFileName( path );
+	AStackString<> pathCopy( path );
+	pathCopy += ".copy";
+
+	// source file larger than the intermediate buffer used when the OS can't copy
+	const uint32_t srcSize = ( 600 * 1024 );
+	const uint32_t copyOffset = 1001; // unaligned
+	const uint32_t copySize = ( srcSize - copyOffset - 7 );
+	Array< uint8_t > srcData( srcSize, false );
+	for ( uint32_t i = 0; i < srcSize; ++i )
+	{
+		srcData.Append( (uint8_t)m_Random.GetRand() );
+	}
+	{
+		FileStream src;
+		TEST_ASSERT( src.Open( path.Get(), FileStream::WRITE_ONLY ) );
+		TEST_ASSERT( src.WriteBuffer( srcData.Begin(), srcSize ) == srcSize );
+	}
+
+	// copy part of it between some other writes
+	{
+		FileStream src;
+		TEST_ASSERT( src.Open( path.Get(), FileStream::READ_ONLY ) );
+		FileStream dst;
+		TEST_ASSERT( dst.Open( pathCopy.Get(), FileStream::WRITE_ONLY ) );
+		TEST_ASSERT( dst.WriteBuffer( "abc", 3 ) == 3 );
+		TEST_ASSERT( dst.WriteFromFile( src, copyOffset, copySize ) == copySize );
+		TEST_ASSERT( dst.Tell() == ( 3 + copySize ) );
+		TEST_ASSERT( dst.WriteBuffer( "xyz", 3 ) == 3 );
+	}
+
+	// check result
+	{
+		FileStream dst;
+		TEST_ASSERT( dst.Open( pathCopy.Get(), FileStream::READ_ONLY ) );
+		TEST_ASSERT( dst.GetFileSize() == ( copySize + 6 ) );
+		Array< uint8_t > dstData( copySize + 6, false );
+		dstData.SetSize( copySize + 6 );
+		TEST_ASSERT( dst.ReadBuffer( dstData.Begin(), copySize + 6 ) == ( copySize + 6 ) );
+		TEST_ASSERT( memcmp( dstData.Begin(), "abc", 3 ) == 0 );
+		TEST_ASSERT( memcmp( dstData.Begin() + 3, srcData.Begin() + copyOffset, copySize ) == 0 );
+		TEST_ASSERT( memcmp( dstData.Begin() + 3 + copySize, "xyz", 3 ) == 0 );
+	}
+
+	// cleanup
+	VERIFY( FileIO::FileDelete( path.Get() ) );
+	VERIFY( FileIO::FileDelete( pathCopy.Get() ) );
+}
+
+// CopyMethods
+//------------------------------------------------------------------------------
+void TestFileIO::CopyMethods() const
+{
+	// generate a process unique file path
+	AStackString<> path;
+	GenerateTempFileName( path );
+	AStackString<> pathCopy( path );
+	pathCopy += ".copy";
+
+	// source file large enough to need several chunks in each method
+	const uint32_t srcSize = ( 32 * 1024 * 1024 ) + 13;
+	Array< uint8_t > srcData( srcSize, false );
+	srcData.SetSize( srcSize );
+	uint32_t * words = (uint32_t *)srcData.Begin();
+	for ( uint32_t i = 0; i < ( srcSize / sizeof( uint32_t ) ); ++i )
+	{
+		words[ i ] = m_Random.GetRand();
+	}
+	{
+		FileStream src;
+		TEST_ASSERT( src.Open( path.Get(), FileStream::WRITE_ONLY ) );
+		TEST_ASSERT( src.WriteBuffer( srcData.Begin(), srcSize ) == srcSize );
+	}
+
+	// copy with each method (the fastest one supported is reported)
+	const char * const methodNames[] = { "Clone", "In-Kernel", "Stream" };
+	Array< uint8_t > dstData( srcSize, false );
+	dstData.SetSize( srcSize );
+	for ( uint32_t method = FileIO::COPY_METHOD_CLONE; method <= FileIO::COPY_METHOD_STREAM; ++method )
+	{
+		FileIO::CopyMethod methodUsed;
+		Timer t;
+		TEST_ASSERT( FileIO::FileCopy( path.Get(), pathCopy.Get(), true, (FileIO::CopyMethod)method, &methodUsed ) );
+		const float time = t.GetElapsed();
+		TEST_ASSERT( methodUsed >= method );
+
+		FileStream dst;
+		TEST_ASSERT( dst.Open( pathCopy.Get(), FileStream::READ_ONLY ) );
+		TEST_ASSERT( dst.ReadBuffer( dstData.Begin(), srcSize ) == srcSize );
+		TEST_ASSERT( memcmp( srcData.Begin(), dstData.Begin(), srcSize ) == 0 );
+		dst.Close();
+
+		OUTPUT( "Copy %-9s : %2.3fs (%u MiB/s, used: %s)\n",
+				methodNames[ method ], time, (uint32_t)( (float)srcSize / ( 1024.0f * 1024.0f ) / Math::Max( time, 0.0001f ) ),
+				methodNames[ methodUsed ] );
+	}
+
+	// hard link (replacing the copy)
+	{
+		Timer t;
+		TEST_ASSERT( FileIO::FileHardLink( path.Get(), pathCopy.Get() ) );
+		const float time = t.GetElapsed();
+
+		FileStream dst;
+		TEST_ASSERT( dst.Open( pathCopy.Get(), FileStream::READ_ONLY ) );
+		TEST_ASSERT( dst.GetFileSize() == srcSize );
+		dst.Close();
+
+		OUTPUT( "HardLink       : %2.3fs\n", time );
+	}
+
+	// cleanup
+	VERIFY( FileIO::FileDelete( path.Get() ) );
+	VERIFY( FileIO::FileDelete( pathCopy.Get() ) );
+}
+
 // ReadOnly
 //------------------------------------------------------------------------------
 void TestFileIO::ReadOnly() const
@@ -229,6 +364,141 @@ void TestFileIO::FileTime() const
     TEST_ASSERT( timeNow == oldTime );
 }
 
+// DirectoryWalk
+//------------------------------------------------------------------------------
+void TestFileIO::DirectoryWalk() const
+{
+	// create a tree
+	//  root/{a.cpp,b.h,skip.cpp}
+	//  root/subN/{f0.cpp,f1.h,skip.cpp}, root/subN/deep/x.cpp (N=0..19)
+	//  root/excluded/e.cpp, root/excluded/inner/g.cpp
+	AStackString<> root;
+	GenerateTempFileName( root );
+	root += NATIVE_SLASH;
+
+	Array< AString > files( 128, true );
+	Array< AString > dirs( 64, true );
+	AStackString<> path;
+	dirs.Append( root );
+	path.Format( "%sa.cpp", root.Get() );
+	CreateFile( path, files );
+	path.Format( "%sb.h", root.Get() );
+	CreateFile( path, files );
+	path.Format( "%sskip.cpp", root.Get() );
+	CreateFile( path, files );
+	for ( uint32_t i = 0; i < 20; ++i )
+	{
+		path.Format( "%ssub%u%c", root.Get(), i, NATIVE_SLASH );
+		dirs.Append( path );
+		path.Format( "%ssub%u%cdeep%c", root.Get(), i, NATIVE_SLASH, NATIVE_SLASH );
+		dirs.Append( path );
+		path.Format( "%ssub%u%cf0.cpp", root.Get(), i, NATIVE_SLASH );
+		CreateFile( path, files );
+		path.Format( "%ssub%u%cf1.h", root.Get(), i, NATIVE_SLASH );
+		CreateFile( path, files );
+		path.Format( "%ssub%u%cskip.cpp", root.Get(), i, NATIVE_SLASH );
+		CreateFile( path, files );
+		path.Format( "%ssub%u%cdeep%cx.cpp", root.Get(), i, NATIVE_SLASH, NATIVE_SLASH );
+		CreateFile( path, files );
+	}
+	AStackString<> excludedDir;
+	excludedDir.Format( "%sexcluded%c", root.Get(), NATIVE_SLASH );
+	dirs.Append( excludedDir );
+	path.Format( "%sinner%c", excludedDir.Get(), NATIVE_SLASH );
+	dirs.Append( path );
+	path.Format( "%se.cpp", excludedDir.Get() );
+	CreateFile( path, files );
+	path.Format( "%sinner%cg.cpp", excludedDir.Get(), NATIVE_SLASH );
+	CreateFile( path, files );
+
+	Array< AString > noExclusions;
+
+	// everything, with and without helper threads
+	Array< FileIO::FileInfo > allSingle( 128, true );
+	Array< FileIO::FileInfo > allMulti( 128, true );
+	{
+		DirectoryWalker walker( nullptr, noExclusions, noExclusions );
+		walker.SetMaxThreads( 1 );
+		TEST_ASSERT( walker.GetFiles( root, true, allSingle ) );
+		TEST_ASSERT( walker.GetNumThreadsUsed() == 1 );
+		TEST_ASSERT( walker.GetNumDirectoriesListed() == dirs.GetSize() );
+		walker.SetMaxThreads( 4 );
+		TEST_ASSERT( walker.GetFiles( root, true, allMulti ) );
+		TEST_ASSERT( walker.GetNumDirectoriesListed() == dirs.GetSize() );
+	}
+	TEST_ASSERT( allSingle.GetSize() == files.GetSize() );
+	TEST_ASSERT( allMulti.GetSize() == files.GetSize() );
+	for ( size_t i = 0; i < allSingle.GetSize(); ++i )
+	{
+		// order is deterministic
+		TEST_ASSERT( allSingle[ i ].m_Name == allMulti[ i ].m_Name );
+		TEST_ASSERT( allSingle[ i ].m_Size == 0 );
+	}
+	TEST_ASSERT( allSingle[ 0 ].m_Name.EndsWith( "a.cpp" ) ); // files before sub-dirs
+
+	// patterns, excluded paths and excluded files
+	{
+		Array< AString > patterns;
+		patterns.Append( AStackString<>( "*.cpp" ) );
+		Array< AString > excludePaths;
+		excludePaths.Append( excludedDir );
+		Array< AString > excludeFiles;
+		excludeFiles.Append( AStackString<>( "skip.cpp" ) );
+		path.Format( "sub3%cf0.cpp", NATIVE_SLASH );
+		excludeFiles.Append( path );
+
+		DirectoryWalker walker( &patterns, excludePaths, excludeFiles );
+		walker.SetMaxThreads( 4 );
+		Array< FileIO::FileInfo > results( 128, true );
+		TEST_ASSERT( walker.GetFiles( root, true, results ) );
+		TEST_ASSERT( results.GetSize() == ( 1 + ( 20 * 2 ) - 1 ) ); // a.cpp + f0.cpp & x.cpp per sub-dir, except sub3/f0.cpp
+		TEST_ASSERT( walker.GetNumDirectoriesPruned() == 1 );
+		TEST_ASSERT( walker.GetNumDirectoriesListed() == ( dirs.GetSize() - 2 ) ); // excluded/ and excluded/inner/ not listed
+		for ( const FileIO::FileInfo & info : results )
+		{
+			TEST_ASSERT( info.m_Name.EndsWith( ".cpp" ) );
+			TEST_ASSERT( info.m_Name.EndsWith( "skip.cpp" ) == false );
+			TEST_ASSERT( PathUtils::PathBeginsWith( info.m_Name, excludedDir ) == false );
+		}
+
+		// excluding a parent excludes everything
+		Array< AString > excludeRoot;
+		excludeRoot.Append( root );
+		DirectoryWalker walker2( nullptr, excludeRoot, noExclusions );
+		Array< FileIO::FileInfo > results2( 128, true );
+		TEST_ASSERT( walker2.GetFiles( excludedDir, true, results2 ) == false );
+		TEST_ASSERT( results2.IsEmpty() );
+	}
+
+	// non-recursive
+	{
+		Array< FileIO::FileInfo > results( 128, true );
+		TEST_ASSERT( FileIO::GetFilesEx( root, nullptr, false, &results ) );
+		TEST_ASSERT( results.GetSize() == 3 );
+	}
+
+	// clean up
+	for ( const AString & file : files )
+	{
+		TEST_ASSERT( FileIO::FileDelete( file.Get() ) );
+	}
+	for ( size_t i = dirs.GetSize(); i > 0; --i )
+	{
+		TEST_ASSERT( FileIO::DirectoryDelete( dirs[ i - 1 ] ) );
+	}
+}
+
+// CreateFile
+//------------------------------------------------------------------------------
+/*static*/ void TestFileIO::CreateFile( const AString & path, Array< AString > & createdFiles )
+{
+	TEST_ASSERT( FileIO::EnsurePathExists( AStackString<>( path.Get(), path.FindLast( NATIVE_SLASH ) ) ) );
+	FileStream f;
+	TEST_ASSERT( f.Open( path.Get(), FileStream::WRITE_ONLY ) );
+	f.Close();
+	createdFiles.Append( path );
+}
+
 // GenerateTempFileName
 //------------------------------------------------------------------------------
 void TestFileIO::GenerateTempFileName( AString & tmpFileName ) const
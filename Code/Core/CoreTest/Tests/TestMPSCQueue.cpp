@@ -0,0 +1,241 @@
+// TestMPSCQueue.cpp
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "TestFramework/UnitTest.h"
+
+#include "Core/Containers/Array.h"
+#include "Core/Containers/MPSCQueue.h"
+#include "Core/Mem/Mem.h"
+#include "Core/Process/Mutex.h"
+#include "Core/Process/Thread.h"
+#include "Core/Time/Timer.h"
+#include "Core/Tracing/Tracing.h"
+
+// TestMPSCQueue
+//------------------------------------------------------------------------------
+class TestMPSCQueue : public UnitTest
+{
+private:
+	DECLARE_TESTS
+
+	void PushPop() const;
+	void MultipleProducers() const;
+	void ProducerSpeed() const;
+};
+
+// Register Tests
+//------------------------------------------------------------------------------
+REGISTER_TESTS_BEGIN( TestMPSCQueue )
+	REGISTER_TEST( PushPop )
+	REGISTER_TEST( MultipleProducers )
+	REGISTER_TEST( ProducerSpeed )
+REGISTER_TESTS_END
+
+// Item
+//------------------------------------------------------------------------------
+namespace
+{
+	struct Item
+	{
+		uint32_t	m_Producer;
+		uint32_t	m_Index;
+		Item *		m_Next;
+	};
+	typedef MPSCQueue< Item, &Item::m_Next > ItemQueue;
+
+	enum { NUM_PRODUCERS = 4 };
+	enum { NUM_ITEMS_PER_PRODUCER = 100000 };
+
+	struct ProducerInfo
+	{
+		ItemQueue *		m_Queue;
+		Mutex *			m_Mutex;		// for comparison with a locked array
+		Array< Item * > * m_LockedArray;
+		Item *			m_Items;
+		volatile bool *	m_Go;
+	};
+
+	uint32_t ProducerThreadFunc( void * userData )
+	{
+		ProducerInfo & info = *static_cast< ProducerInfo * >( userData );
+		while ( *info.m_Go == false ) {}
+		for ( uint32_t i = 0; i < NUM_ITEMS_PER_PRODUCER; ++i )
+		{
+			if ( info.m_Queue )
+			{
+				info.m_Queue->Push( &info.m_Items[ i ] );
+			}
+			else
+			{
+				MutexHolder mh( *info.m_Mutex );
+				info.m_LockedArray->Append( &info.m_Items[ i ] );
+			}
+		}
+		return 0;
+	}
+}
+
+// PushPop
+//------------------------------------------------------------------------------
+void TestMPSCQueue::PushPop() const
+{
+	Item items[ 3 ];
+	for ( uint32_t i = 0; i < 3; ++i )
+	{
+		items[ i ].m_Producer = 0;
+		items[ i ].m_Index = i;
+		items[ i ].m_Next = nullptr;
+	}
+
+	ItemQueue queue;
+	TEST_ASSERT( queue.IsEmpty() );
+	TEST_ASSERT( queue.PopAll() == nullptr );
+
+	// first push reports queue was empty
+	TEST_ASSERT( queue.Push( &items[ 0 ] ) == true );
+	TEST_ASSERT( queue.Push( &items[ 1 ] ) == false );
+	TEST_ASSERT( queue.Push( &items[ 2 ] ) == false );
+	TEST_ASSERT( queue.IsEmpty() == false );
+
+	// items are returned in push order
+	Item * item = queue.PopAll();
+	TEST_ASSERT( queue.IsEmpty() );
+	TEST_ASSERT( item == &items[ 0 ] );
+	TEST_ASSERT( item->m_Next == &items[ 1 ] );
+	TEST_ASSERT( item->m_Next->m_Next == &items[ 2 ] );
+	TEST_ASSERT( item->m_Next->m_Next->m_Next == nullptr );
+
+	// re-use after popping
+	TEST_ASSERT( queue.Push( &items[ 1 ] ) == true );
+	item = queue.PopAll();
+	TEST_ASSERT( ( item == &items[ 1 ] ) && ( item->m_Next == nullptr ) );
+}
+
+// MultipleProducers
+//------------------------------------------------------------------------------
+void TestMPSCQueue::MultipleProducers() const
+{
+	ItemQueue queue;
+	volatile bool go = false;
+
+	Item * items = (Item *)ALLOC( sizeof( Item ) * NUM_PRODUCERS * NUM_ITEMS_PER_PRODUCER );
+	ProducerInfo infos[ NUM_PRODUCERS ];
+	Thread::ThreadHandle threads[ NUM_PRODUCERS ];
+	for ( uint32_t p = 0; p < NUM_PRODUCERS; ++p )
+	{
+		infos[ p ].m_Queue = &queue;
+		infos[ p ].m_Mutex = nullptr;
+		infos[ p ].m_LockedArray = nullptr;
+		infos[ p ].m_Items = items + ( p * NUM_ITEMS_PER_PRODUCER );
+		infos[ p ].m_Go = &go;
+		for ( uint32_t i = 0; i < NUM_ITEMS_PER_PRODUCER; ++i )
+		{
+			infos[ p ].m_Items[ i ].m_Producer = p;
+			infos[ p ].m_Items[ i ].m_Index = i;
+			infos[ p ].m_Items[ i ].m_Next = nullptr;
+		}
+		threads[ p ] = Thread::CreateThread( ProducerThreadFunc, "Producer", ( 64 * KILOBYTE ), &infos[ p ] );
+	}
+
+	// consume while producers are active
+	go = true;
+	uint32_t nextIndex[ NUM_PRODUCERS ] = { 0 };
+	uint32_t numReceived = 0;
+	bool orderOK = true;
+	while ( numReceived < ( NUM_PRODUCERS * NUM_ITEMS_PER_PRODUCER ) )
+	{
+		Item * item = queue.PopAll();
+		while ( item )
+		{
+			// each producer's items arrive once, and in order
+			orderOK &= ( item->m_Index == nextIndex[ item->m_Producer ] );
+			++nextIndex[ item->m_Producer ];
+			++numReceived;
+			item = item->m_Next;
+		}
+	}
+	TEST_ASSERT( orderOK );
+	TEST_ASSERT( queue.IsEmpty() );
+
+	for ( uint32_t p = 0; p < NUM_PRODUCERS; ++p )
+	{
+		bool timedOut = false;
+		Thread::WaitForThread( threads[ p ], 10000, timedOut );
+		TEST_ASSERT( timedOut == false );
+		Thread::CloseHandle( threads[ p ] );
+		TEST_ASSERT( nextIndex[ p ] == NUM_ITEMS_PER_PRODUCER );
+	}
+
+	FREE( items );
+}
+
+// ProducerSpeed
+//------------------------------------------------------------------------------
+void TestMPSCQueue::ProducerSpeed() const
+{
+	Item * items = (Item *)ALLOC( sizeof( Item ) * NUM_PRODUCERS * NUM_ITEMS_PER_PRODUCER );
+
+	for ( uint32_t useQueue = 0; useQueue < 2; ++useQueue )
+	{
+		ItemQueue queue;
+		Mutex mutex;
+		Array< Item * > lockedArray( 1024, true );
+		Array< Item * > consumerArray( 1024, true );
+		volatile bool go = false;
+
+		ProducerInfo infos[ NUM_PRODUCERS ];
+		Thread::ThreadHandle threads[ NUM_PRODUCERS ];
+		for ( uint32_t p = 0; p < NUM_PRODUCERS; ++p )
+		{
+			infos[ p ].m_Queue = useQueue ? &queue : nullptr;
+			infos[ p ].m_Mutex = &mutex;
+			infos[ p ].m_LockedArray = &lockedArray;
+			infos[ p ].m_Items = items + ( p * NUM_ITEMS_PER_PRODUCER );
+			infos[ p ].m_Go = &go;
+			threads[ p ] = Thread::CreateThread( ProducerThreadFunc, "Producer", ( 64 * KILOBYTE ), &infos[ p ] );
+		}
+
+		Timer t;
+		go = true;
+		uint32_t numReceived = 0;
+		while ( numReceived < ( NUM_PRODUCERS * NUM_ITEMS_PER_PRODUCER ) )
+		{
+			if ( useQueue )
+			{
+				for ( Item * item = queue.PopAll(); item; item = item->m_Next )
+				{
+					++numReceived;
+				}
+			}
+			else
+			{
+				// swap as JobQueue used to
+				{
+					MutexHolder mh( mutex );
+					consumerArray.Swap( lockedArray );
+				}
+				numReceived += (uint32_t)consumerArray.GetSize();
+				consumerArray.Clear();
+			}
+		}
+		const float time = t.GetElapsed();
+
+		for ( uint32_t p = 0; p < NUM_PRODUCERS; ++p )
+		{
+			bool timedOut = false;
+			Thread::WaitForThread( threads[ p ], 10000, timedOut );
+			TEST_ASSERT( timedOut == false );
+			Thread::CloseHandle( threads[ p ] );
+		}
+
+		OUTPUT( "%-16s: %2.3fs (%u producers, %u items)\n",
+				useQueue ? "MPSCQueue" : "Mutex + Array",
+				time, (uint32_t)NUM_PRODUCERS, (uint32_t)( NUM_PRODUCERS * NUM_ITEMS_PER_PRODUCER ) );
+	}
+
+	FREE( items );
+}
+
+//------------------------------------------------------------------------------
@@ -7,9 +7,16 @@
 
 #include "Core/Mem/Mem.h"
 #include "Core/Mem/MemPoolBlock.h"
+#include "Core/Mem/ScratchArena.h"
+#include "Core/Mem/SmallBlockAllocator.h"
+#include "Core/Process/Atomic.h"
+#include "Core/Process/Thread.h"
 #include "Core/Time/Timer.h"
 #include "Core/Tracing/Tracing.h"
 
+#include <stdlib.h>
+#include <string.h>
+
 // TestMemPoolBlock
 //------------------------------------------------------------------------------
 class TestMemPoolBlock : public UnitTest
@@ -21,6 +28,29 @@ private:
 	void TestAllocs() const;
 	void TestAllocsMultiplePages() const;
 	void TestSpeed();
+	void TestSmallBlockAllocs() const;
+	void TestSmallBlockThreads() const;
+	void TestSmallBlockSpeed() const;
+	void TestScratchArena() const;
+
+	struct ThreadData
+	{
+		void **				m_ToFree;		// blocks allocated by another thread
+		uint32_t			m_NumToFree;
+		uint32_t			m_Seed;
+		uint32_t			m_Mode;
+		volatile uint32_t *	m_Errors;
+	};
+	enum AllocMode
+	{
+		MODE_ALLOC,			// ALLOC/FREE, as used by the code base (includes MemTracker overhead in DEBUG)
+		MODE_SMALL_BLOCK,	// SmallBlockAllocator only
+		MODE_SYSTEM			// malloc/free
+	};
+	static void * ThreadAlloc( uint32_t mode, size_t size );
+	static void ThreadFree( uint32_t mode, void * mem );
+	static uint32_t ThreadFunc( void * userData );
+	static float RunThreads( uint32_t numThreads, AllocMode mode, void ** toFree, uint32_t numToFree, volatile uint32_t & errors );
 };
 
 // Register Tests
@@ -30,6 +60,10 @@ REGISTER_TESTS_BEGIN( TestMemPoolBlock )
 	REGISTER_TEST( TestAllocs )
 	REGISTER_TEST( TestAllocsMultiplePages );
 	REGISTER_TEST( TestSpeed );
+	REGISTER_TEST( TestSmallBlockAllocs );
+	REGISTER_TEST( TestSmallBlockThreads );
+	REGISTER_TEST( TestSmallBlockSpeed );
+	REGISTER_TEST( TestScratchArena );
 REGISTER_TESTS_END
 
 // TestUnused
@@ -135,4 +169,263 @@ void TestMemPoolBlock::TestSpeed()
 	OUTPUT( "MemPoolBlock : %2.3fs - %u allocs @ %u allocs/sec\n", time2, numAllocs, (uint32_t)( (float)numAllocs / time2 ) );
 }
 
+// TestSmallBlockAllocs
+//------------------------------------------------------------------------------
+void TestMemPoolBlock::TestSmallBlockAllocs() const
+{
+	SmallBlockAllocator::Stats before;
+	SmallBlockAllocator::GetStats( before );
+
+	// allocate every size upto and beyond the largest block size
+	const size_t maxSize( SmallBlockAllocator::MAX_BLOCK_SIZE + 64 );
+	Array< void * > allocs( maxSize + 1, false );
+	for ( size_t i = 0; i <= maxSize; ++i )
+	{
+		void * mem = ALLOC( i );
+		TEST_ASSERT( mem );
+		if ( i <= SmallBlockAllocator::MAX_BLOCK_SIZE )
+		{
+			TEST_ASSERT( ( (size_t)mem % SmallBlockAllocator::BLOCK_ALIGNMENT ) == 0 );
+		}
+		memset( mem, (int)( i & 0xFF ), i );
+		allocs.Append( mem );
+	}
+
+	// no allocation was trampled by another
+	for ( size_t i = 0; i <= maxSize; ++i )
+	{
+		const unsigned char * mem = (const unsigned char *)allocs[ i ];
+		for ( size_t j = 0; j < i; ++j )
+		{
+			TEST_ASSERT( mem[ j ] == ( i & 0xFF ) );
+		}
+	}
+
+	SmallBlockAllocator::Stats during;
+	SmallBlockAllocator::GetStats( during );
+
+	for ( void * mem : allocs )
+	{
+		FREE( mem );
+	}
+
+	// (only checked when the region could be reserved)
+	if ( during.m_ReservedBytes )
+	{
+		TEST_ASSERT( during.m_CommittedBytes > 0 );
+		for ( uint32_t i = 0; i < SmallBlockAllocator::NUM_SIZE_CLASSES; ++i )
+		{
+			TEST_ASSERT( during.m_SizeClasses[ i ].m_NumBlocksOut > 0 );
+			TEST_ASSERT( during.m_SizeClasses[ i ].m_NumRefills >= before.m_SizeClasses[ i ].m_NumRefills );
+		}
+	}
+
+	// over-aligned allocations are handled by the system
+	void * aligned = ALLOC( 32, 64 );
+	TEST_ASSERT( ( (size_t)aligned % 64 ) == 0 );
+	FREE( aligned );
+}
+
+// TestSmallBlockThreads
+//------------------------------------------------------------------------------
+void TestMemPoolBlock::TestSmallBlockThreads() const
+{
+	// blocks allocated here are freed on other threads
+	const uint32_t numThreads( 4 );
+	const uint32_t numToFree( 10 * 1000 );
+	Array< void * > toFree( numThreads * numToFree, false );
+	for ( uint32_t i = 0; i < ( numThreads * numToFree ); ++i )
+	{
+		toFree.Append( ALLOC( 1 + ( i % SmallBlockAllocator::MAX_BLOCK_SIZE ) ) );
+	}
+
+	volatile uint32_t errors( 0 );
+	RunThreads( numThreads, MODE_ALLOC, toFree.Begin(), numToFree, errors );
+	TEST_ASSERT( errors == 0 );
+}
+
+// TestSmallBlockSpeed
+//------------------------------------------------------------------------------
+void TestMemPoolBlock::TestSmallBlockSpeed() const
+{
+	for ( uint32_t numThreads = 1; numThreads <= 8; numThreads *= 2 )
+	{
+		volatile uint32_t errors( 0 );
+		const float timeSystem = RunThreads( numThreads, MODE_SYSTEM, nullptr, 0, errors );
+		const float timeSmallBlock = RunThreads( numThreads, MODE_SMALL_BLOCK, nullptr, 0, errors );
+		const float timeAlloc = RunThreads( numThreads, MODE_ALLOC, nullptr, 0, errors );
+		TEST_ASSERT( errors == 0 );
+
+		OUTPUT( "%u threads : malloc %2.3fs, SmallBlockAllocator %2.3fs, ALLOC %2.3fs\n", numThreads, timeSystem, timeSmallBlock, timeAlloc );
+	}
+}
+
+// TestScratchArena
+//------------------------------------------------------------------------------
+void TestMemPoolBlock::TestScratchArena() const
+{
+	ScratchArena arena( 4096 );
+	TEST_ASSERT( arena.GetNumChunks() == 1 );
+
+	// alignment is respected
+	char * a = (char *)arena.Alloc( 1, 1 );
+	void * b = arena.Alloc( 8, 8 );
+	void * c = arena.Alloc( 16, 16 );
+	TEST_ASSERT( a && b && c );
+	TEST_ASSERT( ( (size_t)b % 8 ) == 0 );
+	TEST_ASSERT( ( (size_t)c % 16 ) == 0 );
+
+	// rewinding releases allocations made within a scope
+	void * beforeScope;
+	{
+		ScratchArena::Scope scope( arena );
+		beforeScope = arena.Alloc( 100 );
+		memset( beforeScope, 0, 100 );
+
+		// allocations larger than a chunk
+		void * big = arena.Alloc( 100 * 1024 );
+		memset( big, 1, 100 * 1024 );
+		TEST_ASSERT( arena.GetNumChunks() == 2 );
+
+		// and spilling over into more chunks
+		for ( size_t i = 0; i < 100; ++i )
+		{
+			memset( arena.Alloc( 100 ), 2, 100 );
+		}
+		TEST_ASSERT( arena.GetNumChunks() > 2 );
+	}
+	TEST_ASSERT( arena.Alloc( 100 ) == beforeScope );
+	TEST_ASSERT( arena.GetPeakBytes() > ( 100 * 1024 ) );
+
+	// chunks are re-used after rewinding
+	const uint32_t numChunks = arena.GetNumChunks();
+	{
+		ScratchArena::Scope scope( arena );
+		for ( size_t i = 0; i < 100; ++i )
+		{
+			arena.Alloc( 100 );
+		}
+	}
+	TEST_ASSERT( arena.GetNumChunks() == numChunks );
+
+	// reset
+	arena.Reset();
+	TEST_ASSERT( arena.Alloc( 1, 1 ) == a );
+
+	// thread arena
+	ScratchArena & threadArena = ScratchArena::GetThreadArena();
+	TEST_ASSERT( &threadArena == &ScratchArena::GetThreadArena() );
+	{
+		ScratchArena::Scope scope( threadArena );
+		TEST_ASSERT( threadArena.Alloc( 64 ) );
+	}
+}
+
+// ThreadAlloc
+//------------------------------------------------------------------------------
+/*static*/ void * TestMemPoolBlock::ThreadAlloc( uint32_t mode, size_t size )
+{
+	switch ( mode )
+	{
+		case MODE_ALLOC:		return ALLOC( size );
+		case MODE_SMALL_BLOCK:
+		{
+			void * mem = SmallBlockAllocator::Alloc( size, sizeof( void * ) );
+			return mem ? mem : malloc( size ); // region unavailable
+		}
+		default:				return malloc( size );
+	}
+}
+
+// ThreadFree
+//------------------------------------------------------------------------------
+/*static*/ void TestMemPoolBlock::ThreadFree( uint32_t mode, void * mem )
+{
+	switch ( mode )
+	{
+		case MODE_ALLOC:		FREE( mem ); return;
+		case MODE_SMALL_BLOCK:	if ( SmallBlockAllocator::Free( mem ) == false ) { free( mem ); } return;
+		default:				free( mem ); return;
+	}
+}
+
+// ThreadFunc
+//------------------------------------------------------------------------------
+/*static*/ uint32_t TestMemPoolBlock::ThreadFunc( void * userData )
+{
+	ThreadData & data = *( reinterpret_cast< ThreadData * >( userData ) );
+
+	// free blocks from another thread
+	for ( uint32_t i = 0; i < data.m_NumToFree; ++i )
+	{
+		FREE( data.m_ToFree[ i ] );
+	}
+
+	// mix of short and long lived allocations of varying sizes
+	const uint32_t numLive( 512 );
+	void * live[ numLive ];
+	memset( live, 0, sizeof( live ) );
+	uint32_t seed = data.m_Seed;
+	for ( uint32_t i = 0; i < 200 * 1000; ++i )
+	{
+		seed = ( seed * 1103515245 ) + 12345;
+		const uint32_t slot = ( ( seed >> 8 ) % numLive );
+		const size_t size = ( 1 + ( ( seed >> 16 ) % SmallBlockAllocator::MAX_BLOCK_SIZE ) );
+
+		uint32_t * mem = (uint32_t *)live[ slot ];
+		if ( mem )
+		{
+			if ( *mem != slot )
+			{
+				AtomicIncU32( data.m_Errors );
+			}
+			ThreadFree( data.m_Mode, mem );
+		}
+
+		mem = (uint32_t *)ThreadAlloc( data.m_Mode, size );
+		*mem = slot;
+		live[ slot ] = mem;
+	}
+
+	for ( uint32_t i = 0; i < numLive; ++i )
+	{
+		if ( live[ i ] )
+		{
+			ThreadFree( data.m_Mode, live[ i ] );
+		}
+	}
+	return 0;
+}
+
+// RunThreads
+//------------------------------------------------------------------------------
+/*static*/ float TestMemPoolBlock::RunThreads( uint32_t numThreads, AllocMode mode, void ** toFree, uint32_t numToFree, volatile uint32_t & errors )
+{
+	ThreadData data[ 8 ];
+	Thread::ThreadHandle handles[ 8 ];
+	ASSERT( numThreads <= 8 );
+
+	Timer t;
+	for ( uint32_t i = 0; i < numThreads; ++i )
+	{
+		data[ i ].m_ToFree = toFree ? ( toFree + ( i * numToFree ) ) : nullptr;
+		data[ i ].m_NumToFree = numToFree;
+		data[ i ].m_Seed = i;
+		data[ i ].m_Mode = mode;
+		data[ i ].m_Errors = &errors;
+		handles[ i ] = Thread::CreateThread( ThreadFunc, "SmallBlockTest", ( 64 * KILOBYTE ), &data[ i ] );
+	}
+	for ( uint32_t i = 0; i < numThreads; ++i )
+	{
+		bool timedOut = false;
+		Thread::WaitForThread( handles[ i ], 60 * 1000, timedOut );
+		Thread::CloseHandle( handles[ i ] );
+		if ( timedOut )
+		{
+			AtomicIncU32( &errors );
+		}
+	}
+	return t.GetElapsed();
+}
+
 //------------------------------------------------------------------------------
@@ -6,8 +6,11 @@
 #include "TestFramework/UnitTest.h"
 
 // Core
+#include <Core/Process/Atomic.h>
 #include <Core/Process/Thread.h>
 #include <Core/Process/Semaphore.h>
+#include <Core/Time/Timer.h>
+#include <Core/Tracing/Tracing.h>
 
 // TestSemaphore
 //------------------------------------------------------------------------------
@@ -19,9 +22,14 @@ private:
 	void CreateDestroy() const;
 	void WaitForSignal() const;
     void WaitTimeout() const;
+    void SignalMultiple() const;
+    void Speed() const;
 
     // Internal helpers
     static uint32_t WaitForSignal_Thread( void * userData );
+    static uint32_t SignalMultiple_Thread( void * userData );
+    static uint32_t PingPong_Thread( void * userData );
+    static uint32_t Batch_Thread( void * userData );
 };
 
 // Register Tests
@@ -30,8 +38,26 @@ REGISTER_TESTS_BEGIN( TestSemaphore )
 	REGISTER_TEST( CreateDestroy )
 	REGISTER_TEST( WaitForSignal )
     REGISTER_TEST( WaitTimeout )
+    REGISTER_TEST( SignalMultiple )
+    REGISTER_TEST( Speed )
 REGISTER_TESTS_END
 
+// Helpers
+//------------------------------------------------------------------------------
+namespace
+{
+    struct SharedState
+    {
+        SharedState() : m_NumRounds( 0 ), m_NumWoken( 0 ), m_Stop( false ) {}
+
+        Semaphore           m_Request;
+        Semaphore           m_Response;
+        uint32_t            m_NumRounds;
+        volatile uint32_t   m_NumWoken;
+        volatile bool       m_Stop;
+    };
+}
+
 // CreateDestroy
 //------------------------------------------------------------------------------
 void TestSemaphore::CreateDestroy() const
@@ -86,4 +112,151 @@ void TestSemaphore::WaitTimeout() const
     ASSERT( t.GetElapsed() > 0.025f ); // 25ms (allow wide margin of error)
 }
 
+// SignalMultiple
+//------------------------------------------------------------------------------
+void TestSemaphore::SignalMultiple() const
+{
+    const uint32_t numThreads = 4;
+
+    SharedState state;
+    state.m_NumRounds = 1;
+
+    Thread::ThreadHandle handles[ numThreads ];
+    for ( uint32_t i = 0; i < numThreads; ++i )
+    {
+        handles[ i ] = Thread::CreateThread( SignalMultiple_Thread, "Test::SignalMultiple", ( 32 * KILOBYTE ), &state );
+    }
+
+    // wake some of the waiters
+    state.m_Request.Signal( 2 );
+    state.m_Response.Wait();
+    state.m_Response.Wait();
+    TEST_ASSERT( state.m_NumWoken == 2 );
+
+    // and the rest (over-signalling leaves a count for the next Wait)
+    state.m_Request.Signal( 3 );
+    state.m_Response.Wait();
+    state.m_Response.Wait();
+    TEST_ASSERT( state.m_NumWoken == 4 );
+    state.m_Request.Wait( 1000 ); // consumes spare count without waiting
+    TEST_ASSERT( state.m_NumWoken == 4 );
+
+    for ( uint32_t i = 0; i < numThreads; ++i )
+    {
+        bool timedOut;
+        Thread::WaitForThread( handles[ i ], 1000, timedOut );
+        TEST_ASSERT( timedOut == false );
+        Thread::CloseHandle( handles[ i ] );
+    }
+}
+
+// SignalMultiple_Thread
+//------------------------------------------------------------------------------
+/*static*/ uint32_t TestSemaphore::SignalMultiple_Thread( void * userData )
+{
+    SharedState * state = reinterpret_cast< SharedState * >( userData );
+    state->m_Request.Wait();
+    AtomicIncU32( &state->m_NumWoken );
+    state->m_Response.Signal();
+    return 0;
+}
+
+// Speed
+//------------------------------------------------------------------------------
+void TestSemaphore::Speed() const
+{
+    // Latency: a round trip between two threads
+    {
+        SharedState state;
+        state.m_NumRounds = 20000;
+        Thread::ThreadHandle h = Thread::CreateThread( PingPong_Thread, "Test::PingPong", ( 32 * KILOBYTE ), &state );
+
+        Timer t;
+        for ( uint32_t i = 0; i < state.m_NumRounds; ++i )
+        {
+            state.m_Request.Signal();
+            state.m_Response.Wait();
+        }
+        const float time = t.GetElapsed();
+
+        bool timedOut;
+        Thread::WaitForThread( h, 1000, timedOut );
+        TEST_ASSERT( timedOut == false );
+        Thread::CloseHandle( h );
+
+        OUTPUT( "Round trip      : %6.2f us\n", (double)( time * 1000000.0f / (float)state.m_NumRounds ) );
+    }
+
+    // Contention: wake batches of waiters (like FlushJobBatch)
+    const uint32_t threadCounts[] = { 1, 2, 4, 8, 16 };
+    for ( size_t tc = 0; tc < ( sizeof( threadCounts ) / sizeof( uint32_t ) ); ++tc )
+    {
+        const uint32_t numThreads = threadCounts[ tc ];
+
+        SharedState state;
+        state.m_NumRounds = 2000;
+
+        Thread::ThreadHandle handles[ 16 ];
+        for ( uint32_t i = 0; i < numThreads; ++i )
+        {
+            handles[ i ] = Thread::CreateThread( Batch_Thread, "Test::Batch", ( 32 * KILOBYTE ), &state );
+        }
+
+        Timer t;
+        for ( uint32_t i = 0; i < state.m_NumRounds; ++i )
+        {
+            state.m_Request.Signal( numThreads );
+            for ( uint32_t j = 0; j < numThreads; ++j )
+            {
+                state.m_Response.Wait();
+            }
+        }
+        const float time = t.GetElapsed();
+
+        state.m_Stop = true;
+        state.m_Request.Signal( numThreads );
+        for ( uint32_t i = 0; i < numThreads; ++i )
+        {
+            bool timedOut;
+            Thread::WaitForThread( handles[ i ], 1000, timedOut );
+            TEST_ASSERT( timedOut == false );
+            Thread::CloseHandle( handles[ i ] );
+        }
+        TEST_ASSERT( state.m_NumWoken == ( numThreads * state.m_NumRounds ) );
+
+        OUTPUT( "Batch of %2u     : %6.2f us per batch\n", numThreads, (double)( time * 1000000.0f / (float)state.m_NumRounds ) );
+    }
+}
+
+// PingPong_Thread
+//------------------------------------------------------------------------------
+/*static*/ uint32_t TestSemaphore::PingPong_Thread( void * userData )
+{
+    SharedState * state = reinterpret_cast< SharedState * >( userData );
+    for ( uint32_t i = 0; i < state->m_NumRounds; ++i )
+    {
+        state->m_Request.Wait();
+        state->m_Response.Signal();
+    }
+    return 0;
+}
+
+// Batch_Thread
+//------------------------------------------------------------------------------
+/*static*/ uint32_t TestSemaphore::Batch_Thread( void * userData )
+{
+    SharedState * state = reinterpret_cast< SharedState * >( userData );
+    for ( ;; )
+    {
+        state->m_Request.Wait();
+        if ( state->m_Stop )
+        {
+            break;
+        }
+        AtomicIncU32( &state->m_NumWoken );
+        state->m_Response.Signal();
+    }
+    return 0;
+}
+
 //------------------------------------------------------------------------------
@@ -0,0 +1,317 @@
+// TestSort.cpp
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "TestFramework/UnitTest.h"
+
+#include "Core/Containers/Array.h"
+#include "Core/Math/Conversions.h"
+#include "Core/Math/Random.h"
+#include "Core/Strings/AStackString.h"
+#include "Core/Time/Timer.h"
+#include "Core/Tracing/Tracing.h"
+
+// TestSort
+//------------------------------------------------------------------------------
+class TestSort : public UnitTest
+{
+private:
+	DECLARE_TESTS
+
+	void SortEmpty() const;
+	void SortPatterns() const;
+	void SortStrings() const;
+	void SortDeref() const;
+	void SortCustomComparer() const;
+	void MergeSorted() const;
+	void MergeSortedEmpty() const;
+	void TestSpeed() const;
+
+	enum Pattern
+	{
+		RANDOM,
+		SORTED,
+		REVERSED,
+		ALL_EQUAL,
+		FEW_UNIQUE,
+		SAWTOOTH,
+		ORGAN_PIPE,
+		NUM_PATTERNS
+	};
+	static void Generate( Pattern pattern, size_t numItems, Array< uint32_t > & items );
+	static bool IsSorted( const Array< uint32_t > & items );
+};
+
+// Register Tests
+//------------------------------------------------------------------------------
+REGISTER_TESTS_BEGIN( TestSort )
+	REGISTER_TEST( SortEmpty )
+	REGISTER_TEST( SortPatterns )
+	REGISTER_TEST( SortStrings )
+	REGISTER_TEST( SortDeref )
+	REGISTER_TEST( SortCustomComparer )
+	REGISTER_TEST( MergeSorted )
+	REGISTER_TEST( MergeSortedEmpty )
+	REGISTER_TEST( TestSpeed )
+REGISTER_TESTS_END
+
+// SortEmpty
+//------------------------------------------------------------------------------
+void TestSort::SortEmpty() const
+{
+	Array< uint32_t > items( 1, true );
+	items.Sort();
+	TEST_ASSERT( items.IsEmpty() );
+
+	items.Append( 7 );
+	items.Sort();
+	TEST_ASSERT( ( items.GetSize() == 1 ) && ( items[ 0 ] == 7 ) );
+}
+
+// SortPatterns
+//------------------------------------------------------------------------------
+void TestSort::SortPatterns() const
+{
+	// sizes around the insertion sort threshold, and large enough to partition deeply
+	const size_t sizes[] = { 2, 3, 15, 16, 17, 33, 100, 1000, 10 * 1000 };
+	for ( size_t s = 0; s < ( sizeof( sizes ) / sizeof( sizes[ 0 ] ) ); ++s )
+	{
+		for ( uint32_t p = 0; p < NUM_PATTERNS; ++p )
+		{
+			Array< uint32_t > items( sizes[ s ], true );
+			Generate( (Pattern)p, sizes[ s ], items );
+
+			// sum is preserved (nothing lost or duplicated)
+			uint64_t sumBefore = 0;
+			for ( uint32_t item : items ) { sumBefore += item; }
+
+			items.Sort();
+
+			uint64_t sumAfter = 0;
+			for ( uint32_t item : items ) { sumAfter += item; }
+
+			TEST_ASSERT( items.GetSize() == sizes[ s ] );
+			TEST_ASSERT( sumBefore == sumAfter );
+			TEST_ASSERT( IsSorted( items ) );
+		}
+	}
+}
+
+// SortStrings
+//------------------------------------------------------------------------------
+void TestSort::SortStrings() const
+{
+	Array< AString > strings( 100, true );
+	Random r( 1234 );
+	AStackString<> tmp;
+	for ( size_t i = 0; i < 100; ++i )
+	{
+		tmp.Format( "String%u", r.GetRand() % 50 );
+		strings.Append( tmp );
+	}
+
+	strings.Sort();
+
+	for ( size_t i = 1; i < strings.GetSize(); ++i )
+	{
+		TEST_ASSERT( ( strings[ i ] < strings[ i - 1 ] ) == false );
+	}
+}
+
+// SortDeref
+//------------------------------------------------------------------------------
+void TestSort::SortDeref() const
+{
+	Array< uint32_t > values( 1000, false );
+	Generate( RANDOM, 1000, values );
+
+	Array< const uint32_t * > pointers( 1000, false );
+	for ( const uint32_t & value : values )
+	{
+		pointers.Append( &value );
+	}
+
+	pointers.SortDeref();
+
+	for ( size_t i = 1; i < pointers.GetSize(); ++i )
+	{
+		TEST_ASSERT( *pointers[ i - 1 ] <= *pointers[ i ] );
+	}
+}
+
+// SortCustomComparer
+//------------------------------------------------------------------------------
+void TestSort::SortCustomComparer() const
+{
+	class DescendingCompare
+	{
+	public:
+		inline bool operator () ( uint32_t a, uint32_t b ) const { return ( a > b ); }
+	};
+
+	Array< uint32_t > items( 1000, false );
+	Generate( RANDOM, 1000, items );
+
+	items.Sort( DescendingCompare() );
+
+	for ( size_t i = 1; i < items.GetSize(); ++i )
+	{
+		TEST_ASSERT( items[ i - 1 ] >= items[ i ] );
+	}
+}
+
+// MergeSorted
+//------------------------------------------------------------------------------
+void TestSort::MergeSorted() const
+{
+	for ( uint32_t p = 0; p < NUM_PATTERNS; ++p )
+	{
+		Array< uint32_t > items( 1000, true );
+		Generate( (Pattern)p, 1000, items );
+		items.Sort();
+
+		Array< uint32_t > batch( 300, true );
+		Generate( RANDOM, 300, batch );
+		batch.Sort();
+
+		items.MergeSorted( batch );
+
+		TEST_ASSERT( items.GetSize() == 1300 );
+		TEST_ASSERT( IsSorted( items ) );
+	}
+
+	// items already present come before equal merged items
+	struct Item
+	{
+		uint32_t	m_Key;
+		uint32_t	m_Batch;
+		bool operator < ( const Item & other ) const { return ( m_Key < other.m_Key ); }
+	};
+	Array< Item > items( 4, true );
+	Array< Item > batch( 4, true );
+	for ( uint32_t i = 0; i < 4; ++i )
+	{
+		Item a = { i, 0 };
+		items.Append( a );
+		Item b = { i, 1 };
+		batch.Append( b );
+	}
+	items.MergeSorted( batch );
+	TEST_ASSERT( items.GetSize() == 8 );
+	for ( uint32_t i = 0; i < 8; ++i )
+	{
+		TEST_ASSERT( items[ i ].m_Key == ( i / 2 ) );
+		TEST_ASSERT( items[ i ].m_Batch == ( i % 2 ) );
+	}
+}
+
+// MergeSortedEmpty
+//------------------------------------------------------------------------------
+void TestSort::MergeSortedEmpty() const
+{
+	Array< uint32_t > items( 0, true );
+	Array< uint32_t > batch( 0, true );
+
+	// empty into empty
+	items.MergeSorted( batch );
+	TEST_ASSERT( items.IsEmpty() );
+
+	// into empty
+	batch.Append( 1 );
+	batch.Append( 2 );
+	items.MergeSorted( batch );
+	TEST_ASSERT( ( items.GetSize() == 2 ) && ( items[ 0 ] == 1 ) && ( items[ 1 ] == 2 ) );
+
+	// empty into non-empty
+	batch.Clear();
+	items.MergeSorted( batch );
+	TEST_ASSERT( ( items.GetSize() == 2 ) && ( items[ 0 ] == 1 ) && ( items[ 1 ] == 2 ) );
+}
+
+// TestSpeed
+//------------------------------------------------------------------------------
+void TestSort::TestSpeed() const
+{
+	const char * const patternNames[ NUM_PATTERNS ] = { "Random", "Sorted", "Reversed", "AllEqual", "FewUnique", "Sawtooth", "OrganPipe" };
+
+	for ( size_t numItems = 1000; numItems <= 1000 * 1000; numItems *= 10 )
+	{
+		for ( uint32_t p = 0; p < NUM_PATTERNS; ++p )
+		{
+			Array< uint32_t > items( numItems, false );
+			Generate( (Pattern)p, numItems, items );
+
+			Timer t;
+			items.Sort();
+			const float time = t.GetElapsed();
+
+			TEST_ASSERT( IsSorted( items ) );
+			OUTPUT( "Sort        : %-9s %8u items : %2.3fs @ %u items/sec\n", patternNames[ p ], (uint32_t)numItems, time, (uint32_t)( (float)numItems / Math::Max( time, 0.000001f ) ) );
+		}
+
+		// add a sorted batch of 1% to a sorted array, as job queues do
+		{
+			Array< uint32_t > items( numItems, true );
+			Generate( RANDOM, numItems, items );
+			items.Sort();
+			Array< uint32_t > items2( items );
+
+			Array< uint32_t > batch( numItems / 100, false );
+			Generate( RANDOM, numItems / 100, batch );
+			batch.Sort();
+
+			Timer t1;
+			items.MergeSorted( batch );
+			const float mergeTime = t1.GetElapsed();
+
+			Timer t2;
+			items2.Append( batch );
+			items2.Sort();
+			const float resortTime = t2.GetElapsed();
+
+			TEST_ASSERT( IsSorted( items ) );
+			TEST_ASSERT( IsSorted( items2 ) );
+			OUTPUT( "MergeSorted : %-9s %8u items : %2.3fs (Append+Sort: %2.3fs)\n", "Batch", (uint32_t)numItems, mergeTime, resortTime );
+		}
+	}
+}
+
+// Generate
+//------------------------------------------------------------------------------
+/*static*/ void TestSort::Generate( Pattern pattern, size_t numItems, Array< uint32_t > & items )
+{
+	Random r( 5678 );
+	for ( size_t i = 0; i < numItems; ++i )
+	{
+		uint32_t value = 0;
+		switch ( pattern )
+		{
+			case RANDOM:		value = ( r.GetRand() << 15 ) | r.GetRand(); break;
+			case SORTED:		value = (uint32_t)i; break;
+			case REVERSED:		value = (uint32_t)( numItems - i ); break;
+			case ALL_EQUAL:		value = 42; break;
+			case FEW_UNIQUE:	value = r.GetRand() % 4; break;
+			case SAWTOOTH:		value = (uint32_t)( i % 64 ); break;
+			case ORGAN_PIPE:	value = (uint32_t)( ( i < numItems / 2 ) ? i : ( numItems - i ) ); break;
+			case NUM_PATTERNS:	ASSERT( false ); break;
+		}
+		items.Append( value );
+	}
+}
+
+// IsSorted
+//------------------------------------------------------------------------------
+/*static*/ bool TestSort::IsSorted( const Array< uint32_t > & items )
+{
+	for ( size_t i = 1; i < items.GetSize(); ++i )
+	{
+		if ( items[ i ] < items[ i - 1 ] )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,619 @@
+// DirectoryWalker - parallel directory enumeration with exclusions
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/PrecompiledHeader.h"
+
+#include "DirectoryWalker.h"
+
+// Core
+#include "Core/Env/Env.h"
+#include "Core/FileIO/PathUtils.h"
+#include "Core/Math/Conversions.h"
+#include "Core/Mem/Mem.h"
+#include "Core/Process/Atomic.h"
+#include "Core/Strings/AStackString.h"
+
+// system
+#include <string.h>
+#if defined( __WINDOWS__ )
+	#include <windows.h>
+#endif
+#if defined( __LINUX__ ) || defined( __APPLE__ )
+	#include <dirent.h>
+	#include <fcntl.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+#if defined( __LINUX__ )
+	#include <sys/syscall.h>
+#endif
+
+// Helpers
+//------------------------------------------------------------------------------
+namespace
+{
+	#if defined( __LINUX__ )
+		// entries returned by getdents64
+		struct LinuxDirent64
+		{
+			uint64_t		d_ino;
+			int64_t			d_off;
+			unsigned short	d_reclen;
+			unsigned char	d_type;
+			char			d_name[ 1 ];
+		};
+		const size_t DIRENT_BUFFER_SIZE = ( 32 * 1024 );
+	#endif
+
+	// ignore magic '.' and '..' folders
+	inline bool IsDotOrDotDot( const char * name )
+	{
+		// (all names are at least 1 char, so index 0 and 1 are valid to access)
+		return ( ( name[ 0 ] == '.' ) &&
+				 ( ( name[ 1 ] == '\000' ) || ( ( name[ 1 ] == '.' ) && ( name[ 2 ] == '\000' ) ) ) );
+	}
+}
+
+// DirectoryWalker::FileEntry
+//------------------------------------------------------------------------------
+// Files are recorded compactly while listing (names are packed into a single
+// string per directory) and only expanded into FileInfos once sorted.
+struct DirectoryWalker::FileEntry
+{
+	uint32_t	m_NameOffset;
+	uint32_t	m_NameLength;
+	uint32_t	m_Attributes;
+	uint64_t	m_LastWriteTime;
+	uint64_t	m_Size;
+};
+
+// DirectoryWalker::Directory
+//------------------------------------------------------------------------------
+struct DirectoryWalker::Directory
+{
+	Directory() : m_Files( 0, true ), m_SubDirs( 0, true ) {}
+
+	inline bool operator < ( const Directory & other ) const { return ( m_Path < other.m_Path ); }
+
+	AString					m_Path;		// with trailing slash
+	AString					m_Names;	// null separated file names
+	Array< FileEntry >		m_Files;
+	Array< Directory * >	m_SubDirs;
+};
+
+// FileEntryCompare
+//------------------------------------------------------------------------------
+class DirectoryWalker::FileEntryCompare
+{
+public:
+	explicit FileEntryCompare( const char * names ) : m_Names( names ) {}
+
+	inline bool operator () ( const FileEntry & a, const FileEntry & b ) const
+	{
+		return ( strcmp( m_Names + a.m_NameOffset, m_Names + b.m_NameOffset ) < 0 );
+	}
+private:
+	const char * m_Names;
+};
+
+// CONSTRUCTOR
+//------------------------------------------------------------------------------
+DirectoryWalker::DirectoryWalker( const Array< AString > * patterns,
+								  const Array< AString > & excludePaths,
+								  const Array< AString > & excludeFiles )
+	: m_Patterns( ( patterns && !patterns->IsEmpty() ) ? patterns : nullptr )
+	, m_ExcludePaths( excludePaths )
+	, m_PrunePaths( excludePaths.GetSize(), true )
+	, m_ExcludeFileNames( excludeFiles.GetSize(), true )
+	, m_ExcludeFilePaths( 0, true )
+	, m_Recurse( false )
+	, m_MaxThreads( Math::Clamp( Env::GetNumProcessors(), (uint32_t)1, (uint32_t)DEFAULT_MAX_THREADS ) )
+	, m_PendingDirs( 256, true )
+	, m_NumBusy( 0 )
+	, m_NumIdle( 0 )
+	, m_Finished( false )
+	, m_NumThreads( 0 )
+	, m_NumDirectoriesListed( 0 )
+	, m_NumDirectoriesPruned( 0 )
+{
+	// A file exclusion without a path component can only match the whole
+	// name of a file, so it can be checked without building the full path
+	for ( const AString & excludeFile : excludeFiles )
+	{
+		if ( excludeFile.IsEmpty() )
+		{
+			continue; // can never match
+		}
+		if ( excludeFile.Find( NATIVE_SLASH ) )
+		{
+			m_ExcludeFilePaths.Append( excludeFile );
+		}
+		else
+		{
+			m_ExcludeFileNames.Append( excludeFile );
+		}
+	}
+}
+
+// DESTRUCTOR
+//------------------------------------------------------------------------------
+DirectoryWalker::~DirectoryWalker()
+{
+	ASSERT( m_PendingDirs.IsEmpty() );
+}
+
+// GetFiles
+//------------------------------------------------------------------------------
+bool DirectoryWalker::GetFiles( const AString & path, bool recurse, Array< FileIO::FileInfo > & results )
+{
+	m_Recurse = recurse;
+	m_NumBusy = 0;
+	m_NumIdle = 0;
+	m_Finished = false;
+	m_NumThreads = 0;
+	m_NumDirectoriesListed = 0;
+	m_NumDirectoriesPruned = 0;
+
+	Directory * root = FNEW( Directory );
+	root->m_Path = path;
+	PathUtils::EnsureTrailingSlash( root->m_Path );
+
+	// exclusions which are parents of the root exclude everything, exclusions
+	// within the root prune sub-trees and all others are irrelevant
+	m_PrunePaths.Clear();
+	for ( const AString & excludePath : m_ExcludePaths )
+	{
+		ASSERT( excludePath.EndsWith( NATIVE_SLASH ) );
+		if ( PathUtils::PathBeginsWith( root->m_Path, excludePath ) )
+		{
+			FDELETE root;
+			return false;
+		}
+		if ( recurse && PathUtils::PathBeginsWith( excludePath, root->m_Path ) )
+		{
+			m_PrunePaths.Append( excludePath );
+		}
+	}
+
+	// list everything, sharing the work with helper threads if there is enough
+	m_PendingDirs.Append( root );
+	ProcessDirectories();
+
+	// wait for helpers to finish
+	for ( uint32_t i = 0; i < m_NumThreads; ++i )
+	{
+		bool timedOut = true;
+		while ( timedOut )
+		{
+			Thread::WaitForThread( m_Threads[ i ], 1000, timedOut );
+		}
+		Thread::CloseHandle( m_Threads[ i ] );
+	}
+	ASSERT( m_PendingDirs.IsEmpty() && ( m_NumBusy == 0 ) );
+
+	// gather results in a deterministic order
+	const size_t oldSize = results.GetSize();
+	results.SetCapacity( oldSize + CountFiles( root ) );
+	CollectResults( root, results );
+
+	return ( results.GetSize() != oldSize );
+}
+
+// GetNextDirectory
+//------------------------------------------------------------------------------
+bool DirectoryWalker::GetNextDirectory( Directory * & dir )
+{
+	MutexHolder mh( m_Mutex );
+
+	// queue any sub-directories of the directory just listed
+	if ( dir )
+	{
+		m_PendingDirs.Append( dir->m_SubDirs );
+		--m_NumBusy;
+		dir = nullptr;
+
+		// share additional work with idle threads, creating more if needed
+		if ( m_PendingDirs.GetSize() > 1 )
+		{
+			uint32_t numExtra = (uint32_t)( m_PendingDirs.GetSize() - 1 ); // this thread takes one
+			const uint32_t numToWake = Math::Min( numExtra, m_NumIdle );
+			if ( numToWake > 0 )
+			{
+				m_NumIdle -= numToWake;
+				m_WorkAvailable.Signal( numToWake );
+				numExtra -= numToWake;
+			}
+			while ( ( numExtra > 0 ) && ( ( m_NumThreads + 1 ) < m_MaxThreads ) )
+			{
+				m_Threads[ m_NumThreads++ ] = Thread::CreateThread( HelperThreadFunc, "DirectoryWalker", ( 64 * KILOBYTE ), this );
+				--numExtra;
+			}
+		}
+	}
+
+	for ( ;; )
+	{
+		if ( m_Finished )
+		{
+			return false;
+		}
+
+		// take the most recently found directory (depth first)
+		if ( m_PendingDirs.IsEmpty() == false )
+		{
+			dir = m_PendingDirs.Top();
+			m_PendingDirs.Pop();
+			++m_NumBusy;
+			++m_NumDirectoriesListed;
+			return true;
+		}
+
+		// nothing left to list, and no thread which could find more?
+		if ( m_NumBusy == 0 )
+		{
+			m_Finished = true;
+			if ( m_NumIdle > 0 )
+			{
+				m_WorkAvailable.Signal( m_NumIdle );
+				m_NumIdle = 0;
+			}
+			return false;
+		}
+
+		// wait for another thread to find more
+		++m_NumIdle;
+		m_Mutex.Unlock();
+		m_WorkAvailable.Wait();
+		m_Mutex.Lock();
+	}
+}
+
+// ProcessDirectories
+//------------------------------------------------------------------------------
+void DirectoryWalker::ProcessDirectories()
+{
+	#if defined( __LINUX__ )
+		char * buffer = (char *)ALLOC( DIRENT_BUFFER_SIZE );
+	#else
+		char * buffer = nullptr;
+	#endif
+
+	Directory * dir = nullptr;
+	while ( GetNextDirectory( dir ) )
+	{
+		ListDirectory( dir, buffer );
+	}
+
+	FREE( buffer );
+}
+
+// HelperThreadFunc
+//------------------------------------------------------------------------------
+/*static*/ uint32_t DirectoryWalker::HelperThreadFunc( void * userData )
+{
+	reinterpret_cast< DirectoryWalker * >( userData )->ProcessDirectories();
+	return 0;
+}
+
+// ListDirectory
+//------------------------------------------------------------------------------
+void DirectoryWalker::ListDirectory( Directory * dir, char * buffer )
+{
+	#if defined( __WINDOWS__ )
+		(void)buffer;
+
+		// list files and directories in a single pass
+		AStackString<> searchPath( dir->m_Path );
+		searchPath += '*';
+		WIN32_FIND_DATA findData;
+		HANDLE hFind = FindFirstFileEx( searchPath.Get(), FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH );
+		if ( hFind == INVALID_HANDLE_VALUE )
+		{
+			return;
+		}
+
+		do
+		{
+			const char * name = findData.cFileName;
+			if ( IsDotOrDotDot( name ) )
+			{
+				continue;
+			}
+			const size_t nameLen = AString::StrLen( name );
+
+			if ( findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY )
+			{
+				OnSubDirectory( dir, name, nameLen );
+				continue;
+			}
+
+			if ( IsFileWanted( dir, name, nameLen ) )
+			{
+				AddFile( dir, name, nameLen,
+						 findData.dwFileAttributes,
+						 (uint64_t)findData.ftLastWriteTime.dwLowDateTime | ( (uint64_t)findData.ftLastWriteTime.dwHighDateTime << 32 ),
+						 (uint64_t)findData.nFileSizeLow | ( (uint64_t)findData.nFileSizeHigh << 32 ) );
+			}
+		}
+		while ( FindNextFile( hFind, &findData ) != 0 );
+
+		FindClose( hFind );
+
+	#elif defined( __LINUX__ )
+		// read entries in bulk, and stat files relative to the open directory
+		// so each lookup doesn't walk the full path again
+		const int fd = open( dir->m_Path.Get(), O_RDONLY | O_DIRECTORY | O_CLOEXEC );
+		if ( fd < 0 )
+		{
+			return;
+		}
+
+		for ( ;; )
+		{
+			const long numBytes = syscall( SYS_getdents64, fd, buffer, DIRENT_BUFFER_SIZE );
+			if ( numBytes <= 0 )
+			{
+				break; // no more entries (or error)
+			}
+
+			for ( long pos = 0; pos < numBytes; )
+			{
+				const LinuxDirent64 * entry = reinterpret_cast< const LinuxDirent64 * >( buffer + pos );
+				pos += entry->d_reclen;
+
+				const char * name = entry->d_name;
+				if ( IsDotOrDotDot( name ) )
+				{
+					continue;
+				}
+				const size_t nameLen = AString::StrLen( name );
+
+				// some file systems don't provide the type
+				unsigned char type = entry->d_type;
+				if ( type == DT_UNKNOWN )
+				{
+					struct stat info;
+					if ( fstatat( fd, name, &info, AT_SYMLINK_NOFOLLOW ) != 0 )
+					{
+						continue;
+					}
+					type = S_ISDIR( info.st_mode ) ? DT_DIR : DT_REG;
+				}
+
+				if ( type == DT_DIR )
+				{
+					OnSubDirectory( dir, name, nameLen );
+					continue;
+				}
+
+				if ( IsFileWanted( dir, name, nameLen ) == false )
+				{
+					continue;
+				}
+
+				// get additional info (following symlinks)
+				struct stat info;
+				if ( fstatat( fd, name, &info, 0 ) != 0 )
+				{
+					continue; // deleted while listing, or a broken link
+				}
+				AddFile( dir, name, nameLen,
+						 info.st_mode,
+						 ( ( (uint64_t)info.st_mtim.tv_sec * 1000000000ULL ) + (uint64_t)info.st_mtim.tv_nsec ),
+						 (uint64_t)info.st_size );
+			}
+		}
+
+		close( fd );
+
+	#elif defined( __APPLE__ )
+		(void)buffer;
+
+		DIR * d = opendir( dir->m_Path.Get() );
+		if ( d == nullptr )
+		{
+			return;
+		}
+		const int fd = dirfd( d );
+
+		for ( ;; )
+		{
+			dirent * entry = readdir( d );
+			if ( entry == nullptr )
+			{
+				break; // no more entries
+			}
+
+			const char * name = entry->d_name;
+			if ( IsDotOrDotDot( name ) )
+			{
+				continue;
+			}
+			const size_t nameLen = AString::StrLen( name );
+
+			if ( entry->d_type == DT_DIR )
+			{
+				OnSubDirectory( dir, name, nameLen );
+				continue;
+			}
+
+			if ( IsFileWanted( dir, name, nameLen ) == false )
+			{
+				continue;
+			}
+
+			struct stat info;
+			if ( fstatat( fd, name, &info, 0 ) != 0 )
+			{
+				continue; // deleted while listing, or a broken link
+			}
+			AddFile( dir, name, nameLen,
+					 info.st_mode,
+					 ( ( (uint64_t)info.st_mtimespec.tv_sec * 1000000000ULL ) + (uint64_t)info.st_mtimespec.tv_nsec ),
+					 (uint64_t)info.st_size );
+		}
+
+		closedir( d );
+	#else
+		#error Unknown platform
+	#endif
+}
+
+// OnSubDirectory
+//------------------------------------------------------------------------------
+void DirectoryWalker::OnSubDirectory( Directory * dir, const char * name, size_t nameLen )
+{
+	if ( m_Recurse == false )
+	{
+		return;
+	}
+
+	Directory * subDir = FNEW( Directory );
+	subDir->m_Path.SetReserved( dir->m_Path.GetLength() + nameLen + 1 );
+	subDir->m_Path = dir->m_Path;
+	subDir->m_Path.Append( name, nameLen );
+	subDir->m_Path += NATIVE_SLASH;
+
+	// prune excluded sub-trees without opening them
+	if ( IsPathExcluded( subDir->m_Path ) )
+	{
+		FDELETE subDir;
+		AtomicIncU32( &m_NumDirectoriesPruned );
+		return;
+	}
+
+	dir->m_SubDirs.Append( subDir );
+}
+
+// AddFile
+//------------------------------------------------------------------------------
+/*static*/ void DirectoryWalker::AddFile( Directory * dir, const char * name, size_t nameLen,
+										  uint32_t attributes, uint64_t lastWriteTime, uint64_t size )
+{
+	FileEntry entry;
+	entry.m_NameOffset = dir->m_Names.GetLength();
+	entry.m_NameLength = (uint32_t)nameLen;
+	entry.m_Attributes = attributes;
+	entry.m_LastWriteTime = lastWriteTime;
+	entry.m_Size = size;
+	dir->m_Files.Append( entry );
+
+	dir->m_Names.Append( name, nameLen + 1 ); // include terminator as separator
+}
+
+// IsFileWanted
+//------------------------------------------------------------------------------
+bool DirectoryWalker::IsFileWanted( const Directory * dir, const char * name, size_t nameLen ) const
+{
+	// excluded by name?
+	for ( const AString & excludeName : m_ExcludeFileNames )
+	{
+		if ( ( excludeName.GetLength() == nameLen ) && NamesEqual( excludeName.Get(), name, nameLen ) )
+		{
+			return false;
+		}
+	}
+
+	// excluded by partial path?
+	if ( m_ExcludeFilePaths.IsEmpty() == false )
+	{
+		AStackString<> fullPath( dir->m_Path );
+		fullPath.Append( name, nameLen );
+		for ( const AString & excludePath : m_ExcludeFilePaths )
+		{
+			if ( PathUtils::PathEndsWithFile( fullPath, excludePath ) )
+			{
+				return false;
+			}
+		}
+	}
+
+	// no patterns means match all files (equivalent to *)
+	if ( m_Patterns == nullptr )
+	{
+		return true;
+	}
+	for ( const AString & pattern : *m_Patterns )
+	{
+		// Let PathUtils manage platform specific case-sensitivity etc
+		if ( PathUtils::IsWildcardMatch( pattern.Get(), name ) )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// IsPathExcluded
+//------------------------------------------------------------------------------
+bool DirectoryWalker::IsPathExcluded( const AString & dirPath ) const
+{
+	// prune paths are within the root, so any which applies to a sub-tree
+	// matches the root of that sub-tree exactly
+	for ( const AString & prunePath : m_PrunePaths )
+	{
+		if ( ( prunePath.GetLength() == dirPath.GetLength() ) && NamesEqual( prunePath.Get(), dirPath.Get(), dirPath.GetLength() ) )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// CountFiles
+//------------------------------------------------------------------------------
+/*static*/ size_t DirectoryWalker::CountFiles( const Directory * dir )
+{
+	size_t count = dir->m_Files.GetSize();
+	for ( const Directory * subDir : dir->m_SubDirs )
+	{
+		count += CountFiles( subDir );
+	}
+	return count;
+}
+
+// CollectResults
+//------------------------------------------------------------------------------
+/*static*/ void DirectoryWalker::CollectResults( Directory * dir, Array< FileIO::FileInfo > & results )
+{
+	// files in this directory, sorted by name
+	const char * names = dir->m_Names.Get();
+	dir->m_Files.Sort( FileEntryCompare( names ) );
+	for ( const FileEntry & entry : dir->m_Files )
+	{
+		results.SetSize( results.GetSize() + 1 );
+		FileIO::FileInfo & info = results.Top();
+		info.m_Name.SetReserved( dir->m_Path.GetLength() + entry.m_NameLength );
+		info.m_Name = dir->m_Path;
+		info.m_Name.Append( names + entry.m_NameOffset, entry.m_NameLength );
+		info.m_Attributes = entry.m_Attributes;
+		info.m_LastWriteTime = entry.m_LastWriteTime;
+		info.m_Size = entry.m_Size;
+	}
+
+	// followed by each sub-directory, sorted by name
+	dir->m_SubDirs.SortDeref();
+	for ( Directory * subDir : dir->m_SubDirs )
+	{
+		CollectResults( subDir, results );
+	}
+
+	FDELETE dir;
+}
+
+// NamesEqual
+//------------------------------------------------------------------------------
+/*static*/ bool DirectoryWalker::NamesEqual( const char * a, const char * b, size_t len )
+{
+	#if defined( __LINUX__ )
+		// Linux : Case sensitive
+		return ( memcmp( a, b, len ) == 0 );
+	#else
+		// Windows & OSX : Case insensitive
+		return ( AString::MemCmpI( a, b, len ) == 0 );
+	#endif
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,97 @@
+// DirectoryWalker - parallel directory enumeration with exclusions
+//------------------------------------------------------------------------------
+#pragma once
+#ifndef CORE_FILEIO_DIRECTORYWALKER_H
+#define CORE_FILEIO_DIRECTORYWALKER_H
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/Containers/Array.h"
+#include "Core/FileIO/FileIO.h"
+#include "Core/Process/Mutex.h"
+#include "Core/Process/Semaphore.h"
+#include "Core/Process/Thread.h"
+#include "Core/Strings/AString.h"
+
+// DirectoryWalker
+//------------------------------------------------------------------------------
+// Each directory is listed as an independent task, and tasks are shared
+// between the calling thread and helper threads (created only when there is
+// more than one directory waiting to be listed).
+//
+// Excluded paths prune whole sub-trees before they are opened, and files are
+// filtered by name before their attributes are retrieved.
+//
+// Results are ordered deterministically: the files in each directory (sorted
+// by name) followed by the contents of each sub-directory (sorted by name).
+class DirectoryWalker
+{
+public:
+	explicit DirectoryWalker( const Array< AString > * patterns,
+							  const Array< AString > & excludePaths,	// must have trailing slashes
+							  const Array< AString > & excludeFiles );	// file names or partial paths
+	~DirectoryWalker();
+
+	// maximum number of threads to use (including the calling thread)
+	inline void SetMaxThreads( uint32_t maxThreads ) { ASSERT( ( maxThreads > 0 ) && ( maxThreads <= ( MAX_HELPER_THREADS + 1 ) ) ); m_MaxThreads = maxThreads; }
+
+	bool GetFiles( const AString & path, bool recurse, Array< FileIO::FileInfo > & results );
+
+	// stats from last call to GetFiles
+	inline uint32_t GetNumDirectoriesListed() const	{ return m_NumDirectoriesListed; }
+	inline uint32_t GetNumDirectoriesPruned() const	{ return m_NumDirectoriesPruned; }
+	inline uint32_t GetNumThreadsUsed() const		{ return ( m_NumThreads + 1 ); }
+
+	enum : uint32_t { DEFAULT_MAX_THREADS = 8 };
+	enum : uint32_t { MAX_HELPER_THREADS = 15 };
+
+private:
+	struct FileEntry;
+	struct Directory;
+	class FileEntryCompare;
+
+	// task management
+	bool		GetNextDirectory( Directory * & dir );
+	void		ProcessDirectories();
+	static uint32_t HelperThreadFunc( void * userData );
+
+	// listing
+	void		ListDirectory( Directory * dir, char * buffer );
+	void		OnSubDirectory( Directory * dir, const char * name, size_t nameLen );
+	static void	AddFile( Directory * dir, const char * name, size_t nameLen,
+						 uint32_t attributes, uint64_t lastWriteTime, uint64_t size );
+	bool		IsFileWanted( const Directory * dir, const char * name, size_t nameLen ) const;
+	bool		IsPathExcluded( const AString & dirPath ) const;
+
+	// results
+	static size_t CountFiles( const Directory * dir );
+	static void CollectResults( Directory * dir, Array< FileIO::FileInfo > & results );
+
+	// precompiled matching
+	static bool	NamesEqual( const char * a, const char * b, size_t len );
+
+	const Array< AString > *	m_Patterns;
+	Array< AString >			m_ExcludePaths;		// all exclusions
+	Array< AString >			m_PrunePaths;		// exclusions within the current root
+	Array< AString >			m_ExcludeFileNames;	// exclusions with no path component (matched against the name only)
+	Array< AString >			m_ExcludeFilePaths;	// exclusions with a partial path (matched against the full path)
+	bool						m_Recurse;
+	uint32_t					m_MaxThreads;
+
+	// shared task state
+	Mutex						m_Mutex;
+	Semaphore					m_WorkAvailable;
+	Array< Directory * >		m_PendingDirs;
+	uint32_t					m_NumBusy;			// threads listing a directory
+	uint32_t					m_NumIdle;			// threads waiting for work
+	bool						m_Finished;
+	uint32_t					m_NumThreads;		// helper threads created
+	Thread::ThreadHandle		m_Threads[ MAX_HELPER_THREADS ];
+
+	// stats
+	uint32_t					m_NumDirectoriesListed;
+	volatile uint32_t			m_NumDirectoriesPruned;
+};
+
+//------------------------------------------------------------------------------
+#endif // CORE_FILEIO_DIRECTORYWALKER_H
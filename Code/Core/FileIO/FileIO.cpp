@@ -6,6 +6,7 @@
 #include "Core/PrecompiledHeader.h"
 
 #include "FileIO.h"
+#include "DirectoryWalker.h"
 #include "FileStream.h"
 
 // Core
@@ -29,7 +30,12 @@
 #endif
 #if defined( __LINUX__ )
     #include <fcntl.h>
+    #include <sys/ioctl.h>
     #include <sys/sendfile.h>
+    #include <sys/syscall.h>
+    #ifndef FICLONE
+        #define FICLONE _IOW( 0x94, 9, int ) // from linux/fs.h (Linux 4.5)
+    #endif
 #endif
 #if defined( __APPLE__ )
     #include <copyfile.h>
@@ -115,7 +121,31 @@
 /*static*/ bool FileIO::FileCopy( const char * srcFileName, const char * dstFileName,
 							  bool allowOverwrite )
 {
+	return FileCopy( srcFileName, dstFileName, allowOverwrite, COPY_METHOD_CLONE );
+}
+
+// Copy
+//------------------------------------------------------------------------------
+/*static*/ bool FileIO::FileCopy( const char * srcFileName, const char * dstFileName,
+							  bool allowOverwrite, CopyMethod fastestMethod, CopyMethod * methodUsed )
+{
+#if defined( __WINDOWS__ ) || defined( __APPLE__ )
+	// the OS chooses how to copy (and may clone when the file system supports it)
+	(void)fastestMethod;
+	if ( methodUsed )
+	{
+		*methodUsed = COPY_METHOD_STREAM;
+	}
+#endif
+
 #if defined( __WINDOWS__ )
+	// replace (rather than write through) an existing file, which may be a hard link
+	// to the source (writing to it would truncate the source)
+	if ( allowOverwrite )
+	{
+		DeleteFile( dstFileName ); // failure (if read-only) is handled below
+	}
+
 	BOOL failIfDestExists = ( allowOverwrite ? FALSE : TRUE );
 	BOOL result = CopyFile( srcFileName, dstFileName, failIfDestExists );
 	if ( result == FALSE )
@@ -157,6 +187,13 @@
             return false;
         }
     }
+
+    // replace (rather than write through) an existing file (see above)
+    if ( ( unlink( dstFileName ) != 0 ) && ( errno != ENOENT ) )
+    {
+        return false;
+    }
+
     copyfile_state_t s;
     s = copyfile_state_alloc();
     bool result = ( copyfile( srcFileName, dstFileName, s, COPYFILE_DATA | COPYFILE_XATTR ) == 0 );
@@ -176,6 +213,13 @@
     {
         return false;
     }
+
+    // replace (rather than write through) an existing file (see above)
+    if ( ( unlink( dstFileName ) != 0 ) && ( errno != ENOENT ) )
+    {
+        close( source );
+        return false;
+    }
     
     int dest = open( dstFileName, O_WRONLY | O_CREAT | O_TRUNC, 0644 ); // TODO:LINUX Check args for FileCopy dst
     if ( dest < 0 )
@@ -187,17 +231,109 @@
     struct stat stat_source;
     VERIFY( fstat( source, &stat_source ) == 0 );
 
-    ssize_t bytesCopied = sendfile( dest, source, 0, stat_source.st_size );
+    CopyMethod method( COPY_METHOD_STREAM );
+    const bool result = CopyFileData( source, dest, (uint64_t)stat_source.st_size, fastestMethod, method );
     
     close(source);
     close(dest);
 
-    return ( bytesCopied == stat_source.st_size );
+    if ( methodUsed )
+    {
+        *methodUsed = method;
+    }
+    return result;
 #else
     #error Unknown platform
 #endif
 }
 
+// FileHardLink
+//------------------------------------------------------------------------------
+/*static*/ bool FileIO::FileHardLink( const char * srcFileName, const char * dstFileName )
+{
+	// replace any existing file
+	if ( FileExists( dstFileName ) )
+	{
+		SetReadOnly( dstFileName, false );
+		if ( FileDelete( dstFileName ) == false )
+		{
+			return false;
+		}
+	}
+
+#if defined( __WINDOWS__ )
+	return ( TRUE == ::CreateHardLink( dstFileName, srcFileName, nullptr ) );
+#elif defined( __LINUX__ ) || defined( __APPLE__ )
+	return ( link( srcFileName, dstFileName ) == 0 );
+#else
+    #error Unknown platform
+#endif
+}
+
+#if defined( __LINUX__ )
+// CopyFileData
+//------------------------------------------------------------------------------
+/*static*/ bool FileIO::CopyFileData( int source, int dest, uint64_t size, CopyMethod fastestMethod, CopyMethod & methodUsed )
+{
+	// share the source's data (btrfs, xfs etc)
+	if ( fastestMethod <= COPY_METHOD_CLONE )
+	{
+		if ( ioctl( dest, FICLONE, source ) == 0 )
+		{
+			methodUsed = COPY_METHOD_CLONE;
+			return true;
+		}
+	}
+
+	uint64_t bytesCopied = 0;
+
+	// copy in the kernel (the file system can offload or optimize this)
+	#if defined( __NR_copy_file_range )
+		if ( fastestMethod <= COPY_METHOD_IN_KERNEL )
+		{
+			loff_t srcOffset = 0;
+			loff_t dstOffset = 0;
+			while ( bytesCopied < size )
+			{
+				const ssize_t copied = syscall( __NR_copy_file_range, source, &srcOffset, dest, &dstOffset, (size_t)( size - bytesCopied ), 0u );
+				if ( copied <= 0 )
+				{
+					break; // unsupported (old kernel, cross-device etc) - handled below
+				}
+				bytesCopied += (uint64_t)copied;
+			}
+			if ( bytesCopied == size )
+			{
+				methodUsed = COPY_METHOD_IN_KERNEL;
+				return true;
+			}
+
+			// explicit offsets don't move the file position
+			if ( lseek( dest, (off_t)bytesCopied, SEEK_SET ) != (off_t)bytesCopied )
+			{
+				return false;
+			}
+		}
+	#endif
+
+	// copy the remainder (sendfile transfers at most ~2GiB per call)
+	off_t srcOffset = (off_t)bytesCopied;
+	while ( bytesCopied < size )
+	{
+		const uint64_t remaining = ( size - bytesCopied );
+		const size_t chunkSize = (size_t)( ( remaining < SENDFILE_CHUNK_SIZE ) ? remaining : SENDFILE_CHUNK_SIZE );
+		const ssize_t copied = sendfile( dest, source, &srcOffset, chunkSize );
+		if ( copied <= 0 )
+		{
+			return false;
+		}
+		bytesCopied += (uint64_t)copied;
+	}
+	methodUsed = COPY_METHOD_STREAM;
+	return true;
+}
+#endif
+
 // FileMove
 //------------------------------------------------------------------------------
 /*static*/ bool FileIO::FileMove( const AString & srcFileName, const AString & dstFileName )
@@ -245,20 +381,9 @@
 {
 	ASSERT( results );
 
-	size_t oldSize = results->GetSize();
-	if ( recurse )
-	{
-		// make a copy of the path as it will be modified during recursion
-		AStackString< 256 > pathCopy( path );
-		PathUtils::EnsureTrailingSlash( pathCopy );
-		GetFilesRecurseEx( pathCopy, patterns, results );
-	}
-	else
-	{
-		GetFilesNoRecurseEx( path.Get(), patterns, results );
-	}
-
-	return ( results->GetSize() != oldSize );
+	const Array< AString > noExclusions;
+	DirectoryWalker walker( patterns, noExclusions, noExclusions );
+	return walker.GetFiles( path, recurse, *results );
 }
 
 // GetFileInfo
@@ -888,251 +1013,6 @@
 }
 
 
-// GetFilesRecurse
-//------------------------------------------------------------------------------
-/*static*/ void FileIO::GetFilesRecurseEx( AString & pathCopy, 
-										 const Array< AString > * patterns,
-										 Array< FileInfo > * results )
-{
-    const uint32_t baseLength = pathCopy.GetLength();
-    
-    #if defined( __WINDOWS__ )
-        pathCopy += '*'; // don't want to use wildcard to filter folders
-
-        // recurse into directories
-        WIN32_FIND_DATA findData;
-        HANDLE hFind = FindFirstFileEx( pathCopy.Get(), FindExInfoBasic, &findData, FindExSearchLimitToDirectories, nullptr, 0 );
-        if ( hFind == INVALID_HANDLE_VALUE)
-        {
-            return;
-        }
-
-        do
-        {
-            if ( findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY )
-            {
-                // ignore magic '.' and '..' folders
-                // (don't need to check length of name, as all names are at least 1 char
-                // which means index 0 and 1 are valid to access)
-                if ( findData.cFileName[ 0 ] == '.' &&
-                    ( ( findData.cFileName[ 1 ] == '.' ) || ( findData.cFileName[ 1 ] == '\000' ) ) )
-                {
-                    continue;
-                }
-
-                pathCopy.SetLength( baseLength );
-                pathCopy += findData.cFileName;
-                pathCopy += NATIVE_SLASH;
-                GetFilesRecurseEx( pathCopy, patterns, results );
-            }
-        }
-        while ( FindNextFile( hFind, &findData ) != 0 );
-        FindClose( hFind );
-
-        // do files in this directory
-        pathCopy.SetLength( baseLength );
-        pathCopy += '*';
-        hFind = FindFirstFileEx( pathCopy.Get(), FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, 0 );
-        if ( hFind == INVALID_HANDLE_VALUE)
-        {
-            return;
-        }
-
-        do
-        {
-            if ( findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY )
-            {
-                continue;
-            }
-
-			if ( IsMatch( patterns, findData.cFileName ) )
-			{
-				pathCopy.SetLength( baseLength );
-				pathCopy += findData.cFileName;
-				if ( results->GetSize() == results->GetCapacity() )
-				{
-					results->SetCapacity( results->GetSize() * 2 );
-				}
-				results->SetSize( results->GetSize() + 1 );
-				FileInfo & newInfo = results->Top();
-				newInfo.m_Name = pathCopy;
-				newInfo.m_Attributes = findData.dwFileAttributes;
-				newInfo.m_LastWriteTime = (uint64_t)findData.ftLastWriteTime.dwLowDateTime | ( (uint64_t)findData.ftLastWriteTime.dwHighDateTime << 32 );
-				newInfo.m_Size = (uint64_t)findData.nFileSizeLow | ( (uint64_t)findData.nFileSizeHigh << 32 );
-			}
-        }
-        while ( FindNextFile( hFind, &findData ) != 0 );
-
-        FindClose( hFind );
-        
-	#elif defined( __LINUX__ ) || defined( __APPLE__ )
-        DIR * dir = opendir( pathCopy.Get() );
-        if ( dir == nullptr )
-        {
-            return;
-        }
-        for ( ;; )
-        {
-            dirent * entry = readdir( dir );
-            if ( entry == nullptr )
-            {
-                break; // no more entries
-            }
-            
-            // dir?
-            if ( ( entry->d_type & DT_DIR ) == DT_DIR )
-            {
-                // ignore . and ..
-                if ( entry->d_name[ 0 ] == '.' )
-                {
-                    if ( ( entry->d_name[ 1 ] == 0 ) ||
-                         ( ( entry->d_name[ 1 ] == '.' ) && ( entry->d_name[ 2 ] == 0 ) ) )
-                    {
-                        continue;
-                    }
-                }
-
-                // regular dir
-                pathCopy.SetLength( baseLength );
-                pathCopy += entry->d_name;
-                pathCopy += NATIVE_SLASH;
-                GetFilesRecurseEx( pathCopy, patterns, results ); 
-                continue;
-            }
-            
-            // file - does it match wildcard?
-			if ( IsMatch( patterns, entry->d_name ) )
-            {
-                pathCopy.SetLength( baseLength );
-                pathCopy += entry->d_name;
-                
-				if ( results->GetSize() == results->GetCapacity() )
-				{
-					results->SetCapacity( results->GetSize() * 2 );
-				}
-                results->SetSize( results->GetSize() + 1 );
-                FileInfo & newInfo = results->Top();
-                newInfo.m_Name = pathCopy;
-                
-                // get additional info
-                struct stat info;
-                VERIFY( stat( pathCopy.Get(), &info ) == 0 );
-                newInfo.m_Attributes = info.st_mode;
-				#if defined( __APPLE__ )
-					newInfo.m_LastWriteTime = ( ( (uint64_t)info.st_mtimespec.tv_sec * 1000000000ULL ) + (uint64_t)info.st_mtimespec.tv_nsec );
-				#else
-	                newInfo.m_LastWriteTime = ( ( (uint64_t)info.st_mtim.tv_sec * 1000000000ULL ) + (uint64_t)info.st_mtim.tv_nsec );
-				#endif
-                newInfo.m_Size = info.st_size;
-            }            
-        }
-        closedir( dir );        
-    #else
-        #error Unknown platform
-    #endif
-}
-
-// GetFilesNoRecurseEx
-//------------------------------------------------------------------------------
-/*static*/ void FileIO::GetFilesNoRecurseEx( const char * path, 
-											 const Array< AString > * patterns,
-										   Array< FileInfo > * results )
-{
-    AStackString< 256 > pathCopy( path );
-    PathUtils::EnsureTrailingSlash( pathCopy );
-    const uint32_t baseLength = pathCopy.GetLength();
-        
-    #if defined( __WINDOWS__ )
-        pathCopy += '*';
-
-        WIN32_FIND_DATA findData;
-        HANDLE hFind = FindFirstFileEx( pathCopy.Get(), FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, 0 );
-        if ( hFind == INVALID_HANDLE_VALUE)
-        {
-            return;
-        }
-
-        do
-        {
-            if ( findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY )
-            {
-                continue;
-            }
-
-			if ( IsMatch( patterns, findData.cFileName ) )
-			{
-				pathCopy.SetLength( baseLength );
-				pathCopy += findData.cFileName;
-
-				if ( results->GetSize() == results->GetCapacity() )
-				{
-					results->SetCapacity( results->GetSize() * 2 );
-				}
-				results->SetSize( results->GetSize() + 1 );
-				FileInfo & newInfo = results->Top();
-				newInfo.m_Name = pathCopy;
-				newInfo.m_Attributes = findData.dwFileAttributes;
-				newInfo.m_LastWriteTime = (uint64_t)findData.ftLastWriteTime.dwLowDateTime | ( (uint64_t)findData.ftLastWriteTime.dwHighDateTime << 32 );
-				newInfo.m_Size = (uint64_t)findData.nFileSizeLow | ( (uint64_t)findData.nFileSizeHigh << 32 );
-			}
-        }
-        while ( FindNextFile( hFind, &findData ) != 0 );
-
-        FindClose( hFind );
-    
-	#elif defined( __LINUX__ ) || defined( __APPLE__ )
-        DIR * dir = opendir( pathCopy.Get() );
-        if ( dir == nullptr )
-        {
-            return;
-        }
-        for ( ;; )
-        {
-            dirent * entry = readdir( dir );
-            if ( entry == nullptr )
-            {
-                break; // no more entries
-            }
-            
-            // dir?
-            if ( ( entry->d_type & DT_DIR ) == DT_DIR )
-            {
-                // ingnore dirs
-                continue;
-            }
-            
-            // file - does it match wildcard?
-			if ( IsMatch( patterns, entry->d_name ) )
-            {
-                pathCopy.SetLength( baseLength );
-                pathCopy += entry->d_name;
-                
-				if ( results->GetSize() == results->GetCapacity() )
-				{
-					results->SetCapacity( results->GetSize() * 2 );
-				}
-                results->SetSize( results->GetSize() + 1 );
-                FileInfo & newInfo = results->Top();
-                newInfo.m_Name = pathCopy;
-                
-                // get additional info
-                struct stat info;
-                VERIFY( stat( pathCopy.Get(), &info ) == 0 );
-                newInfo.m_Attributes = info.st_mode;
-				#if defined( __APPLE__ )
-                    newInfo.m_LastWriteTime = ( ( (uint64_t)info.st_mtimespec.tv_sec * 1000000000ULL ) + (uint64_t)info.st_mtimespec.tv_nsec );
-				#else
-	                newInfo.m_LastWriteTime = ( ( (uint64_t)info.st_mtim.tv_sec * 1000000000ULL ) + (uint64_t)info.st_mtim.tv_nsec );
-				#endif
-                newInfo.m_Size = info.st_size;
-            }            
-        }
-        closedir( dir );
-    #else
-        #error Unknown platform
-    #endif
-}
-
 // WorkAroundForWindowsFilePermissionProblem
 //------------------------------------------------------------------------------
 #if defined( __WINDOWS__ )
@@ -1178,27 +1058,4 @@ bool FileIO::FileInfo::IsReadOnly() const
 	#endif
 }
 
-// IsMatch
-//------------------------------------------------------------------------------
-/*static*/ bool FileIO::IsMatch( const Array< AString > * patterns, const char * fileName )
-{
-	// no wildcards means match all files (equivalent to *)
-	if ( ( patterns == nullptr ) || ( patterns->IsEmpty() ) )
-	{
-		return true;
-	}
-
-	// Check each provided pattern
-	for ( const AString & pattern : *patterns )
-	{
-		// Let PathUtils manage platform specific case-sensitivity etc
-		if ( PathUtils::IsWildcardMatch( pattern.Get(), fileName ) )
-		{
-			return true;
-		}
-	}
-
-	return false;
-}
-
 //------------------------------------------------------------------------------
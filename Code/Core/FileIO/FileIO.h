@@ -18,9 +18,20 @@
 class FileIO
 {
 public:
+	// methods used to copy file contents, fastest first
+	enum CopyMethod : uint32_t
+	{
+		COPY_METHOD_CLONE		= 0,	// share data with the source until modified ("reflink")
+		COPY_METHOD_IN_KERNEL	= 1,	// copy without passing through user space
+		COPY_METHOD_STREAM		= 2,	// read and write
+	};
+
 	static bool FileExists( const char * fileName );
 	static bool FileDelete( const char * fileName );
 	static bool FileCopy( const char * srcFileName, const char * dstFileName, bool allowOverwrite = true );
+	static bool FileCopy( const char * srcFileName, const char * dstFileName, bool allowOverwrite,
+						  CopyMethod fastestMethod, CopyMethod * methodUsed = nullptr ); // tries fastestMethod and slower
+	static bool FileHardLink( const char * srcFileName, const char * dstFileName ); // replaces dstFileName
 	static bool FileMove( const AString & srcFileName, const AString & dstFileName );
 	static bool DirectoryDelete( const AString & path );
 
@@ -68,19 +79,16 @@ public:
     #endif
 
 private:
+	#if defined( __LINUX__ )
+		static bool CopyFileData( int source, int dest, uint64_t size, CopyMethod fastestMethod, CopyMethod & methodUsed );
+		enum : uint32_t { SENDFILE_CHUNK_SIZE = ( 1024 * 1024 * 1024 ) };
+	#endif
 	static void GetFilesRecurse( AString & path, 
 								 const AString & wildCard,
 								 Array< AString > * results );
 	static void GetFilesNoRecurse( const char * path, 
 								   const char * wildCard,
 								   Array< AString > * results );
-	static void GetFilesRecurseEx( AString & path, 
-								 const Array< AString > * patterns,
-								 Array< FileInfo > * results );
-	static void GetFilesNoRecurseEx( const char * path, 
-								 const Array< AString > * patterns,
-								 Array< FileInfo > * results );
-	static bool IsMatch( const Array< AString > * patterns, const char * fileName );
 
 };
 
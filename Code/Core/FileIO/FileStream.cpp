@@ -9,6 +9,7 @@
 
 // Core
 #include "Core/Env/Assert.h"
+#include "Core/Mem/Mem.h"
 #include "Core/Strings/AString.h"
 #include "Core/Strings/AStackString.h"
 
@@ -17,6 +18,10 @@
 #if defined( __WINDOWS__ )
     #include <windows.h>
 #endif
+#if defined( __LINUX__ )
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
 
 // Defines
 //------------------------------------------------------------------------------
@@ -278,6 +283,59 @@ bool FileStream::IsOpen() const
 #endif
 }
 
+// WriteFromFile
+//------------------------------------------------------------------------------
+uint64_t FileStream::WriteFromFile( FileStream & source, uint64_t sourcePos, uint64_t bytesToCopy )
+{
+	ASSERT( IsOpen() );
+	ASSERT( source.IsOpen() );
+
+	uint64_t totalBytesCopied = 0;
+
+	#if defined( __LINUX__ ) && defined( __NR_copy_file_range )
+		// copy_file_range uses explicit offsets, so the stdio buffers
+		// are flushed first and re-synced after
+		Flush();
+		const int srcFD = fileno( (FILE *)source.m_Handle );
+		const int dstFD = fileno( (FILE *)m_Handle );
+		loff_t srcOffset = (loff_t)sourcePos;
+		loff_t dstOffset = (loff_t)Tell();
+		while ( totalBytesCopied < bytesToCopy )
+		{
+			const ssize_t copied = syscall( __NR_copy_file_range, srcFD, &srcOffset, dstFD, &dstOffset, (size_t)( bytesToCopy - totalBytesCopied ), 0u );
+			if ( copied <= 0 )
+			{
+				break; // unsupported (old kernel, cross-device etc) - handled below
+			}
+			totalBytesCopied += (uint64_t)copied;
+		}
+		VERIFY( Seek( (uint64_t)dstOffset ) );
+		if ( totalBytesCopied == bytesToCopy )
+		{
+			return totalBytesCopied;
+		}
+	#endif
+
+	// copy any remainder via an intermediate buffer
+	const uint64_t bufferSize = ( 256 * 1024 );
+	char * buffer = (char *)ALLOC( (size_t)bufferSize );
+	VERIFY( source.Seek( sourcePos + totalBytesCopied ) );
+	while ( totalBytesCopied < bytesToCopy )
+	{
+		const uint64_t remaining = ( bytesToCopy - totalBytesCopied );
+		const uint64_t chunkSize = ( remaining < bufferSize ) ? remaining : bufferSize;
+		if ( ( source.ReadBuffer( buffer, chunkSize ) != chunkSize ) ||
+			 ( WriteBuffer( buffer, chunkSize ) != chunkSize ) )
+		{
+			break;
+		}
+		totalBytesCopied += chunkSize;
+	}
+	FREE( buffer );
+
+	return totalBytesCopied;
+}
+
 // Tell
 //------------------------------------------------------------------------------
 /*virtual*/ uint64_t FileStream::Tell() const
@@ -33,6 +33,10 @@ public:
 	virtual uint64_t WriteBuffer( const void * buffer, uint64_t bytesToWrite );
 	virtual void Flush();
 
+	// copy part of another file to the current position (within the kernel,
+	// without passing through user memory, where supported)
+	uint64_t WriteFromFile( FileStream & source, uint64_t sourcePos, uint64_t bytesToCopy );
+
 	// size/position
 	virtual uint64_t Tell() const;
 	virtual bool Seek( uint64_t pos ) const;
@@ -42,6 +42,7 @@ public:
 	inline bool Read( uint16_t & u )	{ return ( ReadBuffer( &u, sizeof( u ) ) == sizeof( u ) ); }
 	inline bool Read( uint32_t & u )	{ return ( ReadBuffer( &u, sizeof( u ) ) == sizeof( u ) ); }
 	inline bool Read( uint64_t & u )	{ return ( ReadBuffer( &u, sizeof( u ) ) == sizeof( u ) ); }
+	inline bool Read( float & f )		{ return ( ReadBuffer( &f, sizeof( f ) ) == sizeof( f ) ); }
 	bool Read( AString & string );
 	template< class T > inline bool Read( Array< T > & a );
 
@@ -56,6 +57,7 @@ public:
 	inline bool Write( const uint16_t & u )	{ return ( WriteBuffer( &u, sizeof( u ) ) == sizeof( u ) ); }
 	inline bool Write( const uint32_t & u )	{ return ( WriteBuffer( &u, sizeof( u ) ) == sizeof( u ) ); }
 	inline bool Write( const uint64_t & u )	{ return ( WriteBuffer( &u, sizeof( u ) ) == sizeof( u ) ); }
+	inline bool Write( const float & f )	{ return ( WriteBuffer( &f, sizeof( f ) ) == sizeof( f ) ); }
 	bool Write( const AString & string );
 	template< class T > inline bool Write( const Array< T > & a );
 
@@ -54,7 +54,8 @@
 
 	#if defined( __WINDOWS__ ) || defined( __OSX__ )
 		// Case Insensitive
-		return ( cleanPathA.CompareI( cleanPathB ) == 0 );
+		return ( ( cleanPathA.GetLength() == cleanPathB.GetLength() ) &&
+				 ( cleanPathA.CompareI( cleanPathB ) == 0 ) );
 	#endif
 }
 
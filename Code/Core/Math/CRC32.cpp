@@ -89,16 +89,11 @@ void SlicingInit()
 	}
 }
 
-static RES CRC_SlicingBy8(const BYTE* buf, SIZE_T len)
+static RES CRC_SlicingBy8Update(RES crc, const BYTE* buf, SIZE_T len)
 {
-	static bool initialized( false );
-	if ( !initialized )
-	{
-		SlicingInit();
-		initialized = true;
-	}
-
-	RES crc = CRCINIT;
+	// thread-safe one-time init
+	static const bool initialized = ( SlicingInit(), true );
+	(void)initialized;
 
 	// Align to DWORD boundary
 	SIZE_T align = (sizeof(DWORD) - (size_t)buf) & (sizeof(DWORD) - 1);
@@ -127,7 +122,12 @@ static RES CRC_SlicingBy8(const BYTE* buf, SIZE_T len)
 	len &= sizeof(DWORD) * 2 - 1;
 	for (; len; len--)
 		crc = g_crc_slicing[0][(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
-	return ~crc;
+	return crc;
+}
+
+static RES CRC_SlicingBy8(const BYTE* buf, SIZE_T len)
+{
+	return ~CRC_SlicingBy8Update(CRCINIT, buf, len);
 }
 
 // Update
@@ -173,9 +173,19 @@ static RES CRC_SlicingBy8(const BYTE* buf, SIZE_T len)
 //------------------------------------------------------------------------------
 /*static*/ uint32_t CRC32::CalcLower( const void * buffer, size_t len )
 {
-    uint32_t crc32 = Start();
-	crc32 = UpdateLower( crc32, buffer, len );
-	return Stop( crc32 );
+	// lower case in chunks, so the faster slicing-by-8 can be used
+	const char * src = (const char *)buffer;
+	char lowerBuffer[ 256 ];
+	RES crc = CRCINIT;
+	while ( len > 0 )
+	{
+		const size_t chunkLen = Math::Min( len, sizeof( lowerBuffer ) );
+		AString::CopyLower( src, lowerBuffer, chunkLen );
+		crc = CRC_SlicingBy8Update( crc, (const BYTE *)lowerBuffer, chunkLen );
+		src += chunkLen;
+		len -= chunkLen;
+	}
+	return ~crc;
 }
 
 //------------------------------------------------------------------------------
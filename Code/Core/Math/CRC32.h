@@ -23,7 +23,7 @@ public:
 	static uint32_t			CalcLower( const void * buffer, size_t len );
 
 	inline static uint32_t	Calc( const AString & string )		{ return Calc( string.Get(), string.GetLength() ); }
-	inline static uint32_t	CalcLower( const AString & string ) { return CalcLower( string.Get(), string.GetLength() ); }
+	inline static uint32_t	CalcLower( const AString & string ) { return string.GetHashLower(); } // cached by AString
 };
 
 //------------------------------------------------------------------------------
@@ -9,6 +9,7 @@
 #include "Core/Env/Assert.h"
 #include "Core/Env/Types.h"
 #include "Core/Mem/MemTracker.h"
+#include "Core/Mem/SmallBlockAllocator.h"
 
 #include <stdlib.h>
 
@@ -19,6 +20,10 @@
 	#define MEM_FILL_NEW_ALLOCATION_PATTERN ( 0x7F8BAAAD )
 #endif
 
+// Thread-Local Data
+//------------------------------------------------------------------------------
+static THREAD_LOCAL uint32_t tls_AllocationCount( 0 );
+
 // FillMem
 //------------------------------------------------------------------------------
 #ifdef MEM_FILL_NEW_ALLOCATIONS
@@ -82,12 +87,18 @@ void * AllocFileLine( size_t size, const char * file, int line )
 //------------------------------------------------------------------------------
 void * AllocFileLine( size_t size, size_t alignment, const char * file, int line )
 {
-    #if defined( __LINUX__ ) || defined( __APPLE__ )
-        void * mem( nullptr );
-        VERIFY( posix_memalign( &mem, alignment, size ) == 0 );
-	#else
-		void * mem = _aligned_malloc( size, alignment );
-	#endif
+	++tls_AllocationCount;
+
+	// small allocations come from size-class pools
+	void * mem = SmallBlockAllocator::Alloc( size, alignment );
+	if ( mem == nullptr )
+	{
+		#if defined( __LINUX__ ) || defined( __APPLE__ )
+			VERIFY( posix_memalign( &mem, alignment, size ) == 0 );
+		#else
+			mem = _aligned_malloc( size, alignment );
+		#endif
+	}
 
 	#ifdef MEM_FILL_NEW_ALLOCATIONS
 		FillMem( mem, size, MEM_FILL_NEW_ALLOCATION_PATTERN );
@@ -105,6 +116,11 @@ void Free( void * ptr )
 {
 	MEMTRACKER_FREE( ptr );
 
+	if ( SmallBlockAllocator::Free( ptr ) )
+	{
+		return;
+	}
+
     #if defined( __LINUX__ ) || defined( __APPLE__ )
         free( ptr );
 	#else
@@ -112,6 +128,13 @@ void Free( void * ptr )
 	#endif
 }
 
+// GetThreadAllocationCount
+//------------------------------------------------------------------------------
+uint32_t GetThreadAllocationCount()
+{
+	return tls_AllocationCount;
+}
+
 // Operators
 //------------------------------------------------------------------------------
 #if defined( __OSX__ )
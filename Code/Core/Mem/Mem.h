@@ -45,6 +45,9 @@ void * AllocFileLine( size_t size, const char * file, int line );
 void * AllocFileLine( size_t size, size_t alignment, const char * file, int line );
 void Free( void * ptr );
 
+// number of allocations made by the calling thread (for stats)
+uint32_t GetThreadAllocationCount();
+
 // global new/delete
 //------------------------------------------------------------------------------
 #if defined( __OSX__ )
@@ -25,9 +25,9 @@ MemPoolBlock::MemPoolBlock( size_t blockSize, size_t blockAlignment )
 	ASSERT( blockAlignment <= PAGE_SIZE );
 }
 
-// DESTRUCTOR 
+// DESTRUCTOR
 //------------------------------------------------------------------------------
-MemPoolBlock::~MemPoolBlock()
+/*virtual*/ MemPoolBlock::~MemPoolBlock()
 {
 	// Ensure no memory leaks
 	#ifdef DEBUG
@@ -52,7 +52,10 @@ void * MemPoolBlock::Alloc( size_t size )
 
 	if ( m_FreeBlockChain == nullptr )
 	{
-		AllocPage();
+		if ( AllocPage() == false )
+		{
+			return nullptr;
+		}
 		ASSERT( m_FreeBlockChain );
 	}
 
@@ -84,13 +87,16 @@ void MemPoolBlock::Free( void * ptr )
 	#endif
 }
 
-// AlocPage
+// AllocPage
 //------------------------------------------------------------------------------
-void MemPoolBlock::AllocPage()
+bool MemPoolBlock::AllocPage()
 {
-	// allocate page from system
 	const size_t pageSize( PAGE_SIZE );
-	void * newPage = ALLOC( pageSize );
+	void * newPage = AllocPageMemory();
+	if ( newPage == nullptr )
+	{
+		return false;
+	}
 
 	// sanity check page alignment can support block alignment
 	ASSERT( ( (size_t)newPage % m_BlockAlignment ) == 0 );
@@ -117,8 +123,19 @@ void MemPoolBlock::AllocPage()
 	block->m_Next = m_FreeBlockChain;
 	m_FreeBlockChain = firstBlock;
 
+	return true;
+}
+
+// AllocPageMemory
+//------------------------------------------------------------------------------
+/*virtual*/ void * MemPoolBlock::AllocPageMemory()
+{
+	// allocate page from system
+	void * newPage = ALLOC( PAGE_SIZE );
+
 	// track new page
 	m_Pages.Append( newPage );
+	return newPage;
 }
 
 //------------------------------------------------------------------------------
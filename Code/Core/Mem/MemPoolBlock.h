@@ -14,13 +14,19 @@ class MemPoolBlock
 {
 public:
 	MemPoolBlock( size_t blockSize, size_t blockAlignment );
-	~MemPoolBlock();
+	virtual ~MemPoolBlock();
 
-	void *	Alloc( size_t size );
+	void *	Alloc( size_t size ); // returns nullptr if a page can't be allocated
 	void	Free( void * ptr );
 
+	enum { PAGE_SIZE = 64 * 1024 };
+
+protected:
+	// obtain memory for a new page (pages obtained this way are freed on destruction)
+	virtual void * AllocPageMemory();
+
 private:
-	void AllocPage();
+	bool AllocPage();
 
 	struct FreeBlock
 	{
@@ -40,7 +46,6 @@ private:
 	size_t		m_BlockAlignment;
 
 	// allocated pages
-	enum { PAGE_SIZE = 64 * 1024 };
 	Array< void * > m_Pages;
 };
 
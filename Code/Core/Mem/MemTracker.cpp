@@ -12,6 +12,7 @@
 	// Includes
 	//------------------------------------------------------------------------------
 	#include "Core/Mem/MemPoolBlock.h"
+	#include "Core/Mem/SmallBlockAllocator.h"
 	#include "Core/Process/Atomic.h"
 	#include "Core/Process/Thread.h"
 	#include "Core/Tracing/Tracing.h"
@@ -220,6 +221,32 @@
 		OUTPUT( "--------------------------------------------------------------------\n" );
 		OUTPUT( "Total: %llu bytes in %llu allocs\n", total, numAllocs );
 		OUTPUT( "--------------------------------------------------------------------\n" );
+
+		DumpSmallBlockStats();
+	}
+
+	// DumpSmallBlockStats
+	//------------------------------------------------------------------------------
+	/*static*/ void MemTracker::DumpSmallBlockStats()
+	{
+		SmallBlockAllocator::Stats stats;
+		SmallBlockAllocator::GetStats( stats );
+
+		OUTPUT( "--- SmallBlockAllocator --------------------------------------------\n" );
+		OUTPUT( "Committed: %llu KiB of %llu KiB reserved\n", stats.m_CommittedBytes / 1024, stats.m_ReservedBytes / 1024 );
+		for ( const SmallBlockAllocator::SizeClassStats & sizeClass : stats.m_SizeClasses )
+		{
+			if ( sizeClass.m_NumPages == 0 )
+			{
+				continue;
+			}
+			OUTPUT( "%3u bytes : %3u pages, %6llu blocks out, %6llu refills, %6llu flushes\n", sizeClass.m_BlockSize,
+																							  sizeClass.m_NumPages,
+																							  sizeClass.m_NumBlocksOut,
+																							  sizeClass.m_NumRefills,
+																							  sizeClass.m_NumFlushes );
+		}
+		OUTPUT( "--------------------------------------------------------------------\n" );
 	}
 
 	// Reset
@@ -51,6 +51,7 @@
 
 		static void Reset();
 		static void DumpAllocations();
+		static void DumpSmallBlockStats();
 
 		static inline uint32_t GetCurrentAllocationCount() { return s_AllocationCount; }
 
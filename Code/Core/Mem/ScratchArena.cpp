@@ -0,0 +1,178 @@
+// ScratchArena - bump allocator for short-lived data
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/PrecompiledHeader.h"
+
+#include "ScratchArena.h"
+
+// Core
+#include "Core/Env/Assert.h"
+#include "Core/Math/Conversions.h"
+#include "Core/Mem/Mem.h"
+
+// system
+#if defined( __WINDOWS__ )
+	#include <windows.h>
+#endif
+#if defined( __LINUX__ ) || defined( __APPLE__ )
+	#include <sys/mman.h>
+#endif
+
+// Thread-Local Data
+//------------------------------------------------------------------------------
+// thread arenas live in-place so they don't show up as leaks for threads
+// which never exit cleanly (such as the main thread)
+static THREAD_LOCAL uint64_t tls_ScratchArenaStorage[ ( sizeof( ScratchArena ) + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ) ];
+static THREAD_LOCAL ScratchArena * tls_ScratchArena( nullptr );
+
+// CONSTRUCTOR
+//------------------------------------------------------------------------------
+ScratchArena::ScratchArena( size_t chunkSize )
+	: m_FirstChunk( nullptr )
+	, m_CurrentChunk( nullptr )
+	, m_Pos( nullptr )
+	, m_End( nullptr )
+	, m_ChunkSize( chunkSize )
+	, m_PeakBytes( 0 )
+	, m_NumAllocs( 0 )
+	, m_NumChunks( 0 )
+{
+	ASSERT( chunkSize > sizeof( Chunk ) );
+
+	m_FirstChunk = AllocChunk( chunkSize );
+	m_FirstChunk->m_Offset = 0;
+	++m_NumChunks;
+	SetCurrentChunk( m_FirstChunk, (char *)( m_FirstChunk + 1 ) );
+}
+
+// DESTRUCTOR
+//------------------------------------------------------------------------------
+ScratchArena::~ScratchArena()
+{
+	Chunk * chunk = m_FirstChunk;
+	while ( chunk )
+	{
+		Chunk * next = chunk->m_Next;
+		FreeChunk( chunk );
+		chunk = next;
+	}
+}
+
+// Reset
+//------------------------------------------------------------------------------
+void ScratchArena::Reset()
+{
+	Rewind( Marker{ m_FirstChunk, (char *)( m_FirstChunk + 1 ) } );
+
+	// release any additional chunks
+	Chunk * chunk = m_FirstChunk->m_Next;
+	while ( chunk )
+	{
+		Chunk * next = chunk->m_Next;
+		FreeChunk( chunk );
+		chunk = next;
+	}
+	m_FirstChunk->m_Next = nullptr;
+}
+
+// Rewind
+//------------------------------------------------------------------------------
+void ScratchArena::Rewind( const Marker & marker )
+{
+	// record high water mark before discarding allocations
+	m_PeakBytes = Math::Max( m_PeakBytes, GetUsedBytes() );
+
+	SetCurrentChunk( (Chunk *)marker.m_Chunk, marker.m_Pos );
+}
+
+// GetThreadArena
+//------------------------------------------------------------------------------
+/*static*/ ScratchArena & ScratchArena::GetThreadArena()
+{
+	if ( tls_ScratchArena == nullptr )
+	{
+		tls_ScratchArena = INPLACE_NEW ( tls_ScratchArenaStorage ) ScratchArena();
+	}
+	return *tls_ScratchArena;
+}
+
+// ThreadExit
+//------------------------------------------------------------------------------
+/*static*/ void ScratchArena::ThreadExit()
+{
+	if ( tls_ScratchArena )
+	{
+		tls_ScratchArena->~ScratchArena();
+		tls_ScratchArena = nullptr;
+	}
+}
+
+// AllocFromNextChunk
+//------------------------------------------------------------------------------
+void * ScratchArena::AllocFromNextChunk( size_t size, size_t alignment )
+{
+	const size_t sizeNeeded = ( sizeof( Chunk ) + size + alignment );
+
+	// re-use the next chunk if it's big enough, otherwise insert a new one
+	Chunk * chunk = m_CurrentChunk->m_Next;
+	if ( ( chunk == nullptr ) || ( chunk->m_Size < sizeNeeded ) )
+	{
+		chunk = AllocChunk( Math::Max( m_ChunkSize, sizeNeeded ) );
+		chunk->m_Next = m_CurrentChunk->m_Next;
+		m_CurrentChunk->m_Next = chunk;
+		++m_NumChunks;
+	}
+	chunk->m_Offset = ( m_CurrentChunk->m_Offset + m_CurrentChunk->m_Size );
+	SetCurrentChunk( chunk, (char *)( chunk + 1 ) );
+
+	char * mem = (char *)( ( (size_t)m_Pos + ( alignment - 1 ) ) & ~( alignment - 1 ) );
+	ASSERT( ( mem + size ) <= m_End );
+	m_Pos = ( mem + size );
+	return mem;
+}
+
+// SetCurrentChunk
+//------------------------------------------------------------------------------
+void ScratchArena::SetCurrentChunk( Chunk * chunk, char * pos )
+{
+	ASSERT( ( pos >= (char *)( chunk + 1 ) ) && ( pos <= ( (char *)chunk + chunk->m_Size ) ) );
+	m_CurrentChunk = chunk;
+	m_Pos = pos;
+	m_End = ( (char *)chunk + chunk->m_Size );
+}
+
+// AllocChunk
+//------------------------------------------------------------------------------
+/*static*/ ScratchArena::Chunk * ScratchArena::AllocChunk( size_t size )
+{
+	#if defined( __WINDOWS__ )
+		void * mem = ::VirtualAlloc( nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE );
+		ASSERT( mem );
+	#elif defined( __LINUX__ ) || defined( __APPLE__ )
+		void * mem = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+		ASSERT( mem != MAP_FAILED );
+	#else
+		#error Unknown platform
+	#endif
+
+	Chunk * chunk = (Chunk *)mem;
+	chunk->m_Next = nullptr;
+	chunk->m_Size = size;
+	chunk->m_Offset = 0;
+	return chunk;
+}
+
+// FreeChunk
+//------------------------------------------------------------------------------
+/*static*/ void ScratchArena::FreeChunk( Chunk * chunk )
+{
+	#if defined( __WINDOWS__ )
+		VERIFY( ::VirtualFree( chunk, 0, MEM_RELEASE ) );
+	#elif defined( __LINUX__ ) || defined( __APPLE__ )
+		VERIFY( munmap( chunk, chunk->m_Size ) == 0 );
+	#endif
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,117 @@
+// ScratchArena - bump allocator for short-lived data
+//------------------------------------------------------------------------------
+#pragma once
+#ifndef CORE_MEM_SCRATCHARENA_H
+#define CORE_MEM_SCRATCHARENA_H
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/Env/Types.h"
+
+// ScratchArena
+//------------------------------------------------------------------------------
+// Allocations are carved sequentially from large chunks, and are released all
+// at once by rewinding to a previously obtained Marker (or with Reset). There
+// is no per-allocation Free and destructors are not run, so it is only suitable
+// for plain data whose lifetime is bounded by a scope (such as a Job).
+//
+// Chunks are obtained directly from the OS and are retained between uses.
+class ScratchArena
+{
+public:
+	explicit ScratchArena( size_t chunkSize = DEFAULT_CHUNK_SIZE );
+	~ScratchArena();
+
+	void *	Alloc( size_t size, size_t alignment = sizeof( void * ) );
+
+	// grow the most recent allocation in-place if possible
+	bool	TryExtend( void * mem, size_t oldSize, size_t newSize );
+
+	// release all allocations, keeping the first chunk
+	void	Reset();
+
+	struct Marker
+	{
+		void *	m_Chunk;
+		char *	m_Pos;
+	};
+	inline Marker	GetMarker() const { Marker m = { m_CurrentChunk, m_Pos }; return m; }
+	void			Rewind( const Marker & marker );
+
+	// helper to release everything allocated within a scope
+	class Scope
+	{
+	public:
+		explicit inline Scope( ScratchArena & arena ) : m_Arena( arena ), m_Marker( arena.GetMarker() ) {}
+		inline ~Scope() { m_Arena.Rewind( m_Marker ); }
+	private:
+		Scope & operator = ( const Scope & ) = delete;
+
+		ScratchArena &	m_Arena;
+		const Marker	m_Marker;
+	};
+
+	// stats (since construction)
+	inline uint32_t GetNumAllocs() const	{ return m_NumAllocs; }
+	inline uint32_t GetNumChunks() const	{ return m_NumChunks; }
+	inline size_t	GetPeakBytes() const	{ return m_PeakBytes; }
+	inline size_t	GetUsedBytes() const	{ return ( m_CurrentChunk->m_Offset + (size_t)( m_Pos - (char *)m_CurrentChunk ) ); }
+
+	// per-thread arena, created on first use
+	static ScratchArena &	GetThreadArena();
+	static void				ThreadExit();
+
+	enum { DEFAULT_CHUNK_SIZE = 64 * 1024 };
+
+private:
+	struct Chunk
+	{
+		Chunk *		m_Next;
+		size_t		m_Size;		// including this header
+		size_t		m_Offset;	// total bytes in preceding chunks (for stats)
+	};
+
+	void *	AllocFromNextChunk( size_t size, size_t alignment );
+	void	SetCurrentChunk( Chunk * chunk, char * pos );
+
+	static Chunk *	AllocChunk( size_t size );
+	static void		FreeChunk( Chunk * chunk );
+
+	Chunk *		m_FirstChunk;
+	Chunk *		m_CurrentChunk;
+	char *		m_Pos;
+	char *		m_End;
+	size_t		m_ChunkSize;
+	size_t		m_PeakBytes;
+	uint32_t	m_NumAllocs;
+	uint32_t	m_NumChunks;
+};
+
+// Alloc
+//------------------------------------------------------------------------------
+inline void * ScratchArena::Alloc( size_t size, size_t alignment )
+{
+	++m_NumAllocs;
+	char * mem = (char *)( ( (size_t)m_Pos + ( alignment - 1 ) ) & ~( alignment - 1 ) );
+	if ( ( mem + size ) > m_End )
+	{
+		return AllocFromNextChunk( size, alignment );
+	}
+	m_Pos = ( mem + size );
+	return mem;
+}
+
+// TryExtend
+//------------------------------------------------------------------------------
+inline bool ScratchArena::TryExtend( void * mem, size_t oldSize, size_t newSize )
+{
+	if ( ( ( (char *)mem + oldSize ) != m_Pos ) || ( ( (char *)mem + newSize ) > m_End ) )
+	{
+		return false;
+	}
+	m_Pos = ( (char *)mem + newSize );
+	return true;
+}
+
+//------------------------------------------------------------------------------
+#endif // CORE_MEM_SCRATCHARENA_H
@@ -0,0 +1,367 @@
+// SmallBlockAllocator - size-class pools with per-thread caches
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/PrecompiledHeader.h"
+
+#include "SmallBlockAllocator.h"
+
+// Core
+#include "Core/Env/Assert.h"
+#include "Core/Math/Conversions.h"
+#include "Core/Mem/Mem.h"
+#include "Core/Mem/MemPoolBlock.h"
+#include "Core/Process/Atomic.h"
+#include "Core/Process/Mutex.h"
+
+// system
+#include <memory.h> // for memset
+#if defined( __WINDOWS__ )
+	#include <windows.h>
+#endif
+#if defined( __LINUX__ ) || defined( __APPLE__ )
+	#include <sys/mman.h>
+#endif
+
+// Defines
+//------------------------------------------------------------------------------
+#if defined( WIN64 ) || defined( __LP64__ )
+	#define SMALL_BLOCK_REGION_SIZE		( 1024 * 1024 * 1024 )	// address space only, committed as needed
+#else
+	#define SMALL_BLOCK_REGION_SIZE		( 256 * 1024 * 1024 )
+#endif
+#define SMALL_BLOCK_PAGE_SHIFT			( 16 )					// MemPoolBlock::PAGE_SIZE
+#define SMALL_BLOCK_MAX_PAGES			( SMALL_BLOCK_REGION_SIZE >> SMALL_BLOCK_PAGE_SHIFT )
+#define SMALL_BLOCK_REFILL_COUNT		( 32 )					// blocks moved to a thread cache at once
+#define SMALL_BLOCK_MAX_CACHED			( 64 )					// blocks a thread caches before returning some
+
+// SmallBlockPool
+//------------------------------------------------------------------------------
+class SmallBlockPool : public MemPoolBlock
+{
+public:
+	SmallBlockPool( uint32_t sizeClass, uint32_t blockSize )
+		: MemPoolBlock( blockSize, SmallBlockAllocator::BLOCK_ALIGNMENT )
+		, m_SizeClass( sizeClass )
+	{
+		memset( &m_Stats, 0, sizeof( m_Stats ) );
+		m_Stats.m_BlockSize = blockSize;
+	}
+
+	Mutex									m_Mutex;
+	const uint32_t							m_SizeClass;
+	SmallBlockAllocator::SizeClassStats		m_Stats;
+
+protected:
+	// pages come from the reserved region, and are never returned
+	virtual void * AllocPageMemory() override
+	{
+		void * page = SmallBlockAllocator::CommitPage( m_SizeClass );
+		if ( page )
+		{
+			++m_Stats.m_NumPages;
+		}
+		return page;
+	}
+};
+
+// Per-Thread Cache
+//------------------------------------------------------------------------------
+struct SmallBlockThreadCache
+{
+	void *		m_Blocks[ SmallBlockAllocator::NUM_SIZE_CLASSES ];		// chain of free blocks
+	uint32_t	m_NumBlocks[ SmallBlockAllocator::NUM_SIZE_CLASSES ];
+};
+
+// Static Data
+//------------------------------------------------------------------------------
+/*static*/ volatile bool	SmallBlockAllocator::s_Initialized( false );
+/*static*/ char *			SmallBlockAllocator::s_RegionBase( nullptr );
+/*static*/ volatile size_t	SmallBlockAllocator::s_RegionSize( 0 );
+
+static const uint32_t g_SmallBlockSizes[ SmallBlockAllocator::NUM_SIZE_CLASSES ] =
+{
+	16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256
+};
+
+// size class for each ( size - 1 ) / 16
+static const uint8_t g_SmallBlockSizeToClass[ SmallBlockAllocator::MAX_BLOCK_SIZE / 16 ] =
+{
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 9, 10, 10, 11, 11
+};
+
+// pools are constructed in-place on first use, and never destroyed
+static uint64_t g_SmallBlockPools[ SmallBlockAllocator::NUM_SIZE_CLASSES ][ ( sizeof( SmallBlockPool ) + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ) ];
+static inline SmallBlockPool & GetPool( uint32_t sizeClass ) { return reinterpret_cast< SmallBlockPool & >( g_SmallBlockPools[ sizeClass ] ); }
+
+static uint8_t g_SmallBlockPageSizeClass[ SMALL_BLOCK_MAX_PAGES ];
+static volatile uint32_t g_SmallBlockNumPages( 0 );
+
+static THREAD_LOCAL SmallBlockThreadCache tls_SmallBlockCache;
+static THREAD_LOCAL bool tls_SmallBlockInAllocator( false );
+
+// Alloc
+//------------------------------------------------------------------------------
+/*static*/ void * SmallBlockAllocator::Alloc( size_t size, size_t alignment )
+{
+	if ( ( size > MAX_BLOCK_SIZE ) || ( alignment > BLOCK_ALIGNMENT ) )
+	{
+		return nullptr;
+	}
+
+	// allocations made while managing the pools go to the system
+	if ( tls_SmallBlockInAllocator )
+	{
+		return nullptr;
+	}
+
+	if ( !s_Initialized )
+	{
+		if ( !Init() )
+		{
+			return nullptr;
+		}
+	}
+	else if ( s_RegionSize == 0 )
+	{
+		return nullptr; // failed to reserve region
+	}
+
+	const uint32_t sizeClass = g_SmallBlockSizeToClass[ size ? ( ( size - 1 ) >> 4 ) : 0 ];
+
+	// take a block from this thread's cache
+	SmallBlockThreadCache & cache = tls_SmallBlockCache;
+	FreeBlock * block = (FreeBlock *)cache.m_Blocks[ sizeClass ];
+	if ( block == nullptr )
+	{
+		return Refill( sizeClass );
+	}
+	cache.m_Blocks[ sizeClass ] = block->m_Next;
+	--cache.m_NumBlocks[ sizeClass ];
+	return block;
+}
+
+// Free
+//------------------------------------------------------------------------------
+/*static*/ bool SmallBlockAllocator::Free( void * ptr )
+{
+	// anything outside the region belongs to the system allocator
+	// (this also handles nullptr, and an unreserved region)
+	const size_t offset = ( (size_t)ptr - (size_t)s_RegionBase );
+	if ( offset >= s_RegionSize )
+	{
+		return false;
+	}
+
+	const uint32_t sizeClass = g_SmallBlockPageSizeClass[ offset >> SMALL_BLOCK_PAGE_SHIFT ];
+
+	// return the block to this thread's cache
+	SmallBlockThreadCache & cache = tls_SmallBlockCache;
+	FreeBlock * block = (FreeBlock *)ptr;
+	block->m_Next = (FreeBlock *)cache.m_Blocks[ sizeClass ];
+	cache.m_Blocks[ sizeClass ] = block;
+	if ( ++cache.m_NumBlocks[ sizeClass ] > SMALL_BLOCK_MAX_CACHED )
+	{
+		// keep some, so alternating alloc/free doesn't thrash the shared pool
+		Flush( sizeClass, SMALL_BLOCK_MAX_CACHED / 2 );
+	}
+	return true;
+}
+
+// ThreadExit
+//------------------------------------------------------------------------------
+/*static*/ void SmallBlockAllocator::ThreadExit()
+{
+	if ( !s_Initialized )
+	{
+		return;
+	}
+
+	SmallBlockThreadCache & cache = tls_SmallBlockCache;
+	for ( uint32_t i = 0; i < NUM_SIZE_CLASSES; ++i )
+	{
+		if ( cache.m_NumBlocks[ i ] )
+		{
+			Flush( i, cache.m_NumBlocks[ i ] );
+		}
+	}
+}
+
+// GetStats
+//------------------------------------------------------------------------------
+/*static*/ void SmallBlockAllocator::GetStats( Stats & stats )
+{
+	memset( &stats, 0, sizeof( stats ) );
+	for ( uint32_t i = 0; i < NUM_SIZE_CLASSES; ++i )
+	{
+		stats.m_SizeClasses[ i ].m_BlockSize = g_SmallBlockSizes[ i ];
+	}
+
+	if ( !s_Initialized )
+	{
+		return;
+	}
+
+	for ( uint32_t i = 0; i < NUM_SIZE_CLASSES; ++i )
+	{
+		SmallBlockPool & pool = GetPool( i );
+		MutexHolder mh( pool.m_Mutex );
+		stats.m_SizeClasses[ i ] = pool.m_Stats;
+	}
+	stats.m_ReservedBytes = s_RegionSize;
+	stats.m_CommittedBytes = (uint64_t)Math::Min< uint32_t >( g_SmallBlockNumPages, SMALL_BLOCK_MAX_PAGES ) * MemPoolBlock::PAGE_SIZE;
+}
+
+// Init
+//------------------------------------------------------------------------------
+/*static*/ bool SmallBlockAllocator::Init()
+{
+	static_assert( ( 1 << SMALL_BLOCK_PAGE_SHIFT ) == MemPoolBlock::PAGE_SIZE, "SMALL_BLOCK_PAGE_SHIFT doesn't match MemPoolBlock::PAGE_SIZE" );
+	static_assert( sizeof( g_SmallBlockSizes ) / sizeof( uint32_t ) == NUM_SIZE_CLASSES, "g_SmallBlockSizes item count doesn't match NUM_SIZE_CLASSES" );
+	static_assert( sizeof( g_SmallBlockSizeToClass ) == ( MAX_BLOCK_SIZE / 16 ), "g_SmallBlockSizeToClass has unexpected size" );
+
+	// first caller does init
+	static uint32_t threadSafeGuard( 0 );
+	if ( AtomicIncU32( &threadSafeGuard ) != 1 )
+	{
+		// subsequent callers wait for init
+		while ( !s_Initialized ) {}
+		return ( s_RegionSize != 0 );
+	}
+
+	tls_SmallBlockInAllocator = true;
+
+	for ( uint32_t i = 0; i < NUM_SIZE_CLASSES; ++i )
+	{
+		INPLACE_NEW ( &GetPool( i ) ) SmallBlockPool( i, g_SmallBlockSizes[ i ] );
+	}
+
+	// reserve address space (pages are committed as the pools grow)
+	#if defined( __WINDOWS__ )
+		void * region = ::VirtualAlloc( nullptr, SMALL_BLOCK_REGION_SIZE, MEM_RESERVE, PAGE_NOACCESS );
+	#elif defined( __LINUX__ ) || defined( __APPLE__ )
+		void * region = mmap( nullptr, SMALL_BLOCK_REGION_SIZE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+		if ( region == MAP_FAILED )
+		{
+			region = nullptr;
+		}
+	#else
+		#error Unknown platform
+	#endif
+
+	if ( region )
+	{
+		s_RegionBase = (char *)region;
+		MemoryBarrier();
+		s_RegionSize = SMALL_BLOCK_REGION_SIZE;
+	}
+
+	tls_SmallBlockInAllocator = false;
+
+	MemoryBarrier();
+	s_Initialized = true;
+
+	// if the reservation failed, everything goes to the system allocator
+	return ( region != nullptr );
+}
+
+// Refill
+//------------------------------------------------------------------------------
+/*static*/ void * SmallBlockAllocator::Refill( uint32_t sizeClass )
+{
+	SmallBlockThreadCache & cache = tls_SmallBlockCache;
+	ASSERT( cache.m_Blocks[ sizeClass ] == nullptr );
+
+	tls_SmallBlockInAllocator = true;
+
+	SmallBlockPool & pool = GetPool( sizeClass );
+	const size_t blockSize = g_SmallBlockSizes[ sizeClass ];
+	FreeBlock * chain = nullptr;
+	uint32_t numBlocks = 0;
+	{
+		MutexHolder mh( pool.m_Mutex );
+		for ( ; numBlocks < SMALL_BLOCK_REFILL_COUNT; ++numBlocks )
+		{
+			FreeBlock * block = (FreeBlock *)pool.Alloc( blockSize );
+			if ( block == nullptr )
+			{
+				break; // region exhausted
+			}
+			block->m_Next = chain;
+			chain = block;
+		}
+		pool.m_Stats.m_NumBlocksOut += numBlocks;
+		++pool.m_Stats.m_NumRefills;
+	}
+
+	tls_SmallBlockInAllocator = false;
+
+	if ( chain == nullptr )
+	{
+		return nullptr; // caller will use the system allocator
+	}
+
+	// keep all but the first
+	cache.m_Blocks[ sizeClass ] = chain->m_Next;
+	cache.m_NumBlocks[ sizeClass ] = ( numBlocks - 1 );
+	return chain;
+}
+
+// Flush
+//------------------------------------------------------------------------------
+/*static*/ void SmallBlockAllocator::Flush( uint32_t sizeClass, uint32_t numBlocks )
+{
+	SmallBlockThreadCache & cache = tls_SmallBlockCache;
+	ASSERT( numBlocks <= cache.m_NumBlocks[ sizeClass ] );
+
+	tls_SmallBlockInAllocator = true;
+
+	SmallBlockPool & pool = GetPool( sizeClass );
+	FreeBlock * block = (FreeBlock *)cache.m_Blocks[ sizeClass ];
+	{
+		MutexHolder mh( pool.m_Mutex );
+		for ( uint32_t i = 0; i < numBlocks; ++i )
+		{
+			FreeBlock * next = block->m_Next;
+			pool.Free( block );
+			block = next;
+		}
+		pool.m_Stats.m_NumBlocksOut -= numBlocks;
+		++pool.m_Stats.m_NumFlushes;
+	}
+
+	cache.m_Blocks[ sizeClass ] = block;
+	cache.m_NumBlocks[ sizeClass ] -= numBlocks;
+
+	tls_SmallBlockInAllocator = false;
+}
+
+// CommitPage
+//------------------------------------------------------------------------------
+/*static*/ void * SmallBlockAllocator::CommitPage( uint32_t sizeClass )
+{
+	const uint32_t pageIndex = ( AtomicIncU32( &g_SmallBlockNumPages ) - 1 );
+	if ( pageIndex >= SMALL_BLOCK_MAX_PAGES )
+	{
+		return nullptr; // region exhausted
+	}
+
+	void * page = ( s_RegionBase + ( (size_t)pageIndex << SMALL_BLOCK_PAGE_SHIFT ) );
+	#if defined( __WINDOWS__ )
+		if ( ::VirtualAlloc( page, MemPoolBlock::PAGE_SIZE, MEM_COMMIT, PAGE_READWRITE ) == nullptr )
+		{
+			return nullptr;
+		}
+	#elif defined( __LINUX__ ) || defined( __APPLE__ )
+		if ( mprotect( page, MemPoolBlock::PAGE_SIZE, PROT_READ | PROT_WRITE ) != 0 )
+		{
+			return nullptr;
+		}
+	#endif
+
+	g_SmallBlockPageSizeClass[ pageIndex ] = (uint8_t)sizeClass;
+	return page;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,73 @@
+// SmallBlockAllocator - size-class pools with per-thread caches
+//------------------------------------------------------------------------------
+#pragma once
+#ifndef CORE_MEM_SMALLBLOCKALLOCATOR_H
+#define CORE_MEM_SMALLBLOCKALLOCATOR_H
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/Env/Types.h"
+
+// SmallBlockAllocator
+//------------------------------------------------------------------------------
+// Services small allocations made through ALLOC/FNEW. Each size class has a
+// shared MemPoolBlock, and each thread caches a short list of free blocks per
+// class, so most allocations and frees don't take any locks.
+//
+// Pool pages are committed from a single reserved address range, so a block can
+// be identified (and its size class found) from its address alone.
+class SmallBlockAllocator
+{
+public:
+	enum
+	{
+		MAX_BLOCK_SIZE		= 256,
+		BLOCK_ALIGNMENT		= 16,
+		NUM_SIZE_CLASSES	= 12,
+	};
+
+	// returns nullptr if the request should be serviced by the system allocator
+	static void *	Alloc( size_t size, size_t alignment );
+
+	// returns false if the memory was not allocated by the SmallBlockAllocator
+	static bool		Free( void * ptr );
+
+	// return blocks cached by the calling thread to the shared pools
+	static void		ThreadExit();
+
+	struct SizeClassStats
+	{
+		uint32_t	m_BlockSize;
+		uint32_t	m_NumPages;
+		uint64_t	m_NumBlocksOut;	// blocks in use or cached by threads
+		uint64_t	m_NumRefills;	// thread caches filled from the shared pool
+		uint64_t	m_NumFlushes;	// thread caches returned to the shared pool
+	};
+	struct Stats
+	{
+		SizeClassStats	m_SizeClasses[ NUM_SIZE_CLASSES ];
+		uint64_t		m_ReservedBytes;
+		uint64_t		m_CommittedBytes;
+	};
+	static void		GetStats( Stats & stats );
+
+private:
+	friend class SmallBlockPool;
+
+	struct FreeBlock
+	{
+		FreeBlock * m_Next;
+	};
+
+	static bool		Init();
+	static void *	Refill( uint32_t sizeClass );
+	static void		Flush( uint32_t sizeClass, uint32_t numBlocks );
+	static void *	CommitPage( uint32_t sizeClass );
+
+	static volatile bool	s_Initialized;
+	static char *			s_RegionBase;
+	static volatile size_t	s_RegionSize;	// zero until the region is reserved
+};
+
+//------------------------------------------------------------------------------
+#endif // CORE_MEM_SMALLBLOCKALLOCATOR_H
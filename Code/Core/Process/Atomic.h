@@ -46,6 +46,15 @@ inline uint32_t AtomicDecU32( volatile uint32_t * i )
 	#endif
 }
 
+inline uint32_t AtomicAddU32( volatile uint32_t * i, uint32_t value )
+{
+	#if defined( __WINDOWS__ )
+		return ( (uint32_t)InterlockedExchangeAdd( (volatile LONG *)i, (LONG)value ) + value );
+	#elif defined( __APPLE__ ) || defined( __LINUX__ )
+		return __sync_add_and_fetch( i, value );
+	#endif
+}
+
 // 64bit
 //------------------------------------------------------------------------------
 inline int64_t AtomicInc64( volatile int64_t * i )
@@ -81,5 +90,43 @@ inline uint64_t AtomicDecU64( volatile uint64_t * i )
 	#endif
 }
 
+// Exchange (full barrier, returning previous value)
+//------------------------------------------------------------------------------
+inline uint32_t AtomicExchangeU32( volatile uint32_t * i, uint32_t value )
+{
+	#if defined( __WINDOWS__ )
+		return (uint32_t)InterlockedExchange( (volatile LONG *)i, (LONG)value );
+	#elif defined( __APPLE__ ) || defined( __LINUX__ )
+		return __atomic_exchange_n( i, value, __ATOMIC_SEQ_CST );
+	#endif
+}
+inline void * AtomicExchangePtr( void * volatile * ptr, void * value )
+{
+	#if defined( __WINDOWS__ )
+		return InterlockedExchangePointer( ptr, value );
+	#elif defined( __APPLE__ ) || defined( __LINUX__ )
+		return __atomic_exchange_n( ptr, value, __ATOMIC_SEQ_CST );
+	#endif
+}
+
+// CompareExchange (full barrier, returning previous value)
+//------------------------------------------------------------------------------
+inline uint32_t AtomicCompareExchangeU32( volatile uint32_t * i, uint32_t value, uint32_t comparand )
+{
+	#if defined( __WINDOWS__ )
+		return (uint32_t)InterlockedCompareExchange( (volatile LONG *)i, (LONG)value, (LONG)comparand );
+	#elif defined( __APPLE__ ) || defined( __LINUX__ )
+		return __sync_val_compare_and_swap( i, comparand, value );
+	#endif
+}
+inline void * AtomicCompareExchangePtr( void * volatile * ptr, void * value, void * comparand )
+{
+	#if defined( __WINDOWS__ )
+		return InterlockedCompareExchangePointer( ptr, value, comparand );
+	#elif defined( __APPLE__ ) || defined( __LINUX__ )
+		return __sync_val_compare_and_swap( ptr, comparand, value );
+	#endif
+}
+
 //------------------------------------------------------------------------------
 #endif // CORE_PROCESS_ATOMIC_H
@@ -9,13 +9,63 @@
 
 // Core
 #include "Core/Env/Assert.h"
+#if defined( __LINUX__ )
+    #include "Core/Env/Env.h"
+    #include "Core/Math/Conversions.h"
+    #include "Core/Process/Atomic.h"
+#endif
 
 #if defined( __WINDOWS__ )
     #include <windows.h>
 #endif
 #if defined( __LINUX__ )
     #include <errno.h>
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
     #include <time.h>
+    #include <unistd.h>
+    #if defined( __x86_64__ ) || defined( __i386__ )
+        #include <emmintrin.h>
+    #endif
+#endif
+
+// Linux Helpers
+//------------------------------------------------------------------------------
+#if defined( __LINUX__ )
+    namespace
+    {
+        // spin limits (in pause instructions) before blocking
+        const uint32_t SEMAPHORE_MIN_SPIN = 16;
+        const uint32_t SEMAPHORE_MAX_SPIN = 4096;
+
+        inline void CPUPause()
+        {
+            #if defined( __x86_64__ ) || defined( __i386__ )
+                _mm_pause();
+            #elif defined( __aarch64__ ) || defined( __arm__ )
+                __asm__ __volatile__( "yield" );
+            #endif
+        }
+
+        // spinning is pointless when there's nothing which could signal us in the meantime
+        inline bool CanSpin()
+        {
+            static const bool canSpin = ( Env::GetNumProcessors() > 1 );
+            return canSpin;
+        }
+
+        inline long Futex( volatile uint32_t * addr, int op, uint32_t value, const struct timespec * timeout )
+        {
+            return syscall( SYS_futex, addr, op, value, timeout, nullptr, 0 );
+        }
+
+        inline uint64_t GetMonotonicTimeNS()
+        {
+            struct timespec ts;
+            VERIFY( clock_gettime( CLOCK_MONOTONIC, &ts ) == 0 );
+            return ( (uint64_t)ts.tv_sec * (uint64_t)1000000000 ) + (uint64_t)ts.tv_nsec;
+        }
+    }
 #endif
 #if defined( __OSX__ )
     #include <dispatch/dispatch.h>
@@ -32,7 +82,9 @@ Semaphore::Semaphore()
         m_Semaphore = dispatch_semaphore_create(0);
         ASSERT( m_Semaphore );
     #elif defined( __LINUX__ )
-        VERIFY( sem_init( &m_Semaphore, 0, 0 ) == 0 );
+        m_Count = 0;
+        m_NumWaiters = 0;
+        m_SpinLimit = SEMAPHORE_MIN_SPIN;
     #endif
 }
 
@@ -45,7 +97,7 @@ Semaphore::~Semaphore()
     #elif defined( __APPLE__ )
         dispatch_release( m_Semaphore );
     #elif defined( __LINUX__ )
-        VERIFY( sem_destroy( &m_Semaphore ) == 0 );
+        ASSERT( m_NumWaiters == 0 );
     #endif
 }
 
@@ -58,7 +110,7 @@ void Semaphore::Signal()
     #elif defined( __APPLE__ )
         dispatch_semaphore_signal( m_Semaphore );
     #elif defined( __LINUX__ )
-        VERIFY( sem_post( &m_Semaphore ) == 0 );
+        Signal( 1 );
     #endif
 }
 
@@ -69,6 +121,15 @@ void Semaphore::Signal( uint32_t num )
 	ASSERT( num ); // not valid to call with 0
     #if defined( __WINDOWS__ )
         VERIFY( ReleaseSemaphore( m_Semaphore, (DWORD)num, nullptr ) );
+    #elif defined( __LINUX__ )
+        AtomicAddU32( &m_Count, num );
+
+        // wake only as many threads as are blocked (and no more than can consume a signal)
+        const uint32_t numWaiters = m_NumWaiters;
+        if ( numWaiters > 0 )
+        {
+            Futex( &m_Count, FUTEX_WAKE_PRIVATE, Math::Min( num, numWaiters ), nullptr );
+        }
     #else
 		for ( size_t i=0; i<num; ++i )
 		{
@@ -81,6 +142,15 @@ void Semaphore::Signal( uint32_t num )
 //------------------------------------------------------------------------------
 void Semaphore::Wait( uint32_t timeoutMS )
 {
+    #if defined( __LINUX__ )
+        if ( TryWait() || SpinWait() )
+        {
+            return;
+        }
+        FutexWait( timeoutMS );
+        return;
+    #endif
+
     if ( timeoutMS == 0 )
     {
         // Wait forever
@@ -88,8 +158,6 @@ void Semaphore::Wait( uint32_t timeoutMS )
             VERIFY( WaitForSingleObject( m_Semaphore, INFINITE ) == WAIT_OBJECT_0 );        
         #elif defined( __APPLE__ )
             dispatch_semaphore_wait( m_Semaphore, DISPATCH_TIME_FOREVER );
-        #elif defined( __LINUX__ )
-            VERIFY( sem_wait( &m_Semaphore ) == 0 );
         #endif
     }
     else
@@ -101,20 +169,89 @@ void Semaphore::Wait( uint32_t timeoutMS )
             (void)result;
         #elif defined( __APPLE__ )
             dispatch_semaphore_wait( m_Semaphore, dispatch_time( DISPATCH_TIME_NOW, timeoutMS * 1000000 ) );
-        #elif defined( __LINUX__ )
-            struct timespec ts;
-            VERIFY( clock_gettime( CLOCK_REALTIME, &ts ) == 0 );
-            uint64_t totalNS = (uint64_t)ts.tv_sec * (uint64_t)1000000000;
-            totalNS += (uint64_t)ts.tv_nsec;
-            totalNS += (uint64_t)timeoutMS * 1000000;
-            ts.tv_sec = totalNS / 1000000000;
-            ts.tv_nsec = totalNS % 1000000000;
-            if ( sem_timedwait( &m_Semaphore, &ts ) != 0 )
-            {
-                ASSERT( errno == ETIMEDOUT ); // anything else is a usage error?
-            }
         #endif
     }
 }
 
+#if defined( __LINUX__ )
+    // TryWait
+    //------------------------------------------------------------------------------
+    bool Semaphore::TryWait()
+    {
+        uint32_t count = m_Count;
+        while ( count > 0 )
+        {
+            const uint32_t prevCount = AtomicCompareExchangeU32( &m_Count, count - 1, count );
+            if ( prevCount == count )
+            {
+                return true;
+            }
+            count = prevCount; // lost a race - try again
+        }
+        return false;
+    }
+
+    // SpinWait
+    //------------------------------------------------------------------------------
+    bool Semaphore::SpinWait()
+    {
+        if ( CanSpin() == false )
+        {
+            return false;
+        }
+
+        const uint32_t spinLimit = m_SpinLimit;
+        for ( uint32_t i = 0; i < spinLimit; ++i )
+        {
+            CPUPause();
+            if ( ( m_Count > 0 ) && TryWait() )
+            {
+                // allow twice as long as was needed next time
+                m_SpinLimit = Math::Clamp( i * 2, SEMAPHORE_MIN_SPIN, SEMAPHORE_MAX_SPIN );
+                return true;
+            }
+        }
+
+        // spinning was wasted, so spin less next time
+        m_SpinLimit = Math::Max( spinLimit / 2, SEMAPHORE_MIN_SPIN );
+        return false;
+    }
+
+    // FutexWait
+    //------------------------------------------------------------------------------
+    void Semaphore::FutexWait( uint32_t timeoutMS )
+    {
+        // Signal checks for waiters after incrementing the count, and the futex
+        // only blocks if the count is still zero, so signals can't be missed
+        AtomicIncU32( &m_NumWaiters );
+
+        const uint64_t endTimeNS = timeoutMS ? ( GetMonotonicTimeNS() + ( (uint64_t)timeoutMS * 1000000 ) ) : 0;
+        while ( TryWait() == false )
+        {
+            struct timespec timeout;
+            struct timespec * timeoutPtr = nullptr;
+            if ( timeoutMS )
+            {
+                const uint64_t nowNS = GetMonotonicTimeNS();
+                if ( nowNS >= endTimeNS )
+                {
+                    break; // timed out
+                }
+                const uint64_t remainingNS = ( endTimeNS - nowNS );
+                timeout.tv_sec = (time_t)( remainingNS / 1000000000 );
+                timeout.tv_nsec = (long)( remainingNS % 1000000000 );
+                timeoutPtr = &timeout;
+            }
+
+            if ( Futex( &m_Count, FUTEX_WAIT_PRIVATE, 0, timeoutPtr ) != 0 )
+            {
+                // count changed before we blocked, interrupted or timed out
+                ASSERT( ( errno == EAGAIN ) || ( errno == EINTR ) || ( errno == ETIMEDOUT ) );
+            }
+        }
+
+        AtomicDecU32( &m_NumWaiters );
+    }
+#endif
+
 //------------------------------------------------------------------------------
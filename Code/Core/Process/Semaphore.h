@@ -10,8 +10,6 @@
 
 #if defined( __APPLE__ )
     #include <dispatch/dispatch.h>
-#elif defined( __LINUX__ )
-    #include <semaphore.h>
 #endif
 
 // Semaphore
@@ -32,7 +30,16 @@ private:
     #elif defined( __APPLE__ )
        dispatch_semaphore_t m_Semaphore;	
     #elif defined( __LINUX__ )
-        sem_t m_Semaphore;
+        // Count is decremented without syscalls when possible, and a futex is
+        // used to block when it's zero. Signals only wake as many threads as
+        // are blocked.
+        bool TryWait();
+        bool SpinWait();
+        void FutexWait( uint32_t timeoutMS );
+
+        volatile uint32_t m_Count;		// available signals (futex word)
+        volatile uint32_t m_NumWaiters;	// threads blocked (or about to block) on futex
+        volatile uint32_t m_SpinLimit;	// adapts to how often spinning succeeds
     #endif
 };
 
@@ -8,6 +8,8 @@
 #include "Thread.h"
 #include "Core/Env/Assert.h"
 #include "Core/Mem/Mem.h"
+#include "Core/Mem/ScratchArena.h"
+#include "Core/Mem/SmallBlockAllocator.h"
 #include "Core/Profile/Profile.h"
 
 // system
@@ -75,10 +77,16 @@ public:
         FDELETE( originalInfo );
 
 		// enter into real thread function
+		const uint32_t result = (*realFunction)( realUserData );
+
+		// release per-thread memory
+		ScratchArena::ThreadExit();
+		SmallBlockAllocator::ThreadExit();
+
         #if defined( __WINDOWS__ )
-            return (*realFunction)( realUserData );
+            return result;
         #else
-            return (void *)(size_t)( (*realFunction)( realUserData ) );
+            return (void *)(size_t)result;
         #endif
 	}
 };
@@ -8,14 +8,55 @@
 #include "AString.h"
 #include "AStackString.h"
 #include "Core/Math/Conversions.h"
+#include "Core/Math/CRC32.h"
 
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+// SIMD
+//------------------------------------------------------------------------------
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+	#define ASTRING_USE_SSE2
+	#include <emmintrin.h>
+	#if defined( __WINDOWS__ )
+		#include <intrin.h>
+	#endif
+#endif
+
+// Helpers
+//------------------------------------------------------------------------------
+static inline char ToLowerASCII( char c )
+{
+	return ( ( c >= 'A' ) && ( c <= 'Z' ) ) ? (char)( c + ( 'a' - 'A' ) ) : c;
+}
+#if defined( ASTRING_USE_SSE2 )
+	// index of lowest set bit (mask must be non-zero)
+	static inline uint32_t FirstSetBit( uint32_t mask )
+	{
+		#if defined( __WINDOWS__ )
+			unsigned long index;
+			_BitScanForward( &index, mask );
+			return (uint32_t)index;
+		#else
+			return (uint32_t)__builtin_ctz( mask );
+		#endif
+	}
+
+	// convert A-Z to a-z in 16 chars
+	static inline __m128i ToLowerSSE2( __m128i chars )
+	{
+		// signed compares leave chars >= 0x80 untouched
+		const __m128i isUpper = _mm_and_si128( _mm_cmpgt_epi8( chars, _mm_set1_epi8( 'A' - 1 ) ),
+											   _mm_cmplt_epi8( chars, _mm_set1_epi8( 'Z' + 1 ) ) );
+		return _mm_add_epi8( chars, _mm_and_si128( isUpper, _mm_set1_epi8( 'a' - 'A' ) ) );
+	}
+#endif
+
 // Static
 //------------------------------------------------------------------------------
+static_assert( ( AString::SHORT_STRING_CAPACITY % 2 ) == 0, "Short string capacity must be multiple of 2" );
 /*static*/ const char * const AString::s_EmptyString( "" );
 /*static*/ const AString AString::s_EmptyAString;
 
@@ -25,62 +66,55 @@ AString::AString()
 : m_Contents( const_cast<char *>( s_EmptyString ) ) // cast to allow pointing to protected string
 , m_Length( 0 )
 , m_ReservedAndFlags( 0 )
+, m_HashLower( 0 )
 {
 }
 
 // CONSTRUCTOR (uint32_t)
 //------------------------------------------------------------------------------
 AString::AString( uint32_t reserve )
+: m_Length( 0 )
+, m_ReservedAndFlags( 0 )
+, m_HashLower( 0 )
 {
-	char * mem = nullptr;
-	if ( reserve > 0 )
-	{
-		reserve = Math::RoundUp( reserve, (uint32_t)2 );
-		mem = (char *)ALLOC( reserve + 1 );
-		mem[ 0 ] = '\000';
-	}
-	m_Contents = mem;
-	m_Length = 0;
-	SetReserved( reserve, true );
+	GrowNoCopy( reserve );
+	m_Contents[ 0 ] = '\000';
 }
 
 // CONSTRUCTOR (const AString &)
 //------------------------------------------------------------------------------
 AString::AString( const AString & string )
+: m_Length( string.GetLength() )
+, m_ReservedAndFlags( 0 )
+, m_HashLower( string.m_HashLower )
 {
-	uint32_t len = string.GetLength();
-	m_Length = len;
-	uint32_t reserved = Math::RoundUp( len, (uint32_t)2 );
-	m_Contents = (char *)ALLOC( reserved + 1 );
-	SetReserved( reserved, true );
-	Copy( string.Get(), m_Contents, len ); // copy handles terminator
+	GrowNoCopy( m_Length );
+	Copy( string.Get(), m_Contents, m_Length ); // copy handles terminator
 }
 
 // CONSTRUCTOR (const char *)
 //------------------------------------------------------------------------------
 AString::AString( const char * string )
+: m_ReservedAndFlags( 0 )
+, m_HashLower( 0 )
 {
 	ASSERT( string );
-	uint32_t len = (uint32_t)StrLen( string );
-	m_Length = len;
-	uint32_t reserved = Math::RoundUp( len, (uint32_t)2 );
-	m_Contents = (char *)ALLOC( reserved + 1 );
-	SetReserved( reserved, true );
-	Copy( string, m_Contents, len ); // copy handles terminator
+	m_Length = (uint32_t)StrLen( string );
+	GrowNoCopy( m_Length );
+	Copy( string, m_Contents, m_Length ); // copy handles terminator
 }
 
 // CONSTRUCTOR (const char *, const char *)
 //------------------------------------------------------------------------------
 AString::AString( const char * start, const char * end )
+: m_ReservedAndFlags( 0 )
+, m_HashLower( 0 )
 {
 	ASSERT( start );
 	ASSERT( end );
-	uint32_t len = uint32_t( end - start );
-	m_Length = len;
-	uint32_t reserved = Math::RoundUp( len, (uint32_t)2 );
-	m_Contents = (char *)ALLOC( reserved + 1 );
-	SetReserved( reserved, true );
-	Copy( start, m_Contents, len ); // copy handles terminator
+	m_Length = uint32_t( end - start );
+	GrowNoCopy( m_Length );
+	Copy( start, m_Contents, m_Length ); // copy handles terminator
 }
 
 // DESTRUCTOR
@@ -104,8 +138,11 @@ AString::~AString()
 		// if we don't own the memory, either:
 		// a) We are an empty string, pointing to the special global empty string
 		// OR:
-		// b) We are a StackString, and we should point to our internal buffer
+		// b) We are a short string, using our internal buffer
+		// OR:
+		// c) We are a StackString, and we should point to our internal buffer
 		ASSERT( ( m_Contents == s_EmptyString ) ||
+				( m_Contents == m_ShortString ) ||
 			    ( (void *)m_Contents == (void *)( (char *)this + sizeof( AString ) ) ) );
 	}
 }
@@ -156,13 +193,8 @@ int32_t AString::Compare( const AString & other ) const
 //------------------------------------------------------------------------------
 int32_t AString::CompareI( const AString & other ) const
 {
-    #if defined( __WINDOWS__ )
-        return _stricmp( m_Contents, other.Get() );
-    #elif defined( __APPLE__ ) || defined( __LINUX__ )
-        return strcasecmp( m_Contents, other.Get() );
-    #else
-        #error Unknown platform
-    #endif
+	// compare including the terminator of the shorter string
+	return MemCmpI( m_Contents, other.Get(), Math::Min( m_Length, other.GetLength() ) + 1 );
 }
 
 // Format
@@ -319,6 +351,7 @@ void AString::Assign( const char * string )
 void AString::Assign( const char * start, const char * end )
 {
 	ASSERT( start <= end );
+	m_HashLower = 0;
 	uint32_t len = uint32_t( end - start );
 	if ( len > GetReserved() )
 	{
@@ -338,6 +371,7 @@ void AString::Assign( const char * start, const char * end )
 //------------------------------------------------------------------------------
 void AString::Assign( const AString & string )
 {
+	m_HashLower = string.m_HashLower;
 	uint32_t len = string.GetLength();
 	if ( len > GetReserved() )
 	{
@@ -357,6 +391,8 @@ void AString::Assign( const AString & string )
 //------------------------------------------------------------------------------
 void AString::Clear()
 {
+	m_HashLower = 0;
+
 	// handle the special case empty string with no mem usage
 	if ( m_Contents == s_EmptyString )
 	{
@@ -386,6 +422,7 @@ void AString::SetReserved( size_t capacity )
 //------------------------------------------------------------------------------
 void AString::SetLength( uint32_t len )
 {
+	m_HashLower = 0;
 	if ( len > GetReserved() )
 	{
 		Grow( len );
@@ -407,6 +444,8 @@ void AString::SetLength( uint32_t len )
 //------------------------------------------------------------------------------
 AString & AString::operator += ( char c )
 {
+	m_HashLower = 0;
+
 	// need more space?
 	if ( m_Length >= GetReserved() )
 	{
@@ -425,6 +464,7 @@ AString & AString::operator += ( const char * string )
 	uint32_t suffixLen = (uint32_t)StrLen( string );
 	if ( suffixLen )
 	{
+		m_HashLower = 0;
 		uint32_t newLen = m_Length + suffixLen;
 		if ( newLen > GetReserved() )
 		{
@@ -444,6 +484,7 @@ AString & AString::operator += ( const AString & string )
 	uint32_t suffixLen = string.GetLength();
 	if ( suffixLen )
 	{
+		m_HashLower = 0;
 		uint32_t newLen = m_Length + suffixLen;
 		if ( newLen > GetReserved() )
 		{
@@ -462,6 +503,7 @@ void AString::Append( const char * string, size_t len )
 {
 	if ( len )
 	{
+		m_HashLower = 0;
 		uint32_t newLen = m_Length + (uint32_t)len;
 		if ( newLen > GetReserved() )
 		{
@@ -498,6 +540,7 @@ uint32_t AString::Replace( char from, char to, uint32_t maxReplaces )
 		if ( *pos == from )
 		{
 			*pos = to;
+			m_HashLower = 0;
 			replaceCount++;
 			if ( replaceCount == maxReplaces )
 			{
@@ -513,18 +556,8 @@ uint32_t AString::Replace( char from, char to, uint32_t maxReplaces )
 //------------------------------------------------------------------------------
 void AString::ToLower()
 {
-	char * pos = m_Contents;
-	char * end = m_Contents + m_Length;
-	while ( pos < end )
-	{
-		char c = *pos;
-		if ( ( c >= 'A' ) && ( c <= 'Z' ) )
-		{
-			c = 'a' + ( c - 'A' );
-			*pos = c;
-		}
-		pos++;
-	}
+	// NOTE: case changes don't affect the cached (case-insensitive) hash
+	CopyLower( m_Contents, m_Contents, m_Length );
 }
 
 // ToUpper
@@ -714,7 +747,7 @@ bool AString::EndsWith( const char * string ) const
 	{
 		return false; // string to search is longer than this string
 	}
-	return ( StrNCmp( possiblePos, string, stringLen ) == 0 );
+	return ( memcmp( possiblePos, string, stringLen ) == 0 );
 }
 
 // EndsWith
@@ -726,7 +759,7 @@ bool AString::EndsWith( const AString & other ) const
     {
         return false;
     }
-    return ( StrNCmp( GetEnd() - otherLen, other.Get(), otherLen ) == 0 );
+    return ( memcmp( GetEnd() - otherLen, other.Get(), otherLen ) == 0 );
 }
 
 // EndsWithI
@@ -738,7 +771,7 @@ bool AString::EndsWithI( const char * other ) const
 	{
 		return false;
 	}
-	return ( StrNCmpI( GetEnd() - otherLen, other, otherLen ) == 0 );
+	return ( MemCmpI( GetEnd() - otherLen, other, otherLen ) == 0 );
 }
 
 // EnsWithI
@@ -750,7 +783,7 @@ bool AString::EndsWithI( const AString & other ) const
 	{
 		return false;
 	}
-	return ( StrNCmpI( GetEnd() - otherLen, other.Get(), otherLen ) == 0 );
+	return ( MemCmpI( GetEnd() - otherLen, other.Get(), otherLen ) == 0 );
 }
 
 // BeginsWith
@@ -773,7 +806,7 @@ bool AString::BeginsWith( const char * string ) const
 	{
 		return false;
 	}
-	return ( StrNCmp( m_Contents, string, otherLen ) == 0 );
+	return ( memcmp( m_Contents, string, otherLen ) == 0 );
 }
 
 // BeginsWith
@@ -785,7 +818,7 @@ bool AString::BeginsWith( const AString & string ) const
 	{
 		return false;
 	}
-	return ( StrNCmp( m_Contents, string.Get(), otherLen ) == 0 );
+	return ( memcmp( m_Contents, string.Get(), otherLen ) == 0 );
 }
 
 // BeginsWithI
@@ -797,7 +830,7 @@ bool AString::BeginsWithI( const char * string ) const
 	{
 		return false;
 	}
-	return ( StrNCmpI( m_Contents, string, otherLen ) == 0 );
+	return ( MemCmpI( m_Contents, string, otherLen ) == 0 );
 }
 
 // BeginsWithI
@@ -809,7 +842,7 @@ bool AString::BeginsWithI( const AString & string ) const
 	{
 		return false;
 	}
-	return ( StrNCmpI( m_Contents, string.Get(), otherLen ) == 0 );
+	return ( MemCmpI( m_Contents, string.Get(), otherLen ) == 0 );
 }
 
 // Match
@@ -984,10 +1017,111 @@ test_match:
 	return 0; // strings identical upto 'num' chars
 }
 
+// MemCmpI
+//------------------------------------------------------------------------------
+/*static*/ int32_t AString::MemCmpI( const char * a, const char * b, size_t num )
+{
+	size_t i = 0;
+
+	#if defined( ASTRING_USE_SSE2 )
+		for ( ; ( i + 16 ) <= num; i += 16 )
+		{
+			const __m128i a16 = ToLowerSSE2( _mm_loadu_si128( (const __m128i *)( a + i ) ) );
+			const __m128i b16 = ToLowerSSE2( _mm_loadu_si128( (const __m128i *)( b + i ) ) );
+			const uint32_t equalMask = (uint32_t)_mm_movemask_epi8( _mm_cmpeq_epi8( a16, b16 ) );
+			if ( equalMask != 0xFFFF )
+			{
+				i += FirstSetBit( ~equalMask );
+				return ( (uint8_t)ToLowerASCII( a[ i ] ) - (uint8_t)ToLowerASCII( b[ i ] ) );
+			}
+		}
+	#endif
+
+	for ( ; i < num; ++i )
+	{
+		const char a1 = ToLowerASCII( a[ i ] );
+		const char b1 = ToLowerASCII( b[ i ] );
+		if ( a1 != b1 )
+		{
+			return ( (uint8_t)a1 - (uint8_t)b1 );
+		}
+	}
+	return 0;
+}
+
+// CopyLower
+//------------------------------------------------------------------------------
+/*static*/ void AString::CopyLower( const char * src, char * dst, size_t len )
+{
+	size_t i = 0;
+
+	#if defined( ASTRING_USE_SSE2 )
+		for ( ; ( i + 16 ) <= len; i += 16 )
+		{
+			const __m128i chars = _mm_loadu_si128( (const __m128i *)( src + i ) );
+			_mm_storeu_si128( (__m128i *)( dst + i ), ToLowerSSE2( chars ) );
+		}
+	#endif
+
+	for ( ; i < len; ++i )
+	{
+		dst[ i ] = ToLowerASCII( src[ i ] );
+	}
+}
+
+// FindFirstOf
+//------------------------------------------------------------------------------
+/*static*/ const char * AString::FindFirstOf( const char * pos, const char * end, char c1, char c2, char c3 )
+{
+	#if defined( ASTRING_USE_SSE2 )
+		const __m128i c1x16 = _mm_set1_epi8( c1 );
+		const __m128i c2x16 = _mm_set1_epi8( c2 );
+		const __m128i c3x16 = _mm_set1_epi8( c3 );
+		for ( ; ( pos + 16 ) <= end; pos += 16 )
+		{
+			const __m128i chars = _mm_loadu_si128( (const __m128i *)pos );
+			const __m128i match = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( chars, c1x16 ),
+															   _mm_cmpeq_epi8( chars, c2x16 ) ),
+												_mm_cmpeq_epi8( chars, c3x16 ) );
+			const uint32_t matchMask = (uint32_t)_mm_movemask_epi8( match );
+			if ( matchMask )
+			{
+				return ( pos + FirstSetBit( matchMask ) );
+			}
+		}
+	#endif
+
+	for ( ; pos < end; ++pos )
+	{
+		const char c = *pos;
+		if ( ( c == c1 ) || ( c == c2 ) || ( c == c3 ) )
+		{
+			break;
+		}
+	}
+	return pos;
+}
+
 // Grow
 //------------------------------------------------------------------------------
 void AString::Grow( uint32_t newLength )
 {
+	// short enough to use internal buffer?
+	if ( newLength <= SHORT_STRING_CAPACITY )
+	{
+		if ( m_Contents != m_ShortString )
+		{
+			Copy( m_Contents, m_ShortString, m_Length );
+			if ( MemoryMustBeFreed() )
+			{
+				FREE( m_Contents );
+			}
+			m_Contents = m_ShortString;
+			SetReserved( SHORT_STRING_CAPACITY, false );
+		}
+		return;
+	}
+
 	// allocate space, rounded up to multiple of 2
 	const uint32_t amortizedReserve = ( GetReserved() * 2 );
 	const uint32_t reserve = Math::RoundUp( Math::Max( amortizedReserve, newLength ),(uint32_t)2 );
@@ -1014,10 +1148,27 @@ void AString::GrowNoCopy( uint32_t newLength )
 		FREE( m_Contents );
 	}
 
+	// short enough to use internal buffer?
+	if ( newLength <= SHORT_STRING_CAPACITY )
+	{
+		m_Contents = m_ShortString;
+		SetReserved( SHORT_STRING_CAPACITY, false );
+		return;
+	}
+
 	// allocate space, rounded up to multiple of 2
 	uint32_t reserve = Math::RoundUp( newLength, (uint32_t)2 );
 	m_Contents = (char *)ALLOC( reserve + 1 ); // also allocate for \0 terminator
 	SetReserved( reserve, true );
 }
 
+// CalcHashLower
+//------------------------------------------------------------------------------
+uint32_t AString::CalcHashLower() const
+{
+	// NOTE: a hash of 0 is not cached (and so will be recalculated on each use)
+	m_HashLower = CRC32::CalcLower( m_Contents, m_Length );
+	return m_HashLower;
+}
+
 //------------------------------------------------------------------------------
@@ -37,13 +37,18 @@ public:
 	inline bool			IsEmpty() const		{ return ( m_Length == 0 ); }
 
 	// C-style compatibility
-	inline char *		Get()				{ return m_Contents; }
+	// NOTE: non-const access discards the cached hash, as the contents may be modified
+	inline char *		Get()				{ m_HashLower = 0; return m_Contents; }
 	inline const char * Get() const			{ return m_Contents; }
-	inline char *		GetEnd()			{ return ( m_Contents + m_Length ); }
+	inline char *		GetEnd()			{ m_HashLower = 0; return ( m_Contents + m_Length ); }
 	inline const char *	GetEnd() const		{ return ( m_Contents + m_Length ); }
-	inline char &		operator [] ( size_t index )		{ ASSERT( index < m_Length ); return m_Contents[ index ]; }
+	inline char &		operator [] ( size_t index )		{ ASSERT( index < m_Length ); m_HashLower = 0; return m_Contents[ index ]; }
 	inline const char & operator [] ( size_t index )  const { ASSERT( index < m_Length ); return m_Contents[ index ]; }
 
+	// case-insensitive hash (CRC32::CalcLower), calculated on first use and
+	// cached until the string is modified
+	inline uint32_t		GetHashLower() const { return m_HashLower ? m_HashLower : CalcHashLower(); }
+
 	// a pre-constructed global empty string for convenience
 	static const AString & GetEmpty() { return s_EmptyAString; }
 
@@ -94,12 +99,12 @@ public:
 
 	// searching
 	const char *	Find( char c, const char * startPos = nullptr ) const;
-	char *			Find( char c, char * startPos = nullptr ) { return const_cast< char *>( ((const AString *)this)->Find( c, startPos ) ); }
+	char *			Find( char c, char * startPos = nullptr ) { m_HashLower = 0; return const_cast< char *>( ((const AString *)this)->Find( c, startPos ) ); }
 	const char *	Find( const char * subString ) const;
-	char *			Find( const char * subString ) { return const_cast< char *>( ((const AString *)this)->Find( subString ) ); }
+	char *			Find( const char * subString ) { m_HashLower = 0; return const_cast< char *>( ((const AString *)this)->Find( subString ) ); }
 	const char *	FindI( const char * subString ) const;
 	const char *	FindLast( char c ) const;
-	char *			FindLast( char c ) { return const_cast< char *>( ((const AString *)this)->FindLast( c ) ); }
+	char *			FindLast( char c ) { m_HashLower = 0; return const_cast< char *>( ((const AString *)this)->FindLast( c ) ); }
 	bool			EndsWith( char c ) const;
 	bool			EndsWith( const char * string ) const;
     bool            EndsWith( const AString & other ) const;
@@ -123,6 +128,15 @@ public:
 	static int32_t StrNCmp( const char * a, const char * b, size_t num );
 	static int32_t StrNCmpI( const char * a, const char * b, size_t num );
 
+	// bulk helpers (vectorized where supported)
+	static int32_t MemCmpI( const char * a, const char * b, size_t num ); // compares exactly 'num' chars, ignoring terminators
+	static void CopyLower( const char * src, char * dst, size_t len ); // src and dst may be the same
+	static const char * FindFirstOf( const char * pos, const char * end, char c1, char c2, char c3 ); // returns end if not found
+
+	// strings up to this length are stored internally, without allocating
+	enum : uint32_t { SHORT_STRING_CAPACITY		= 26 };
+	inline bool IsShortString() const { return ( m_Contents == m_ShortString ); }
+
 protected:
 	enum : uint32_t { MEM_MUST_BE_FREED_FLAG	= 0x00000001 };
 	enum : uint32_t { RESERVED_MASK				= 0xFFFFFFFE };
@@ -134,10 +148,13 @@ protected:
 	}
 	NO_INLINE void Grow( uint32_t newLen );		// Grow capacity, transferring existing string data (for concatenation)
 	NO_INLINE void GrowNoCopy( uint32_t newLen ); // Grow capacity, discarding existing string data (for assignment/construction)
+	uint32_t CalcHashLower() const;
 
 	char *		m_Contents;			// always points to valid null terminated string (even when empty)
 	uint32_t	m_Length;			// length in characters
 	uint32_t	m_ReservedAndFlags;	// reserved space in characters (even) and least significant bit used for static flag
+	mutable uint32_t m_HashLower;	// cached result of GetHashLower, or 0 if not yet calculated
+	char		m_ShortString[ SHORT_STRING_CAPACITY + 2 ]; // storage for short strings (+1 for terminator, +1 for alignment)
 
 	static const char * const   s_EmptyString;
 	static const AString	s_EmptyAString;
@@ -98,6 +98,7 @@ int Main(int argc, char * argv[])
 	// handle cmd line args
 	Array< AString > targets( 8, true );
 	bool cleanBuild = false;
+	bool contentHash = false;
 	bool verbose = false;
 	bool progressBar = true;
 	bool useCacheRead = false;
@@ -114,6 +115,7 @@ int Main(int argc, char * argv[])
 	WrapperMode wrapperMode( WRAPPER_MODE_NONE );
 	AStackString<> args;
 	const char * configFile = nullptr;
+	const char * traceFile = nullptr;
 	for ( int32_t i=1; i<argc; ++i ) // start from 1 to skip exe name
 	{
 		AStackString<> thisArg( argv[ i ] );
@@ -161,6 +163,11 @@ int Main(int argc, char * argv[])
 				args += ' ';
 				continue;
 			}
+			else if ( thisArg == "-contenthash" )
+			{
+				contentHash = true;
+				continue;
+			}
 			#ifdef DEBUG
 				else if ( thisArg == "-debug" )
 				{
@@ -228,6 +235,23 @@ int Main(int argc, char * argv[])
 				showSummary = true;
 				continue;
 			}
+			else if ( thisArg == "-trace" )
+			{
+				int pathIndex = ( i + 1 );
+				if ( pathIndex >= argc )
+				{
+					OUTPUT( "FBuild: Error: Missing <path> for '-trace' argument\n" );
+					OUTPUT( "Try \"FBuild.exe -help\"\n" );
+					return FBUILD_BAD_ARGS;
+				}
+				traceFile = argv[ pathIndex ];
+				i++; // skip extra arg we've consumed
+
+				// add to args we might pass to subprocess
+				args += traceFile;
+				args += ' ';
+				continue;
+			}
 			else if ( thisArg == "-verbose" ) 
 			{
 				verbose = true;
@@ -406,12 +430,17 @@ int Main(int argc, char * argv[])
 		options.m_NumWorkerThreads = numWorkers;
 	}
 	options.m_ForceCleanBuild = cleanBuild; 
+	options.m_UseContentHashing = contentHash;
 	options.m_AllowDistributed = allowDistributed;
 	options.m_ShowSummary = showSummary;
 	if ( configFile )
 	{
 		options.m_ConfigFile = configFile;
 	}
+	if ( traceFile )
+	{
+		options.m_TraceFile = traceFile;
+	}
 	options.m_SaveDBOnCompletion = true;
 	options.m_GenerateReport = report;
 	options.m_WrapperChild = ( wrapperMode == WRAPPER_MODE_FINAL_PROCESS );
@@ -479,7 +508,9 @@ void DisplayHelp()
 			"Options:\n"
 			" -cache[read|write] Control use of the build cache.\n"
 			" -clean	     Force a clean build.\n"
-			" -config [path] Explicitly specify the config file to use\n" );
+			" -config [path] Explicitly specify the config file to use\n"
+			" -contenthash   Don't rebuild dependents of outputs which were rebuilt\n"
+			"                with unchanged contents.\n" );
 #ifdef DEBUG
 	OUTPUT( " -debug         Break at startup, to attach debugger.\n" );
 #endif
@@ -500,6 +531,8 @@ void DisplayHelp()
 			" -showcmds      Show command lines used to launch external processes.\n"
 			" -showtargets   Display list of primary build targets.\n"
 			" -summary       Show a summary at the end of the build.\n"
+			" -trace [path]  Write a timeline of the build to the given file,\n"
+			"                in Chrome trace format (chrome://tracing).\n"
 			" -verbose       Show detailed diagnostic information. This will slow\n"
 			"                down building.\n"
 			" -version       Print version and exit. No other work will be\n"
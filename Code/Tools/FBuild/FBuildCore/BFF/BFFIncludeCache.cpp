@@ -0,0 +1,452 @@
+// BFFIncludeCache
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Tools/FBuild/FBuildCore/PrecompiledHeader.h"
+
+#include "BFFIncludeCache.h"
+#include "BFFStackFrame.h"
+#include "BFFVariable.h"
+#include "Tools/FBuild/FBuildCore/FLog.h"
+
+// Core
+#include "Core/FileIO/IOStream.h"
+#include "Core/FileIO/PathUtils.h"
+#include "Core/Mem/Mem.h"
+#include "Core/Strings/AStackString.h"
+
+// Static Data
+//------------------------------------------------------------------------------
+/*static*/ BFFIncludeCache * BFFIncludeCache::s_ActiveRecording( nullptr );
+
+// CONSTRUCTOR
+//------------------------------------------------------------------------------
+BFFIncludeCache::BFFIncludeCache()
+: m_Entries( 0, true )
+, m_Recording( nullptr )
+, m_RecordingFrame( nullptr )
+, m_RecordingWrites( 0, true )
+, m_NumReplayed( 0 )
+, m_NumRecorded( 0 )
+{
+}
+
+// DESTRUCTOR
+//------------------------------------------------------------------------------
+BFFIncludeCache::~BFFIncludeCache()
+{
+	if ( m_Recording )
+	{
+		AbortRecording();
+	}
+
+	for ( Entry * entry : m_Entries )
+	{
+		DeleteEntry( entry );
+	}
+}
+
+// Load
+//------------------------------------------------------------------------------
+bool BFFIncludeCache::Load( IOStream & stream )
+{
+	ASSERT( m_Entries.IsEmpty() );
+
+	uint32_t numEntries;
+	if ( stream.Read( numEntries ) == false )
+	{
+		return false;
+	}
+	m_Entries.SetCapacity( numEntries );
+	for ( uint32_t i = 0; i < numEntries; ++i )
+	{
+		Entry * entry = CreateEntry();
+		m_Entries.Append( entry ); // freed by destructor if we fail
+
+		uint32_t numReads;
+		if ( ( stream.Read( entry->m_FileName ) == false ) ||
+			 ( stream.Read( entry->m_DataHash ) == false ) ||
+			 ( stream.Read( entry->m_Once ) == false ) ||
+			 ( stream.Read( numReads ) == false ) )
+		{
+			return false;
+		}
+		entry->m_Reads.SetSize( numReads );
+		for ( Read & read : entry->m_Reads )
+		{
+			uint8_t kind;
+			if ( ( stream.Read( read.m_Name ) == false ) ||
+				 ( stream.Read( read.m_ValueHash ) == false ) ||
+				 ( stream.Read( kind ) == false ) ||
+				 ( kind > READ_PARENT ) )
+			{
+				return false;
+			}
+			read.m_Kind = (ReadKind)kind;
+		}
+
+		uint32_t numWrites;
+		if ( stream.Read( numWrites ) == false )
+		{
+			return false;
+		}
+		entry->m_Writes.SetCapacity( numWrites );
+		for ( uint32_t j = 0; j < numWrites; ++j )
+		{
+			BFFVariable * var = BFFVariable::Load( stream );
+			if ( var == nullptr )
+			{
+				return false;
+			}
+			entry->m_Writes.Append( var );
+		}
+	}
+
+	return true;
+}
+
+// Save
+//------------------------------------------------------------------------------
+void BFFIncludeCache::Save( IOStream & stream ) const
+{
+	ASSERT( m_Recording == nullptr );
+
+	stream.Write( (uint32_t)m_Entries.GetSize() );
+	for ( const Entry * entry : m_Entries )
+	{
+		stream.Write( entry->m_FileName );
+		stream.Write( entry->m_DataHash );
+		stream.Write( entry->m_Once );
+		stream.Write( (uint32_t)entry->m_Reads.GetSize() );
+		for ( const Read & read : entry->m_Reads )
+		{
+			stream.Write( read.m_Name );
+			stream.Write( read.m_ValueHash );
+			stream.Write( (uint8_t)read.m_Kind );
+		}
+		stream.Write( (uint32_t)entry->m_Writes.GetSize() );
+		for ( const BFFVariable * var : entry->m_Writes )
+		{
+			var->Save( stream );
+		}
+	}
+}
+
+// Swap
+//------------------------------------------------------------------------------
+void BFFIncludeCache::Swap( BFFIncludeCache & other )
+{
+	ASSERT( ( m_Recording == nullptr ) && ( other.m_Recording == nullptr ) );
+	m_Entries.Swap( other.m_Entries );
+}
+
+// RemoveUnused
+//------------------------------------------------------------------------------
+void BFFIncludeCache::RemoveUnused()
+{
+	size_t i = 0;
+	while ( i < m_Entries.GetSize() )
+	{
+		Entry * entry = m_Entries[ i ];
+		if ( entry->m_Used )
+		{
+			entry->m_Used = false; // ready for next parse
+			++i;
+			continue;
+		}
+		DeleteEntry( entry );
+		m_Entries.EraseIndex( i );
+	}
+}
+
+// Replay
+//------------------------------------------------------------------------------
+bool BFFIncludeCache::Replay( const AString & fileName, uint64_t dataHash, BFFStackFrame * frame, bool & outOnce )
+{
+	ASSERT( frame );
+
+	for ( Entry * entry : m_Entries )
+	{
+		if ( ( entry->m_DataHash != dataHash ) ||
+			 ( PathUtils::ArePathsEqual( entry->m_FileName, fileName ) == false ) )
+		{
+			continue;
+		}
+
+		if ( Validate( *entry, frame ) == false )
+		{
+			continue; // variables used by include have changed
+		}
+
+		// apply the result of the include
+		for ( const BFFVariable * var : entry->m_Writes )
+		{
+			BFFStackFrame::SetVar( var, frame );
+		}
+
+		entry->m_Used = true;
+		outOnce = entry->m_Once;
+		++m_NumReplayed;
+
+		FLOG_INFO( "Include '%s' replayed from cache (%u variables)", fileName.Get(), (uint32_t)entry->m_Writes.GetSize() );
+		return true;
+	}
+
+	return false;
+}
+
+// BeginRecording
+//------------------------------------------------------------------------------
+void BFFIncludeCache::BeginRecording( const AString & fileName, uint64_t dataHash, BFFStackFrame * frame )
+{
+	ASSERT( s_ActiveRecording == nullptr ); // nested includes should have aborted the recording
+	ASSERT( m_Recording == nullptr );
+	ASSERT( frame );
+
+	m_Recording = CreateEntry();
+	m_Recording->m_FileName = fileName;
+	m_Recording->m_DataHash = dataHash;
+	m_RecordingFrame = frame;
+	s_ActiveRecording = this;
+}
+
+// EndRecording
+//------------------------------------------------------------------------------
+void BFFIncludeCache::EndRecording( bool parseOK, bool once )
+{
+	if ( m_Recording == nullptr )
+	{
+		return; // recording was aborted
+	}
+
+	if ( parseOK == false )
+	{
+		AbortRecording();
+		return;
+	}
+
+	// take a copy of the final value of everything that was written
+	Entry * entry = m_Recording;
+	entry->m_Writes.SetCapacity( m_RecordingWrites.GetSize() );
+	for ( const AString & name : m_RecordingWrites )
+	{
+		const BFFVariable * var = m_RecordingFrame->GetLocalVar( name );
+		ASSERT( var );
+		entry->m_Writes.Append( FNEW( BFFVariable( *var ) ) ); // shares value
+	}
+	entry->m_Once = once;
+	entry->m_Used = true;
+
+	m_Recording = nullptr;
+	m_RecordingFrame = nullptr;
+	m_RecordingWrites.Clear();
+	s_ActiveRecording = nullptr;
+
+	// discard oldest variation of this include if we have too many
+	Entry ** oldest = nullptr;
+	uint32_t numForFile = 0;
+	for ( Entry ** it = m_Entries.Begin(); it != m_Entries.End(); ++it )
+	{
+		if ( PathUtils::ArePathsEqual( ( *it )->m_FileName, entry->m_FileName ) )
+		{
+			oldest = oldest ? oldest : it;
+			++numForFile;
+		}
+	}
+	if ( numForFile >= MAX_ENTRIES_PER_FILE )
+	{
+		DeleteEntry( *oldest );
+		m_Entries.Erase( oldest );
+	}
+
+	m_Entries.Append( entry );
+	++m_NumRecorded;
+}
+
+// OnUncacheable
+//------------------------------------------------------------------------------
+/*static*/ void BFFIncludeCache::OnUncacheable( const char * reason )
+{
+	if ( s_ActiveRecording )
+	{
+		FLOG_INFO( "Include '%s' cannot be cached (%s)", s_ActiveRecording->m_Recording->m_FileName.Get(), reason );
+		s_ActiveRecording->AbortRecording();
+	}
+}
+
+// RecordRead
+//------------------------------------------------------------------------------
+void BFFIncludeCache::RecordRead( const AString & name, const BFFVariable * var,
+								  const BFFStackFrame * startFrame, const BFFStackFrame * foundFrame, bool recursive )
+{
+	ASSERT( m_Recording );
+
+	if ( ( startFrame == m_RecordingFrame ) || IsInternalFrame( startFrame ) )
+	{
+		// lookups resolved within scopes created by the include depend only on the include
+		if ( recursive ? ( foundFrame && ( foundFrame != m_RecordingFrame ) && IsInternalFrame( foundFrame ) )
+					   : ( startFrame != m_RecordingFrame ) )
+		{
+			return;
+		}
+
+		// as do lookups of anything the include has already written
+		if ( IsWritten( name ) )
+		{
+			return;
+		}
+
+		AddRead( name, var, recursive ? READ_RECURSIVE : READ_LOCAL );
+		return;
+	}
+
+	if ( recursive && ( startFrame == m_RecordingFrame->GetParent() ) )
+	{
+		AddRead( name, var, READ_PARENT );
+		return;
+	}
+
+	// some other access we can't reason about
+	OnUncacheable( "access to outer scope" );
+}
+
+// RecordWrite
+//------------------------------------------------------------------------------
+void BFFIncludeCache::RecordWrite( const AString & name, const BFFStackFrame * frame )
+{
+	ASSERT( m_Recording );
+
+	if ( frame == m_RecordingFrame )
+	{
+		if ( IsWritten( name ) == false )
+		{
+			m_RecordingWrites.Append( name );
+		}
+		return;
+	}
+
+	if ( IsInternalFrame( frame ) )
+	{
+		return; // scope created by the include, discarded before it ends
+	}
+
+	// modification of a parent scope with ^
+	OnUncacheable( "modifies outer scope" );
+}
+
+// AddRead
+//------------------------------------------------------------------------------
+void BFFIncludeCache::AddRead( const AString & name, const BFFVariable * var, ReadKind kind )
+{
+	// each lookup only needs to be recorded once, since the include
+	// can't have changed the result
+	for ( const Read & read : m_Recording->m_Reads )
+	{
+		if ( ( read.m_Kind == kind ) && ( read.m_Name == name ) )
+		{
+			return;
+		}
+	}
+
+	Read read;
+	read.m_Name = name;
+	read.m_ValueHash = var ? var->CalcValueHash() : 0;
+	read.m_Kind = kind;
+	m_Recording->m_Reads.Append( read );
+}
+
+// AbortRecording
+//------------------------------------------------------------------------------
+void BFFIncludeCache::AbortRecording()
+{
+	ASSERT( m_Recording );
+	DeleteEntry( m_Recording );
+	m_Recording = nullptr;
+	m_RecordingFrame = nullptr;
+	m_RecordingWrites.Clear();
+	if ( s_ActiveRecording == this )
+	{
+		s_ActiveRecording = nullptr;
+	}
+}
+
+// IsInternalFrame
+//------------------------------------------------------------------------------
+bool BFFIncludeCache::IsInternalFrame( const BFFStackFrame * frame ) const
+{
+	// frames pushed since the include started
+	for ( const BFFStackFrame * f = BFFStackFrame::GetCurrent(); f && ( f != m_RecordingFrame ); f = f->GetParent() )
+	{
+		if ( f == frame )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// IsWritten
+//------------------------------------------------------------------------------
+bool BFFIncludeCache::IsWritten( const AString & name ) const
+{
+	return ( m_RecordingWrites.Find( name ) != nullptr );
+}
+
+// Validate
+//------------------------------------------------------------------------------
+bool BFFIncludeCache::Validate( const Entry & entry, BFFStackFrame * frame ) const
+{
+	// everything the include looked at must be unchanged
+	for ( const Read & read : entry.m_Reads )
+	{
+		const BFFVariable * var = nullptr;
+		switch ( read.m_Kind )
+		{
+			case READ_RECURSIVE:	var = frame->GetVariableRecurse( read.m_Name ); break;
+			case READ_LOCAL:		var = frame->GetLocalVar( read.m_Name ); break;
+			case READ_PARENT:		var = frame->GetParent() ? frame->GetParent()->GetVariableRecurse( read.m_Name ) : nullptr; break;
+		}
+		const uint64_t valueHash = var ? var->CalcValueHash() : 0;
+		if ( valueHash != read.m_ValueHash )
+		{
+			return false;
+		}
+	}
+
+	// can't replay over frozen variables (parse will report the error)
+	for ( const BFFVariable * write : entry.m_Writes )
+	{
+		const BFFVariable * var = frame->GetLocalVar( write->GetName() );
+		if ( var && var->Frozen() )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// CreateEntry
+//------------------------------------------------------------------------------
+/*static*/ BFFIncludeCache::Entry * BFFIncludeCache::CreateEntry()
+{
+	Entry * entry = FNEW( Entry );
+	entry->m_DataHash = 0;
+	entry->m_Once = false;
+	entry->m_Used = false;
+	return entry;
+}
+
+// DeleteEntry
+//------------------------------------------------------------------------------
+/*static*/ void BFFIncludeCache::DeleteEntry( Entry * entry )
+{
+	for ( BFFVariable * var : entry->m_Writes )
+	{
+		FDELETE var;
+	}
+	FDELETE entry;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,119 @@
+// BFFIncludeCache - persistent results of parsing #include files
+//------------------------------------------------------------------------------
+#pragma once
+#ifndef FBUILD_INCLUDECACHE_H
+#define FBUILD_INCLUDECACHE_H
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/Containers/Array.h"
+#include "Core/Strings/AString.h"
+
+// Forward Declarations
+//------------------------------------------------------------------------------
+class BFFStackFrame;
+class BFFVariable;
+class IOStream;
+
+// BFFIncludeCache
+//------------------------------------------------------------------------------
+// Included files which only manipulate variables (no functions which create
+// nodes, no directives other than #once) have their effects recorded: the
+// variables they read from the enclosing scope (with a hash of the value) and
+// the final value of each variable they write. When the BFF is re-parsed, an
+// unchanged include whose inputs are also unchanged is replayed from this
+// record instead of being parsed again.
+class BFFIncludeCache
+{
+public:
+	explicit BFFIncludeCache();
+	~BFFIncludeCache();
+
+	// persistence (as part of the NodeGraph DB)
+	bool Load( IOStream & stream );
+	void Save( IOStream & stream ) const;
+
+	void Swap( BFFIncludeCache & other );
+
+	// discard entries which were not used by the last parse
+	void RemoveUnused();
+
+	// apply previously recorded effects of an include to the given frame
+	// (returns false if there is no matching record)
+	bool Replay( const AString & fileName, uint64_t dataHash, BFFStackFrame * frame, bool & outOnce );
+
+	// record the effects of parsing an include
+	void BeginRecording( const AString & fileName, uint64_t dataHash, BFFStackFrame * frame );
+	void EndRecording( bool parseOK, bool once );
+
+	// notifications from parsing (affect the active recording, if any)
+	inline static void OnVarRead( const AString & name, const BFFVariable * var,
+								  const BFFStackFrame * startFrame, const BFFStackFrame * foundFrame, bool recursive )
+	{
+		if ( s_ActiveRecording ) { s_ActiveRecording->RecordRead( name, var, startFrame, foundFrame, recursive ); }
+	}
+	inline static void OnVarWrite( const AString & name, const BFFStackFrame * frame )
+	{
+		if ( s_ActiveRecording ) { s_ActiveRecording->RecordWrite( name, frame ); }
+	}
+	static void OnUncacheable( const char * reason );
+	inline static bool IsRecording() { return ( s_ActiveRecording != nullptr ); }
+
+	// stats
+	inline uint32_t GetNumReplayed() const { return m_NumReplayed; }
+	inline uint32_t GetNumRecorded() const { return m_NumRecorded; }
+
+private:
+	enum ReadKind
+	{
+		READ_RECURSIVE	= 0, // from the include's scope upwards
+		READ_LOCAL		= 1, // the include's scope only
+		READ_PARENT		= 2, // from the parent of the include's scope upwards
+	};
+	struct Read
+	{
+		AString		m_Name;
+		uint64_t	m_ValueHash; // 0 if variable did not exist
+		ReadKind	m_Kind;
+	};
+	struct Entry
+	{
+		AString			m_FileName;
+		uint64_t		m_DataHash;
+		bool			m_Once;
+		bool			m_Used;
+		Array< Read >	m_Reads;
+		Array< BFFVariable * > m_Writes; // final value of each variable written (owned)
+	};
+
+	// limit number of variations of each include we keep
+	enum { MAX_ENTRIES_PER_FILE = 8 };
+
+	void RecordRead( const AString & name, const BFFVariable * var,
+					 const BFFStackFrame * startFrame, const BFFStackFrame * foundFrame, bool recursive );
+	void RecordWrite( const AString & name, const BFFStackFrame * frame );
+	void AddRead( const AString & name, const BFFVariable * var, ReadKind kind );
+	void AbortRecording();
+
+	bool IsInternalFrame( const BFFStackFrame * frame ) const;
+	bool IsWritten( const AString & name ) const;
+	bool Validate( const Entry & entry, BFFStackFrame * frame ) const;
+
+	static Entry * CreateEntry();
+	static void DeleteEntry( Entry * entry );
+
+	Array< Entry * > m_Entries;
+
+	// active recording
+	Entry *			m_Recording;
+	BFFStackFrame *	m_RecordingFrame;
+	Array< AString > m_RecordingWrites;
+
+	uint32_t		m_NumReplayed;
+	uint32_t		m_NumRecorded;
+
+	static BFFIncludeCache * s_ActiveRecording;
+};
+
+//------------------------------------------------------------------------------
+#endif // FBUILD_INCLUDECACHE_H
@@ -6,6 +6,7 @@
 #include "Tools/FBuild/FBuildCore/PrecompiledHeader.h"
 
 #include "BFFParser.h"
+#include "BFFIncludeCache.h"
 #include "BFFIterator.h"
 #include "BFFMacros.h"
 #include "BFFStackFrame.h"
@@ -579,6 +580,11 @@ bool BFFParser::ParseFunction( BFFIterator & iter )
 
 	FLOG_INFO( "Function call '%s'", functionName.Get() );
 
+	if ( func->AffectsOnlyVariables() == false )
+	{
+		BFFIncludeCache::OnUncacheable( "function call" );
+	}
+
 	// header, or body?
 	bool hasHeader = false;
 	BFFIterator functionArgsStartToken( iter );
@@ -700,6 +706,11 @@ bool BFFParser::ParsePreprocessorDirective( BFFIterator & iter )
 
 	// determine directive
 	AStackString< MAX_DIRECTIVE_NAME_LENGTH > directive( directiveStartIter.GetCurrent(), directiveEndIter.GetCurrent() );
+	if ( directive != "once" )
+	{
+		BFFIncludeCache::OnUncacheable( "preprocessor directive" );
+	}
+
 	if ( directive == "include" )
 	{
 		return ParseIncludeDirective( iter );
@@ -817,10 +828,31 @@ bool BFFParser::ParseIncludeDirective( BFFIterator & iter )
 		return false;
 	}
 	const uint64_t includeDataHash = xxHash::Calc64( mem.Get(), fileSize );
+
+	// can we reuse the result of parsing this include previously?
+	BFFIncludeCache & includeCache = m_NodeGraph.GetIncludeCache();
+	BFFStackFrame * const includeFrame = BFFStackFrame::GetCurrent();
+	bool once = false;
+	if ( includeCache.Replay( includeToUseClean, includeDataHash, includeFrame, once ) )
+	{
+		if ( FBuild::IsValid() ) // cope with null for unit tests
+		{
+			m_NodeGraph.AddUsedFile( includeToUseClean, includeTimeStamp, includeDataHash );
+			if ( once )
+			{
+				m_NodeGraph.SetCurrentFileAsOneUse();
+			}
+		}
+		return true;
+	}
+
 	mem.Get()[ fileSize ] = '\000'; // sentinel
 	BFFParser parser( m_NodeGraph );
 	const bool pushStackFrame = false; // include is treated as if injected at this point
-	return parser.Parse( mem.Get(), fileSize, includeToUseClean.Get(), includeTimeStamp, includeDataHash, pushStackFrame );
+	includeCache.BeginRecording( includeToUseClean, includeDataHash, includeFrame );
+	const bool ok = parser.Parse( mem.Get(), fileSize, includeToUseClean.Get(), includeTimeStamp, includeDataHash, pushStackFrame );
+	includeCache.EndRecording( ok, m_NodeGraph.IsOneUseFile( includeToUseClean ) );
+	return ok;
 }
 
 // ParseDefineDirective
@@ -1754,7 +1786,7 @@ bool BFFParser::StoreVariableToVariable( const AString & dstName, BFFIterator &
 		{
 			if ( concat )
 			{
-				BFFStackFrame::SetVarArrayOfStrings( dstName, varDst->GetArrayOfStrings(), dstFrame );
+				BFFStackFrame::SetVar( dstName, varDst, dstFrame );
 				FLOG_INFO( "Registered <ArrayOfStrings> variable '%s' with %u elements", dstName.Get(), (unsigned int)varDst->GetArrayOfStrings().GetSize() );
 			}
 			else
@@ -1770,7 +1802,7 @@ bool BFFParser::StoreVariableToVariable( const AString & dstName, BFFIterator &
 		{
 			if ( concat )
 			{
-				BFFStackFrame::SetVarArrayOfStructs( dstName, varDst->GetArrayOfStructs(), dstFrame );
+				BFFStackFrame::SetVar( dstName, varDst, dstFrame );
 				FLOG_INFO( "Registered <ArrayOfStructs> variable '%s' with %u elements", dstName.Get(), (unsigned int)varDst->GetArrayOfStructs().GetSize() );
 			}
 			else
@@ -1784,7 +1816,7 @@ bool BFFParser::StoreVariableToVariable( const AString & dstName, BFFIterator &
 		// ArrayOfStrings to empty array, assignment or concatenation
 		if ( dstIsEmpty && srcType == BFFVariable::VAR_ARRAY_OF_STRINGS && !subtract )
 		{
-			BFFStackFrame::SetVarArrayOfStrings( dstName, varSrc->GetArrayOfStrings(), dstFrame );
+			BFFStackFrame::SetVar( dstName, varSrc, dstFrame );
 			FLOG_INFO( "Registered <ArrayOfStrings> variable '%s' with %u elements", dstName.Get(), (unsigned int)varSrc->GetArrayOfStrings().GetSize() );
 			return true;
 		}
@@ -1792,7 +1824,7 @@ bool BFFParser::StoreVariableToVariable( const AString & dstName, BFFIterator &
 		// ArrayOfStructs to empty array, assignment or concatenation
 		if ( dstIsEmpty && srcType == BFFVariable::VAR_ARRAY_OF_STRUCTS && !subtract )
 		{
-			BFFStackFrame::SetVarArrayOfStructs( dstName, varSrc->GetArrayOfStructs(), dstFrame );
+			BFFStackFrame::SetVar( dstName, varSrc, dstFrame );
 			FLOG_INFO( "Registered <ArrayOfStructs> variable '%s' with %u elements", dstName.Get(), (unsigned int)varSrc->GetArrayOfStructs().GetSize() );
 			return true;
 		}
@@ -1827,7 +1859,7 @@ bool BFFParser::StoreVariableToVariable( const AString & dstName, BFFIterator &
 			}
 			else
 			{
-				BFFStackFrame::SetVarString( dstName, varSrc->GetString(), dstFrame );
+				BFFStackFrame::SetVar( dstName, varSrc, dstFrame );
 				FLOG_INFO( "Registered <string> variable '%s' with value '%s'", dstName.Get(), varSrc->GetString().Get() );
 			}
 			return true;
@@ -1846,7 +1878,7 @@ bool BFFParser::StoreVariableToVariable( const AString & dstName, BFFIterator &
 			}
 			else
 			{
-				BFFStackFrame::SetVarArrayOfStrings( dstName, varSrc->GetArrayOfStrings(), dstFrame );
+				BFFStackFrame::SetVar( dstName, varSrc, dstFrame );
 				FLOG_INFO( "Registered <ArrayOfStrings> variable '%s' with %u elements", dstName.Get(), (unsigned int)varSrc->GetArrayOfStrings().GetSize() );
 			}
 			return true;
@@ -1865,7 +1897,7 @@ bool BFFParser::StoreVariableToVariable( const AString & dstName, BFFIterator &
 			}
 			else
 			{
-				BFFStackFrame::SetVarArrayOfStructs( dstName, varSrc->GetArrayOfStructs(), dstFrame );
+				BFFStackFrame::SetVar( dstName, varSrc, dstFrame );
 				FLOG_INFO( "Registered <ArrayOfStructs> variable '%s' with %u elements", dstName.Get(), (unsigned int)varSrc->GetArrayOfStructs().GetSize() );
 			}
 			return true;
@@ -1905,7 +1937,7 @@ bool BFFParser::StoreVariableToVariable( const AString & dstName, BFFIterator &
 			else
 			{
 				// Register this variable
-				BFFStackFrame::SetVarStruct( dstName, srcMembers, dstFrame );
+				BFFStackFrame::SetVar( dstName, varSrc, dstFrame );
 				FLOG_INFO( "Registered <struct> variable '%s' with %u members", dstName.Get(), srcMembers.GetSize() );
 			}
 			return true;
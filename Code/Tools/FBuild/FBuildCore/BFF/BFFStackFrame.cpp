@@ -6,6 +6,7 @@
 #include "Tools/FBuild/FBuildCore/PrecompiledHeader.h"
 
 #include "BFFStackFrame.h"
+#include "BFFIncludeCache.h"
 #include "BFFVariable.h"
 #include "Core/Mem/Mem.h"
 #include "Core/Strings/AStackString.h"
@@ -18,6 +19,8 @@
 BFFStackFrame::BFFStackFrame()
 : m_Variables( 32, true )
 {
+	memset( m_VarMap, 0, sizeof( m_VarMap ) );
+
 	// hook into top of stack chain
 	m_Next = s_StackHead;
 	s_StackHead = this;
@@ -48,6 +51,8 @@ BFFStackFrame::~BFFStackFrame()
 {
 	frame = frame ? frame : s_StackHead;
 
+	BFFIncludeCache::OnVarWrite( name, frame );
+
 	BFFVariable * var = frame->GetVarMutableNoRecurse( name );
 	if ( var )
 	{
@@ -57,7 +62,7 @@ BFFStackFrame::~BFFStackFrame()
 
 	// variable not found at this level, so create it
 	BFFVariable * v = FNEW( BFFVariable( name, value ) );
-	frame->m_Variables.Append( v );
+	frame->AddVar( v );
 }
 
 // SetVarArrayOfStrings
@@ -68,6 +73,8 @@ BFFStackFrame::~BFFStackFrame()
 {
 	frame = frame ? frame : s_StackHead;
 
+	BFFIncludeCache::OnVarWrite( name, frame );
+
 	BFFVariable * var = frame->GetVarMutableNoRecurse( name );
 	if ( var )
 	{
@@ -77,7 +84,7 @@ BFFStackFrame::~BFFStackFrame()
 
 	// variable not found at this level, so create it
 	BFFVariable * v = FNEW( BFFVariable( name, values ) );
-	frame->m_Variables.Append( v );
+	frame->AddVar( v );
 }
 
 // SetVarBool
@@ -86,6 +93,8 @@ BFFStackFrame::~BFFStackFrame()
 {
 	frame = frame ? frame : s_StackHead;
 
+	BFFIncludeCache::OnVarWrite( name, frame );
+
 	BFFVariable * var = frame->GetVarMutableNoRecurse( name );
 	if ( var )
 	{
@@ -95,7 +104,7 @@ BFFStackFrame::~BFFStackFrame()
 
 	// variable not found at this level, so create it
 	BFFVariable * v = FNEW( BFFVariable( name, value ) );
-	frame->m_Variables.Append( v );
+	frame->AddVar( v );
 }
 
 // SetVarInt
@@ -104,6 +113,8 @@ BFFStackFrame::~BFFStackFrame()
 {
 	frame = frame ? frame : s_StackHead;
 
+	BFFIncludeCache::OnVarWrite( name, frame );
+
 	BFFVariable * var = frame->GetVarMutableNoRecurse( name );
 	if ( var )
 	{
@@ -113,7 +124,7 @@ BFFStackFrame::~BFFStackFrame()
 
 	// variable not found at this level, so create it
 	BFFVariable * v = FNEW( BFFVariable( name, value ) );
-	frame->m_Variables.Append( v );
+	frame->AddVar( v );
 }
 
 // SetVarStruct
@@ -124,6 +135,8 @@ BFFStackFrame::~BFFStackFrame()
 {
 	frame = frame ? frame : s_StackHead;
 
+	BFFIncludeCache::OnVarWrite( name, frame );
+
 	BFFVariable * var = frame->GetVarMutableNoRecurse( name );
 	if ( var )
 	{
@@ -133,7 +146,7 @@ BFFStackFrame::~BFFStackFrame()
 
 	// variable not found at this level, so create it
 	BFFVariable * v = FNEW( BFFVariable( name, members ) );
-	frame->m_Variables.Append( v );
+	frame->AddVar( v );
 }
 
 // SetVarArrayOfStructs
@@ -144,6 +157,8 @@ BFFStackFrame::~BFFStackFrame()
 {
 	frame = frame ? frame : s_StackHead;
 
+	BFFIncludeCache::OnVarWrite( name, frame );
+
 	BFFVariable * var = frame->GetVarMutableNoRecurse( name );
 	if ( var )
 	{
@@ -153,29 +168,38 @@ BFFStackFrame::~BFFStackFrame()
 
 	// variable not found at this level, so create it
 	BFFVariable * v = FNEW( BFFVariable( name, structs, BFFVariable::VAR_ARRAY_OF_STRUCTS ) );
-	frame->m_Variables.Append( v );
+	frame->AddVar( v );
 }
 
 
 // SetVar
 //------------------------------------------------------------------------------
 /*static*/ void BFFStackFrame::SetVar( const BFFVariable * var, BFFStackFrame * frame )
+{
+	ASSERT( var );
+	SetVar( var->GetName(), var, frame );
+}
+
+// SetVar
+//------------------------------------------------------------------------------
+/*static*/ void BFFStackFrame::SetVar( const AString & name, const BFFVariable * var, BFFStackFrame * frame )
 {
 	frame = frame ? frame : s_StackHead;
 
 	ASSERT( var );
 
-	switch ( var->GetType() )
-	{		
-		case BFFVariable::VAR_ANY:				ASSERT( false ); break;
-		case BFFVariable::VAR_STRING:			SetVarString( var->GetName(), var->GetString(), frame ); break;
-		case BFFVariable::VAR_BOOL:				SetVarBool( var->GetName(), var->GetBool(), frame ); break;
-		case BFFVariable::VAR_ARRAY_OF_STRINGS:	SetVarArrayOfStrings( var->GetName(), var->GetArrayOfStrings(), frame ); break;
-		case BFFVariable::VAR_INT:				SetVarInt( var->GetName(), var->GetInt(), frame ); break;
-		case BFFVariable::VAR_STRUCT:			SetVarStruct( var->GetName(), var->GetStructMembers(), frame ); break;
-		case BFFVariable::VAR_ARRAY_OF_STRUCTS:	SetVarArrayOfStructs( var->GetName(), var->GetArrayOfStructs(), frame ); break;
-		case BFFVariable::MAX_VAR_TYPES: ASSERT( false ); break;
+	BFFIncludeCache::OnVarWrite( name, frame );
+
+	BFFVariable * existing = frame->GetVarMutableNoRecurse( name );
+	if ( existing )
+	{
+		existing->SetValueFrom( *var );
+		return;
 	}
+
+	// variable not found at this level, so create it
+	BFFVariable * v = FNEW( BFFVariable( name, *var ) );
+	frame->AddVar( v );
 }
 
 // ConcatVars
@@ -191,6 +215,8 @@ BFFVariable * BFFStackFrame::ConcatVars( const AString & name,
 	ASSERT( lhs );
     ASSERT( rhs );
 
+	BFFIncludeCache::OnVarWrite( name, frame );
+
     BFFVariable *const newVar = lhs->ConcatVarsRecurse( name, *rhs );
     frame->CreateOrReplaceVarMutableNoRecurse( newVar );
 
@@ -215,7 +241,9 @@ BFFVariable * BFFStackFrame::ConcatVars( const AString & name,
 	if ( frame )
 	{
 		// no recursion, specific frame provided
-		return frame->GetVarMutableNoRecurse( name );
+		const BFFVariable * var = frame->GetVarMutableNoRecurse( name );
+		BFFIncludeCache::OnVarRead( name, var, frame, frame, false );
+		return var;
 	}
 	else
 	{
@@ -228,24 +256,21 @@ BFFVariable * BFFStackFrame::ConcatVars( const AString & name,
 //------------------------------------------------------------------------------
 const BFFVariable * BFFStackFrame::GetVariableRecurse( const AString & name ) const
 {
-	// look at this scope level
-	Array< BFFVariable * >::Iter i = m_Variables.Begin();
-	Array< BFFVariable * >::Iter end = m_Variables.End();
-	for( ; i < end ; ++i )
+	const uint32_t nameHash = BFFVariable::CalcNameHash( name );
+
+	// look at this scope level and then each parent
+	for ( const BFFStackFrame * frame = this; frame; frame = frame->m_Next )
 	{
-		if ( ( *i )->GetName() == name )
+		const BFFVariable * var = frame->FindVarNoRecurse( name, nameHash );
+		if ( var )
 		{
-			return *i;
+			BFFIncludeCache::OnVarRead( name, var, this, frame, true );
+			return var;
 		}
 	}
-	
-	// look at parent
-	if ( m_Next )
-	{
-		return m_Next->GetVariableRecurse( name );
-	}
 
 	// not found
+	BFFIncludeCache::OnVarRead( name, nullptr, this, nullptr, true );
 	return nullptr;
 }
 
@@ -274,18 +299,20 @@ const BFFVariable * BFFStackFrame::GetLocalVar( const AString & name ) const
 
 	variable = nullptr;
 
-	BFFStackFrame * parentFrame = frame ? frame->GetParent() : GetCurrent()->GetParent();
+	BFFStackFrame * const startFrame = frame ? frame->GetParent() : GetCurrent()->GetParent();
 
 	// look for the scope containing the original variable
-    for ( ; parentFrame; parentFrame = parentFrame->GetParent() )
+    for ( BFFStackFrame * parentFrame = startFrame; parentFrame; parentFrame = parentFrame->GetParent() )
     {
         if ( ( variable = parentFrame->GetLocalVar( name ) ) != nullptr )
         {
+			BFFIncludeCache::OnVarRead( name, variable, startFrame, parentFrame, true );
             return parentFrame;
         }
     }
 
     ASSERT( nullptr == variable );
+	BFFIncludeCache::OnVarRead( name, nullptr, startFrame, nullptr, true );
     return nullptr;
 }
 
@@ -305,34 +332,45 @@ const BFFVariable * BFFStackFrame::GetLocalVar( const AString & name ) const
 const BFFVariable * BFFStackFrame::GetVariableRecurse( const AString & nameOnly, 
 												 BFFVariable::VarType type ) const
 {
-	// look at this scope level
-	Array< BFFVariable * >::Iter i = m_Variables.Begin();
-	Array< BFFVariable * >::Iter end = m_Variables.End();
-	for( ; i < end ; ++i )
+	const uint32_t nameHash = BFFVariable::CalcNameHashNameOnly( nameOnly.Get(), nameOnly.GetLength() );
+
+	// look at this scope level and then each parent
+	for ( const BFFStackFrame * frame = this; frame; frame = frame->m_Next )
 	{
-		// if name only (minus type prefix ) length matches
-		if ( ( *i )->GetName().GetLength() == ( nameOnly.GetLength() + 1 ) )
+		const BFFVariable * var = frame->m_VarMap[ nameHash & ( VARMAP_TABLE_SIZE - 1 ) ];
+		for ( ; var; var = var->m_NextInFrame )
 		{
+			// if hash and name only (minus type prefix ) length matches
+			if ( ( var->GetNameHash() != nameHash ) ||
+				 ( var->GetName().GetLength() != ( nameOnly.GetLength() + 1 ) ) )
+			{
+				continue;
+			}
+
 			//types match?
 			if ( ( type == BFFVariable::VAR_ANY ) ||
-				 ( type == ( *i )->GetType() ) )
+				 ( type == var->GetType() ) )
 			{
 				// compare names
-				if ( nameOnly == ( ( *i )->GetName().Get() + 1 ) )
+				if ( nameOnly == ( var->GetName().Get() + 1 ) )
 				{
-					return *i;
+					if ( BFFIncludeCache::IsRecording() )
+					{
+						BFFIncludeCache::OnVarRead( var->GetName(), var, this, frame, true );
+					}
+					return var;
 				}
 			}
 		}
 	}
-	
-	// look at parent
-	if ( m_Next )
-	{
-		return m_Next->GetVariableRecurse( nameOnly, type );
-	}
 
 	// not found
+	if ( BFFIncludeCache::IsRecording() )
+	{
+		AStackString<> name( "." );
+		name += nameOnly;
+		BFFIncludeCache::OnVarRead( name, nullptr, this, nullptr, true );
+	}
 	return nullptr;
 }
 
@@ -343,17 +381,7 @@ const BFFVariable * BFFStackFrame::GetVarNoRecurse( const AString & name ) const
 	ASSERT( s_StackHead ); // we shouldn't be calling this if there aren't any stack frames
 
 	// look at this scope level
-	Array< BFFVariable * >::Iter i = m_Variables.Begin();
-	Array< BFFVariable * >::Iter end = m_Variables.End();
-	for( ; i < end ; ++i )
-	{
-		if ( ( *i )->GetName() == name )
-		{
-			return *i;
-		}
-	}
-
-	return nullptr;
+	return FindVarNoRecurse( name, BFFVariable::CalcNameHash( name ) );
 }
 
 // GetVarMutableNoRecurse
@@ -363,13 +391,19 @@ BFFVariable * BFFStackFrame::GetVarMutableNoRecurse( const AString & name )
 	ASSERT( s_StackHead ); // we shouldn't be calling this if there aren't any stack frames
 
 	// look at this scope level
-	Array< BFFVariable * >::Iter i = m_Variables.Begin();
-	Array< BFFVariable * >::Iter end = m_Variables.End();
-	for( ; i < end ; ++i )
+	return FindVarNoRecurse( name, BFFVariable::CalcNameHash( name ) );
+}
+
+// FindVarNoRecurse
+//------------------------------------------------------------------------------
+BFFVariable * BFFStackFrame::FindVarNoRecurse( const AString & name, uint32_t nameHash ) const
+{
+	BFFVariable * var = m_VarMap[ nameHash & ( VARMAP_TABLE_SIZE - 1 ) ];
+	for ( ; var; var = var->m_NextInFrame )
 	{
-		if ( ( *i )->GetName() == name )
+		if ( ( var->GetNameHash() == nameHash ) && ( var->GetName() == name ) )
 		{
-			return *i;
+			return var;
 		}
 	}
 
@@ -382,21 +416,43 @@ void BFFStackFrame::CreateOrReplaceVarMutableNoRecurse( BFFVariable *var )
 {
     ASSERT( s_StackHead ); // we shouldn't be calling this if there aren't any stack frames
     ASSERT( var );
+	ASSERT( var->m_NextInFrame == nullptr );
 
     // look at this scope level
-	Array< BFFVariable * >::Iter i = m_Variables.Begin();
-	Array< BFFVariable * >::Iter end = m_Variables.End();
-	for( ; i < end ; ++i )
+	BFFVariable ** link = &m_VarMap[ var->GetNameHash() & ( VARMAP_TABLE_SIZE - 1 ) ];
+	for ( ; *link; link = &( *link )->m_NextInFrame )
 	{
-		if ( ( *i )->GetName() == var->GetName() )
+		BFFVariable * existing = *link;
+		if ( ( existing->GetNameHash() == var->GetNameHash() ) && ( existing->GetName() == var->GetName() ) )
 		{
-            FDELETE *i;
-            *i = var;
+			// replace in hash chain
+			var->m_NextInFrame = existing->m_NextInFrame;
+			*link = var;
+
+			// replace in ordered list
+			BFFVariable ** it = m_Variables.Find( existing );
+			ASSERT( it );
+			*it = var;
+
+            FDELETE existing;
 			return;
 		}
 	}
 
-    m_Variables.Append( var );
+	AddVar( var );
+}
+
+// AddVar
+//------------------------------------------------------------------------------
+void BFFStackFrame::AddVar( BFFVariable * var )
+{
+	ASSERT( var->m_NextInFrame == nullptr );
+
+	BFFVariable *& bucket = m_VarMap[ var->GetNameHash() & ( VARMAP_TABLE_SIZE - 1 ) ];
+	var->m_NextInFrame = bucket;
+	bucket = var;
+
+	m_Variables.Append( var );
 }
 
 //------------------------------------------------------------------------------
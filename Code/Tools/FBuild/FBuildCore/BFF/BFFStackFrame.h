@@ -41,8 +41,9 @@ public:
 									  const Array< const BFFVariable * > & structs,
 									  BFFStackFrame * frame );
 
-	// set from an existing variable
+	// set from an existing variable (sharing its value)
 	static void SetVar( const BFFVariable * var, BFFStackFrame * frame );
+	static void SetVar( const AString & name, const BFFVariable * var, BFFStackFrame * frame );
 
     // set from two existing variable
     static BFFVariable * ConcatVars( const AString & name,
@@ -78,12 +79,18 @@ private:
 
 	const BFFVariable * GetVarNoRecurse( const AString & name ) const;
 	BFFVariable * GetVarMutableNoRecurse( const AString & name );
+	BFFVariable * FindVarNoRecurse( const AString & name, uint32_t nameHash ) const;
 
     void CreateOrReplaceVarMutableNoRecurse( BFFVariable * var );
+	void AddVar( BFFVariable * var );
 
 	// variables at current scope
 	Array< BFFVariable * > m_Variables;
 
+	// hash table of variables at current scope (for fast lookup by name)
+	enum { VARMAP_TABLE_SIZE = 64 }; // must be power of 2
+	BFFVariable * m_VarMap[ VARMAP_TABLE_SIZE ];
+
 	// pointer to parent scope
 	BFFStackFrame * m_Next;
 
@@ -8,7 +8,11 @@
 #include "BFFVariable.h"
 #include "Tools/FBuild/FBuildCore/FLog.h"
 
+#include "Core/FileIO/IOStream.h"
+#include "Core/FileIO/MemoryStream.h"
+#include "Core/Math/xxHash.h"
 #include "Core/Mem/Mem.h"
+#include "Core/Strings/AStackString.h"
 
 // Static Data
 //------------------------------------------------------------------------------
@@ -23,121 +27,135 @@
 	"ArrayOfStructs"
 };
 
+/*static*/ const BFFVariable::SharedValue BFFVariable::s_EmptyValue;
+/*static*/ uint32_t BFFVariable::s_NumVariablesCreated( 0 );
+/*static*/ uint32_t BFFVariable::s_NumValuesCreated( 0 );
+/*static*/ uint32_t BFFVariable::s_NumValuesShared( 0 );
+
 // CONSTRUCTOR
 //------------------------------------------------------------------------------
 BFFVariable::BFFVariable( const AString & name, VarType type )
 : m_Name( name )
+, m_NameHash( CalcNameHash( name ) )
 , m_Type( type )
 , m_Frozen( false )
-//, m_StringValue() // default construct this
 , m_BoolValue( false )
-, m_ArrayValues( 0, true )
 , m_IntValue( 0 )
-, m_StructMembers( 0, true )
-, m_ArrayOfStructs( 0, true )
+, m_Value( nullptr )
+, m_NextInFrame( nullptr )
 {
+	++s_NumVariablesCreated;
 }
 
 // CONSTRUCTOR (copy)
 //------------------------------------------------------------------------------
 BFFVariable::BFFVariable( const BFFVariable & other )
 : m_Name( other.m_Name )
+, m_NameHash( other.m_NameHash )
 , m_Type( other.m_Type )
 , m_Frozen( false )
-//, m_StringValue() // default construct this
-, m_BoolValue( false )
-, m_ArrayValues( 0, true )
-, m_IntValue( 0 )
-, m_StructMembers( 0, true )
-, m_ArrayOfStructs( 0, true )
+, m_BoolValue( other.m_BoolValue )
+, m_IntValue( other.m_IntValue )
+, m_Value( nullptr )
+, m_NextInFrame( nullptr )
 {
-	switch( m_Type )
-	{
-		case VAR_ANY:				ASSERT( false ); break;
-		case VAR_STRING:			SetValueString( other.GetString() ); break;
-		case VAR_BOOL:				SetValueBool( other.GetBool() ); break;
-		case VAR_ARRAY_OF_STRINGS:	SetValueArrayOfStrings( other.GetArrayOfStrings() ); break;
-		case VAR_INT:				SetValueInt( other.GetInt() ); break;
-		case VAR_STRUCT:			SetValueStruct( other.GetStructMembers() ); break;
-		case VAR_ARRAY_OF_STRUCTS:	SetValueArrayOfStructs( other.GetArrayOfStructs() ); break;
-		case MAX_VAR_TYPES:	ASSERT( false ); break;
-	}
+	ASSERT( ( m_Type != VAR_ANY ) && ( m_Type != MAX_VAR_TYPES ) );
+	++s_NumVariablesCreated;
+	ShareValue( other.m_Value );
+}
+
+// CONSTRUCTOR (copy with new name)
+//------------------------------------------------------------------------------
+BFFVariable::BFFVariable( const AString & name, const BFFVariable & other )
+: m_Name( name )
+, m_NameHash( CalcNameHash( name ) )
+, m_Type( other.m_Type )
+, m_Frozen( false )
+, m_BoolValue( other.m_BoolValue )
+, m_IntValue( other.m_IntValue )
+, m_Value( nullptr )
+, m_NextInFrame( nullptr )
+{
+	ASSERT( ( m_Type != VAR_ANY ) && ( m_Type != MAX_VAR_TYPES ) );
+	++s_NumVariablesCreated;
+	ShareValue( other.m_Value );
 }
 
 // CONSTRUCTOR
 //------------------------------------------------------------------------------
 BFFVariable::BFFVariable( const AString & name, const AString & value )
 : m_Name( name )
+, m_NameHash( CalcNameHash( name ) )
 , m_Type( VAR_STRING )
 , m_Frozen( false )
-, m_StringValue( value )
 , m_BoolValue( false )
-, m_ArrayValues( 0, false )
 , m_IntValue( 0 )
-, m_StructMembers( 0, true )
-, m_ArrayOfStructs( 0, false )
+, m_Value( nullptr )
+, m_NextInFrame( nullptr )
 {
+	++s_NumVariablesCreated;
+	SetValueString( value );
 }
 
 // CONSTRUCTOR
 //------------------------------------------------------------------------------
 BFFVariable::BFFVariable( const AString & name, bool value )
 : m_Name( name )
+, m_NameHash( CalcNameHash( name ) )
 , m_Type( VAR_BOOL )
 , m_Frozen( false )
-//, m_StringValue() // default construct this
 , m_BoolValue( value )
-, m_ArrayValues( 0, false )
 , m_IntValue( 0 )
-, m_StructMembers( 0, false )
-, m_ArrayOfStructs( 0, false )
+, m_Value( nullptr )
+, m_NextInFrame( nullptr )
 {
+	++s_NumVariablesCreated;
 }
 
 // CONSTRUCTOR
 //------------------------------------------------------------------------------
 BFFVariable::BFFVariable( const AString & name, const Array< AString > & values )
 : m_Name( name )
+, m_NameHash( CalcNameHash( name ) )
 , m_Type( VAR_ARRAY_OF_STRINGS )
 , m_Frozen( false )
-//, m_StringValue() // default construct this
 , m_BoolValue( false )
-, m_ArrayValues( 0, true )
 , m_IntValue( 0 )
-, m_StructMembers( 0, false )
-, m_ArrayOfStructs( 0, false )
+, m_Value( nullptr )
+, m_NextInFrame( nullptr )
 {
-	m_ArrayValues = values;
+	++s_NumVariablesCreated;
+	SetValueArrayOfStrings( values );
 }
 
 // CONSTRUCTOR
 //------------------------------------------------------------------------------
 BFFVariable::BFFVariable( const AString & name, int i )
 : m_Name( name )
+, m_NameHash( CalcNameHash( name ) )
 , m_Type( VAR_INT )
 , m_Frozen( false )
-//, m_StringValue() // default construct this
 , m_BoolValue( false )
-, m_ArrayValues( 0, true )
 , m_IntValue( i )
-, m_StructMembers( 0, true )
-, m_ArrayOfStructs( 0, false )
+, m_Value( nullptr )
+, m_NextInFrame( nullptr )
 {
+	++s_NumVariablesCreated;
 }
 
 // CONSTRUCTOR
 //------------------------------------------------------------------------------
 BFFVariable::BFFVariable( const AString & name, const Array< const BFFVariable * > & values )
 : m_Name( name )
+, m_NameHash( CalcNameHash( name ) )
 , m_Type( VAR_STRUCT )
 , m_Frozen( false )
-//, m_StringValue() // default construct this
 , m_BoolValue( false )
-, m_ArrayValues( 0, false )
 , m_IntValue( 0 )
-, m_StructMembers( values.GetSize(), true )
-, m_ArrayOfStructs( 0, false )
+, m_Value( nullptr )
+, m_NextInFrame( nullptr )
 {
+	++s_NumVariablesCreated;
 	SetValueStruct( values );
 }
 
@@ -147,18 +165,18 @@ BFFVariable::BFFVariable( const AString & name,
 						  const Array< const BFFVariable * > & structs, 
 						  VarType type ) // type for disambiguation
 : m_Name( name )
+, m_NameHash( CalcNameHash( name ) )
 , m_Type( VAR_ARRAY_OF_STRUCTS )
 , m_Frozen( false )
-//, m_StringValue() // default construct this
 , m_BoolValue( false )
-, m_ArrayValues( 0, false )
 , m_IntValue( 0 )
-, m_StructMembers( 0, false )
-, m_ArrayOfStructs( structs.GetSize(), true )
+, m_Value( nullptr )
+, m_NextInFrame( nullptr )
 {
 	// type for disambiguation only - sanity check it's the right type
 	ASSERT( type == VAR_ARRAY_OF_STRUCTS ); (void)type;
 
+	++s_NumVariablesCreated;
 	SetValueArrayOfStructs( structs );
 }
 
@@ -166,21 +184,7 @@ BFFVariable::BFFVariable( const AString & name,
 //------------------------------------------------------------------------------
 BFFVariable::~BFFVariable()
 {
-	// clean up struct members
-	for ( BFFVariable ** it = m_StructMembers.Begin();
-		  it != m_StructMembers.End();
-		  ++it )
-	{
-		FDELETE *it;
-	}
-
-	// clean up arrays of structs
-	for ( BFFVariable ** it = m_ArrayOfStructs.Begin();
-		  it != m_ArrayOfStructs.End();
-		  ++it )
-	{
-		FDELETE *it;
-	}
+	ReleaseValue();
 }
 
 // SetValueString
@@ -189,7 +193,13 @@ void BFFVariable::SetValueString( const AString & value )
 {
     ASSERT( false == m_Frozen );
 	m_Type = VAR_STRING;
-	m_StringValue = value;
+	if ( m_Value && ( &value == &m_Value->m_StringValue ) )
+	{
+		return; // self-assignment
+	}
+	SharedValue * v = GetMutableValue();
+	v->m_StringValue = value;
+	v->m_ArrayValues.Clear();
 }
 
 // SetValueBool
@@ -199,6 +209,7 @@ void BFFVariable::SetValueBool( bool value )
     ASSERT( false == m_Frozen );
 	m_Type = VAR_BOOL;
 	m_BoolValue = value;
+	ReleaseValue();
 }
 
 // SetValueArrayOfStrings
@@ -207,7 +218,13 @@ void BFFVariable::SetValueArrayOfStrings( const Array< AString > & values )
 {
     ASSERT( false == m_Frozen );
 	m_Type = VAR_ARRAY_OF_STRINGS;
-	m_ArrayValues = values;
+	if ( m_Value && ( &values == &m_Value->m_ArrayValues ) )
+	{
+		return; // self-assignment
+	}
+	SharedValue * v = GetMutableValue();
+	v->m_StringValue.Clear();
+	v->m_ArrayValues = values;
 }
 
 // SetValueInt
@@ -217,6 +234,7 @@ void BFFVariable::SetValueInt( int i )
     ASSERT( false == m_Frozen );
 	m_Type = VAR_INT;
 	m_IntValue = i;
+	ReleaseValue();
 }
 
 // SetValueStruct
@@ -225,30 +243,24 @@ void BFFVariable::SetValueStruct( const Array< const BFFVariable * > & values )
 {
     ASSERT( false == m_Frozen );
 
-	// build list of new members, but don't touch old ones yet to gracefully
+	// build new value, but don't touch old one yet to gracefully
 	// handle self-assignment
-	Array< BFFVariable * > newVars( values.GetSize(), false );
-
-	m_Type = VAR_STRUCT;
+	SharedValue * newValue = FNEW( SharedValue );
+	++s_NumValuesCreated;
+	newValue->m_Variables.SetCapacity( values.GetSize() );
 	for ( const BFFVariable ** it = values.Begin();
 		  it != values.End();
 		  ++it )
 	{
+		// members share the value of the original
 		const BFFVariable * var = *it;
 		BFFVariable * newV = FNEW( BFFVariable( *var ) );
-		newVars.Append( newV );
-	}
-
-	// free old members
-	for ( BFFVariable ** it = m_StructMembers.Begin();
-		  it != m_StructMembers.End();
-		  ++it )
-	{
-		FDELETE *it;
+		newValue->m_Variables.Append( newV );
 	}
 
-	// swap
-	m_StructMembers.Swap( newVars );
+	m_Type = VAR_STRUCT;
+	ReleaseValue();
+	m_Value = newValue;
 }
 
 // SetValueArrayOfStructs
@@ -257,29 +269,116 @@ void BFFVariable::SetValueArrayOfStructs( const Array< const BFFVariable * > & v
 {
     ASSERT( false == m_Frozen );
 
-	// build list of new members, but don't touch old ones yet to gracefully
+	// build new value, but don't touch old one yet to gracefully
 	// handle self-assignment
-	Array< BFFVariable * > newVars( values.GetSize(), false );
-
-	m_Type = VAR_ARRAY_OF_STRUCTS;
+	SharedValue * newValue = FNEW( SharedValue );
+	++s_NumValuesCreated;
+	newValue->m_Variables.SetCapacity( values.GetSize() );
 	for ( const BFFVariable ** it = values.Begin();
 		  it != values.End();
 		  ++it )
 	{
+		// structs share the value of the original
 		const BFFVariable * var = *it;
 		BFFVariable * newV = FNEW( BFFVariable( *var ) );
-		newVars.Append( newV );
+		newValue->m_Variables.Append( newV );
 	}
 
-	// free old members
-	for ( BFFVariable ** it = m_ArrayOfStructs.Begin();
-		  it != m_ArrayOfStructs.End();
+	m_Type = VAR_ARRAY_OF_STRUCTS;
+	ReleaseValue();
+	m_Value = newValue;
+}
+
+// SetValueFrom
+//------------------------------------------------------------------------------
+void BFFVariable::SetValueFrom( const BFFVariable & other )
+{
+    ASSERT( false == m_Frozen );
+	ASSERT( ( other.m_Type != VAR_ANY ) && ( other.m_Type != MAX_VAR_TYPES ) );
+
+	m_Type = other.m_Type;
+	m_BoolValue = other.m_BoolValue;
+	m_IntValue = other.m_IntValue;
+	ShareValue( other.m_Value ); // handles self-assignment
+}
+
+// GetMutableValue
+//------------------------------------------------------------------------------
+BFFVariable::SharedValue * BFFVariable::GetMutableValue()
+{
+	// copy-on-write: values can only be modified if not shared (struct values
+	// are never modified in place, as they own their members)
+	if ( m_Value && ( m_Value->m_RefCount == 1 ) && m_Value->m_Variables.IsEmpty() )
+	{
+		return m_Value;
+	}
+	ReleaseValue();
+	m_Value = FNEW( SharedValue );
+	++s_NumValuesCreated;
+	return m_Value;
+}
+
+// ShareValue
+//------------------------------------------------------------------------------
+void BFFVariable::ShareValue( SharedValue * value )
+{
+	if ( value == m_Value )
+	{
+		return;
+	}
+	if ( value )
+	{
+		++value->m_RefCount;
+		++s_NumValuesShared;
+	}
+	ReleaseValue();
+	m_Value = value;
+}
+
+// ReleaseValue
+//------------------------------------------------------------------------------
+void BFFVariable::ReleaseValue()
+{
+	if ( m_Value )
+	{
+		ASSERT( m_Value->m_RefCount > 0 );
+		if ( --m_Value->m_RefCount == 0 )
+		{
+			FDELETE m_Value;
+		}
+		m_Value = nullptr;
+	}
+}
+
+// ResetStats
+//------------------------------------------------------------------------------
+/*static*/ void BFFVariable::ResetStats()
+{
+	s_NumVariablesCreated = 0;
+	s_NumValuesCreated = 0;
+	s_NumValuesShared = 0;
+}
+
+// SharedValue::CONSTRUCTOR
+//------------------------------------------------------------------------------
+BFFVariable::SharedValue::SharedValue()
+: m_RefCount( 1 )
+, m_ArrayValues( 0, true )
+, m_Variables( 0, true )
+{
+}
+
+// SharedValue::DESTRUCTOR
+//------------------------------------------------------------------------------
+BFFVariable::SharedValue::~SharedValue()
+{
+	// clean up struct members or arrays of structs
+	for ( BFFVariable ** it = m_Variables.Begin();
+		  it != m_Variables.End();
 		  ++it )
 	{
 		FDELETE *it;
 	}
-
-	m_ArrayOfStructs.Swap( newVars );
 }
 
 // GetMemberByName
@@ -297,6 +396,139 @@ void BFFVariable::SetValueArrayOfStructs( const Array< const BFFVariable * > & v
     return nullptr;
 }
 
+// CalcNameHash
+//------------------------------------------------------------------------------
+/*static*/ uint32_t BFFVariable::CalcNameHash( const AString & name )
+{
+	ASSERT( name.IsEmpty() == false );
+	return CalcNameHashNameOnly( name.Get() + 1, name.GetLength() - 1 );
+}
+
+// CalcNameHashNameOnly
+//------------------------------------------------------------------------------
+/*static*/ uint32_t BFFVariable::CalcNameHashNameOnly( const char * nameOnly, size_t len )
+{
+	return xxHash::Calc32( nameOnly, len );
+}
+
+// Save
+//------------------------------------------------------------------------------
+void BFFVariable::Save( IOStream & stream ) const
+{
+	stream.Write( m_Name );
+	stream.Write( (uint8_t)m_Type );
+	switch ( m_Type )
+	{
+		case VAR_ANY:				ASSERT( false ); break;
+		case VAR_STRING:			stream.Write( GetString() ); break;
+		case VAR_BOOL:				stream.Write( m_BoolValue ); break;
+		case VAR_ARRAY_OF_STRINGS:	stream.Write( GetArrayOfStrings() ); break;
+		case VAR_INT:				stream.Write( (int32_t)m_IntValue ); break;
+		case VAR_STRUCT:			// fall through
+		case VAR_ARRAY_OF_STRUCTS:
+		{
+			const Array< BFFVariable * > & vars = GetValue().m_Variables;
+			stream.Write( (uint32_t)vars.GetSize() );
+			for ( const BFFVariable * var : vars )
+			{
+				var->Save( stream );
+			}
+			break;
+		}
+		case MAX_VAR_TYPES:			ASSERT( false ); break;
+	}
+}
+
+// Load
+//------------------------------------------------------------------------------
+/*static*/ BFFVariable * BFFVariable::Load( IOStream & stream )
+{
+	AStackString<> name;
+	uint8_t type;
+	if ( ( stream.Read( name ) == false ) ||
+		 ( stream.Read( type ) == false ) ||
+		 ( name.IsEmpty() ) )
+	{
+		return nullptr;
+	}
+
+	switch ( (VarType)type )
+	{
+		case VAR_STRING:
+		{
+			AStackString< 2048 > value;
+			if ( stream.Read( value ) == false )
+			{
+				return nullptr;
+			}
+			return FNEW( BFFVariable( name, value ) );
+		}
+		case VAR_BOOL:
+		{
+			bool value;
+			if ( stream.Read( value ) == false )
+			{
+				return nullptr;
+			}
+			return FNEW( BFFVariable( name, value ) );
+		}
+		case VAR_ARRAY_OF_STRINGS:
+		{
+			Array< AString > values( 0, true );
+			if ( stream.Read( values ) == false )
+			{
+				return nullptr;
+			}
+			return FNEW( BFFVariable( name, values ) );
+		}
+		case VAR_INT:
+		{
+			int32_t value;
+			if ( stream.Read( value ) == false )
+			{
+				return nullptr;
+			}
+			return FNEW( BFFVariable( name, (int)value ) );
+		}
+		case VAR_STRUCT:			// fall through
+		case VAR_ARRAY_OF_STRUCTS:
+		{
+			uint32_t num;
+			if ( stream.Read( num ) == false )
+			{
+				return nullptr;
+			}
+			BFFVariable * result = FNEW( BFFVariable( name, (VarType)type ) );
+			Array< BFFVariable * > & vars = result->GetMutableValue()->m_Variables;
+			vars.SetCapacity( num );
+			for ( uint32_t i = 0; i < num; ++i )
+			{
+				BFFVariable * var = Load( stream );
+				if ( var == nullptr )
+				{
+					FDELETE result;
+					return nullptr;
+				}
+				vars.Append( var );
+			}
+			return result;
+		}
+		default:
+		{
+			return nullptr; // corrupt data
+		}
+	}
+}
+
+// CalcValueHash
+//------------------------------------------------------------------------------
+uint64_t BFFVariable::CalcValueHash() const
+{
+	MemoryStream ms;
+	Save( ms );
+	return xxHash::Calc64( ms.GetData(), ms.GetSize() );
+}
+
 // ConcatVarsRecurse
 //------------------------------------------------------------------------------
 BFFVariable * BFFVariable::ConcatVarsRecurse( const AString & dstName, const BFFVariable & other ) const
@@ -409,8 +641,8 @@ BFFVariable * BFFVariable::ConcatVarsRecurse( const AString & dstName, const BFF
             const Array< const BFFVariable * > & dstMembers = varDst->GetStructMembers();
 
             BFFVariable * const result = FNEW( BFFVariable( dstName, BFFVariable::VAR_STRUCT ) );
-            result->m_StructMembers.SetCapacity( srcMembers.GetSize() + dstMembers.GetSize() );
-            Array< BFFVariable * > & allMembers = result->m_StructMembers;
+            Array< BFFVariable * > & allMembers = result->GetMutableValue()->m_Variables;
+            allMembers.SetCapacity( srcMembers.GetSize() + dstMembers.GetSize() );
 
             // keep original (dst) members where the name doesn't clash
             // or concatenate recursively values where the name clash
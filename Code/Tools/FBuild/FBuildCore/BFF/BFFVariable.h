@@ -11,6 +11,7 @@
 
 // Forward Declarations
 //------------------------------------------------------------------------------
+class IOStream;
 
 // Helpers
 //------------------------------------------------------------------------------
@@ -31,13 +32,14 @@ class BFFVariable
 {
 public:
 	inline const AString & GetName() const { return m_Name; }
+	inline uint32_t GetNameHash() const { return m_NameHash; }
 
-	const AString & GetString() const { return m_StringValue; }
-	const Array< AString > & GetArrayOfStrings() const { return m_ArrayValues; }
+	const AString & GetString() const { return GetValue().m_StringValue; }
+	const Array< AString > & GetArrayOfStrings() const { return GetValue().m_ArrayValues; }
 	int GetInt() const { return m_IntValue; }
 	bool GetBool() const { return m_BoolValue; }
-	const Array< const BFFVariable * > & GetStructMembers() const { RETURN_CONSTIFIED_BFF_VARIABLE_ARRAY( m_StructMembers ); }
-	const Array< const BFFVariable * > & GetArrayOfStructs() const { RETURN_CONSTIFIED_BFF_VARIABLE_ARRAY( m_ArrayOfStructs ); }
+	const Array< const BFFVariable * > & GetStructMembers() const { RETURN_CONSTIFIED_BFF_VARIABLE_ARRAY( GetValueIfType( VAR_STRUCT ).m_Variables ); }
+	const Array< const BFFVariable * > & GetArrayOfStructs() const { RETURN_CONSTIFIED_BFF_VARIABLE_ARRAY( GetValueIfType( VAR_ARRAY_OF_STRUCTS ).m_Variables ); }
 
 	enum VarType
 	{
@@ -68,11 +70,29 @@ public:
     BFFVariable * ConcatVarsRecurse( const AString & dstName, const BFFVariable & other ) const;
 
     static const BFFVariable ** GetMemberByName( const AString & name, const Array< const BFFVariable * > & members );
+
+	// hash of name, excluding the type prefix ('.' or '^')
+	static uint32_t CalcNameHash( const AString & name );
+	static uint32_t CalcNameHashNameOnly( const char * nameOnly, size_t len );
+
+	// serialization (used by BFFIncludeCache)
+	void Save( IOStream & stream ) const;
+	uint64_t CalcValueHash() const;
+
+	// allocation statistics (reported with -verbose)
+	static void ResetStats();
+	static uint32_t GetNumVariablesCreated() { return s_NumVariablesCreated; }
+	static uint32_t GetNumValuesCreated() { return s_NumValuesCreated; }
+	static uint32_t GetNumValuesShared() { return s_NumValuesShared; }
 	
 private:
 	friend class BFFStackFrame;
+	friend class BFFIncludeCache;
+
+	static BFFVariable * Load( IOStream & stream );
 
 	explicit BFFVariable( const BFFVariable & other );
+	explicit BFFVariable( const AString & name, const BFFVariable & other ); // share value of other
 
     explicit BFFVariable( const AString & name, VarType type );
 	explicit BFFVariable( const AString & name, const AString & value );
@@ -89,21 +109,48 @@ private:
 	void SetValueInt( int i );
 	void SetValueStruct( const Array< const BFFVariable * > & members );
 	void SetValueArrayOfStructs( const Array< const BFFVariable * > & values );
+	void SetValueFrom( const BFFVariable & other );
+
+	// Value storage for strings, arrays and structs. Values are reference
+	// counted and shared between copies of a variable, so must not be
+	// modified once shared (a new value is created instead).
+	class SharedValue
+	{
+	public:
+		explicit SharedValue();
+		~SharedValue();
+
+		uint32_t				m_RefCount;
+		AString					m_StringValue;
+		Array< AString >		m_ArrayValues;
+		Array< BFFVariable * >	m_Variables; // struct members or array of structs (owned)
+	};
+
+	inline const SharedValue & GetValue() const { return m_Value ? *m_Value : s_EmptyValue; }
+	inline const SharedValue & GetValueIfType( VarType type ) const { return ( m_Type == type ) ? GetValue() : s_EmptyValue; }
+	SharedValue * GetMutableValue();
+	void ShareValue( SharedValue * value );
+	void ReleaseValue();
 
 	AString m_Name;
+	uint32_t m_NameHash;
 	VarType	m_Type;
 
 	mutable bool m_Frozen;
 
 	//
-	AString				m_StringValue;
 	bool				m_BoolValue;
-	Array< AString >	m_ArrayValues;
 	int					m_IntValue;
-	Array< BFFVariable * > m_StructMembers;
-	Array< BFFVariable * > m_ArrayOfStructs;
+	SharedValue *		m_Value; // string, array and struct types
+
+	BFFVariable *		m_NextInFrame; // BFFStackFrame hash bucket linked list pointer
 
 	static const char * s_TypeNames[ MAX_VAR_TYPES ];
+	static const SharedValue s_EmptyValue;
+
+	static uint32_t s_NumVariablesCreated;
+	static uint32_t s_NumValuesCreated;
+	static uint32_t s_NumValuesShared;
 };
 
 //------------------------------------------------------------------------------
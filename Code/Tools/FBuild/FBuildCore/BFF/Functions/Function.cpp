@@ -170,6 +170,13 @@ Function::~Function()
 	return false;
 }
 
+// AffectsOnlyVariables
+//------------------------------------------------------------------------------
+/*virtual*/ bool Function::AffectsOnlyVariables() const
+{
+	return false;
+}
+
 // ParseFunction
 //------------------------------------------------------------------------------
 /*virtual*/ bool Function::ParseFunction( NodeGraph & nodeGraph,
@@ -843,6 +850,38 @@ bool Function::ProcessAlias( NodeGraph & nodeGraph, const BFFIterator & iter, De
 	return true;
 }
 
+// ProcessResourcePool
+//------------------------------------------------------------------------------
+bool Function::ProcessResourcePool( const BFFIterator & iter, Node * node ) const
+{
+	AStackString<> poolName;
+	int32_t jobMemoryMiB( 0 );
+	if ( !GetString( iter, poolName, ".Pool" ) ||
+		 !GetInt( iter, jobMemoryMiB, ".PoolJobMemoryMB", 0, false, 0, 1024 * 1024 ) )
+	{
+		return false; // GetString/GetInt will have emitted an error
+	}
+	if ( poolName.IsEmpty() )
+	{
+		return true; // not pooled
+	}
+
+	// pools must be defined (in Settings) before use
+	const Array< ResourcePool > & pools = FBuild::Get().GetResourcePools();
+	for ( size_t i = 0; i < pools.GetSize(); ++i )
+	{
+		if ( pools[ i ].GetName() == poolName )
+		{
+			node->m_ResourcePool = (uint32_t)( i + 1 );
+			node->m_ResourcePoolJobMemoryMiB = (uint32_t)jobMemoryMiB;
+			return true;
+		}
+	}
+
+	Error::Error_1107_ResourcePoolNotDefined( iter, this, ".Pool", poolName );
+	return false;
+}
+
 // GetNameForNode
 //------------------------------------------------------------------------------
 bool Function::GetNameForNode( NodeGraph & nodeGraph, const BFFIterator & iter, const ReflectionInfo * ri, AString & name ) const
@@ -48,6 +48,10 @@ public:
 	inline bool GetSeen() const { return m_Seen; }
 	inline void SetSeen() const { m_Seen = true; }
 
+	// does this function only manipulate variables? (i.e. creates no nodes
+	// and has no other side effects, so can be skipped by the BFFIncludeCache)
+	virtual bool AffectsOnlyVariables() const;
+
 	// most functions don't need to override this
 	virtual bool ParseFunction( NodeGraph & nodeGraph,
 								const BFFIterator & functionNameStart,
@@ -128,6 +132,9 @@ protected:
 	bool ProcessAlias( NodeGraph & nodeGraph, const BFFIterator & iter, Node * nodeToAlias ) const;
 	bool ProcessAlias( NodeGraph & nodeGraph, const BFFIterator & iter, Dependencies & nodesToAlias ) const;
 
+	// helper function to assign a node to a resource pool defined in Settings
+	bool ProcessResourcePool( const BFFIterator & iter, Node * node ) const;
+
 	// Reflection based property population
 	bool GetNameForNode( NodeGraph & nodeGraph, const BFFIterator & iter, const ReflectionInfo * ri, AString & name ) const;
 	bool PopulateProperties( NodeGraph & nodeGraph, const BFFIterator & iter, Node * node ) const;
@@ -46,9 +46,11 @@ FunctionCopy::FunctionCopy()
 
 	// Optional
 	AStackString<> sourceBasePath;
-	if ( !GetString( funcStartIter, sourceBasePath, ".SourceBasePath", false ) )
+	bool useHardLinks = false;
+	if ( !GetString( funcStartIter, sourceBasePath, ".SourceBasePath", false ) ||
+		 !GetBool( funcStartIter, useHardLinks, ".UseHardLinks", false ) )
 	{
-		return false; // GetString will have emitted errors
+		return false; // GetString/GetBool will have emitted errors
 	}
 
 	// Canonicalize the SourceBasePath
@@ -160,6 +162,7 @@ FunctionCopy::FunctionCopy()
 		CopyFileNode * copyFileNode = nodeGraph.CreateCopyFileNode( dst );
 		copyFileNode->m_Source = srcNode->GetName();
 		copyFileNode->m_PreBuildDependencyNames = preBuildDependencyNames;
+		copyFileNode->m_UseHardLinks = useHardLinks;
 		if ( !copyFileNode->Initialize( nodeGraph, funcStartIter, this ) )
 		{
 			return false; // Initialize will have emitted an error
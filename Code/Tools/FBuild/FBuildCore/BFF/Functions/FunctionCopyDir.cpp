@@ -43,9 +43,11 @@ FunctionCopyDir::FunctionCopyDir()
 	Array< AString > patterns;
 	bool recurse = true;
 	Array< AString > excludePaths;
+	bool useHardLinks = false;
 	if ( !GetStrings( funcStartIter, patterns, ".SourcePathsPattern" ) ||
 		 !GetBool( funcStartIter, recurse, ".SourcePathsRecurse", true ) || // recursive by default
-		 !GetStrings( funcStartIter, excludePaths, ".SourceExcludePaths" ) )
+		 !GetStrings( funcStartIter, excludePaths, ".SourceExcludePaths" ) ||
+		 !GetBool( funcStartIter, useHardLinks, ".UseHardLinks", false ) )
 	{
 		return false; // Get* will have emitted error
 	}
@@ -87,7 +89,7 @@ FunctionCopyDir::FunctionCopyDir()
 	}
 
 	// create our node
-	nodeGraph.CreateCopyDirNode( m_AliasForFunction, staticDeps, destPath, preBuildDeps );
+	nodeGraph.CreateCopyDirNode( m_AliasForFunction, staticDeps, destPath, preBuildDeps, useHardLinks );
 	return true;
 }
 
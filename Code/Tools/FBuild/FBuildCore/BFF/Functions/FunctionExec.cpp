@@ -36,12 +36,14 @@ FunctionExec::FunctionExec()
 	const BFFVariable * workingDirV;
 	int32_t expectedReturnCode;
 	bool useStdOutAsOutput;
+	bool cacheable;
 	if ( !GetString( funcStartIter, outputV,		".ExecOutput", true ) ||
 		 !GetString( funcStartIter, executableV,	".ExecExecutable", true ) ||
 		 !GetString( funcStartIter, argsV,			".ExecArguments" ) ||
 		 !GetString( funcStartIter, workingDirV,	".ExecWorkingDir" ) ||
 		 !GetInt( funcStartIter, expectedReturnCode, ".ExecReturnCode", 0, false ) ||
-		 !GetBool( funcStartIter, useStdOutAsOutput, ".ExecUseStdOutAsOutput", false, false))
+		 !GetBool( funcStartIter, useStdOutAsOutput, ".ExecUseStdOutAsOutput", false, false) ||
+		 !GetBool( funcStartIter, cacheable, ".ExecCacheable", false, false ) )
 	{
 		return false;
 	}
@@ -107,8 +109,14 @@ FunctionExec::FunctionExec()
 										   workingDir, 
 										   expectedReturnCode,
 										   preBuildDependencies,
-										   useStdOutAsOutput);
-	
+										   useStdOutAsOutput,
+										   cacheable );
+
+	if ( !ProcessResourcePool( funcStartIter, outputNode ) )
+	{
+		return false; // ProcessResourcePool will have emitted an error
+	}
+
 	return ProcessAlias( nodeGraph, funcStartIter, outputNode );
 }
 
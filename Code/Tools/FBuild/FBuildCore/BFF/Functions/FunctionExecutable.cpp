@@ -163,6 +163,16 @@ FunctionExecutable::FunctionExecutable()
 		flags |= LinkerNode::LINK_OBJECTS;
 	}
 
+	bool allowCaching = false;
+	if ( GetBool( funcStartIter, allowCaching, ".LinkerAllowCaching", false, false ) == false )
+	{
+		return false;
+	}
+	if ( allowCaching )
+	{
+		flags |= LinkerNode::LINK_FLAG_ALLOW_CACHING;
+	}
+
 	// get inputs not passed through 'LibraryNodes' (i.e. directly specified on the cmd line)
 	Dependencies otherLibraryNodes( 64, true );
 	if ( ( flags & ( LinkerNode::LINK_FLAG_MSVC | LinkerNode::LINK_FLAG_GCC | LinkerNode::LINK_FLAG_SNC | LinkerNode::LINK_FLAG_ORBIS_LD | LinkerNode::LINK_FLAG_GREENHILLS_ELXR | LinkerNode::LINK_FLAG_CODEWARRIOR_LD ) ) != 0 )
@@ -212,6 +222,11 @@ FunctionExecutable::FunctionExecutable()
 							  linkerStampExeArgs );
 	}
 
+	if ( !ProcessResourcePool( funcStartIter, n ) )
+	{
+		return false; // ProcessResourcePool will have emitted an error
+	}
+
 	return ProcessAlias( nodeGraph, funcStartIter, n );
 }
 
@@ -36,6 +36,13 @@ FunctionForEach::FunctionForEach()
 	return true;
 }
 
+// AffectsOnlyVariables
+//------------------------------------------------------------------------------
+/*virtual*/ bool FunctionForEach::AffectsOnlyVariables() const
+{
+	return true; // functions within the loop body are considered individually
+}
+
 //------------------------------------------------------------------------------
 /*virtual*/ bool FunctionForEach::ParseFunction(
 					NodeGraph & nodeGraph,
@@ -201,7 +208,7 @@ FunctionForEach::FunctionForEach()
 			}
 			else if ( arrayVars[ j ]->GetType() == BFFVariable::VAR_ARRAY_OF_STRUCTS )
 			{
-				BFFStackFrame::SetVarStruct( localNames[ j ], arrayVars[ j ]->GetArrayOfStructs()[ i ]->GetStructMembers(), &loopStackFrame );
+				BFFStackFrame::SetVar( localNames[ j ], arrayVars[ j ]->GetArrayOfStructs()[ i ], &loopStackFrame );
 			}
 			else
 			{
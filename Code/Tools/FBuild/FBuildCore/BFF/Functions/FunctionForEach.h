@@ -18,6 +18,7 @@ public:
 
 	virtual bool AcceptsHeader() const override;
 	virtual bool NeedsHeader() const override;
+	virtual bool AffectsOnlyVariables() const override;
 	virtual bool ParseFunction( NodeGraph & nodeGraph,
 								const BFFIterator & functionNameStart,
 								const BFFIterator * functionBodyStartToken, 
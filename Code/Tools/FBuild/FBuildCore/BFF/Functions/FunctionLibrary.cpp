@@ -236,6 +236,17 @@ FunctionLibrary::FunctionLibrary()
 
 	uint32_t flags = LibraryNode::DetermineFlags( librarian->GetString() );
 
+	// built-in archiver (ar style librarians only)
+	bool librarianNative = false;
+	if ( !GetBool( funcStartIter, librarianNative, ".LibrarianNative", false, false ) )
+	{
+		return false; // GetBool will have emitted an error
+	}
+	if ( librarianNative && ( ( flags & LibraryNode::LIB_FLAG_AR ) != 0 ) )
+	{
+		flags |= LibraryNode::LIB_FLAG_NATIVE_AR;
+	}
+
 	// Create library node which depends on the single file or list
 	if ( nodeGraph.FindNode( outputLib->GetString() ) )
 	{
@@ -280,6 +291,11 @@ FunctionLibrary::FunctionLibrary()
 	libNode->m_ExtraPDBPath = extraPDBPath;
 	libNode->m_ExtraASMPath = extraASMPath;
 
+	if ( !ProcessResourcePool( funcStartIter, libNode ) )
+	{
+		return false; // ProcessResourcePool will have emitted an error
+	}
+
 	return ProcessAlias( nodeGraph, funcStartIter, libNode );
 }
 
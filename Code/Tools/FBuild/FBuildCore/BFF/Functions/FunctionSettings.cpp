@@ -11,9 +11,11 @@
 #include "Tools/FBuild/FBuildCore/BFF/BFFIterator.h"
 #include "Tools/FBuild/FBuildCore/BFF/BFFStackFrame.h"
 #include "Tools/FBuild/FBuildCore/BFF/BFFVariable.h"
+#include "Tools/FBuild/FBuildCore/Error.h"
 
 #include "Core/Containers/AutoPtr.h"
 #include "Core/Env/Env.h"
+#include "Core/Strings/AStackString.h"
 
 // Static Data
 //------------------------------------------------------------------------------
@@ -88,6 +90,12 @@ FunctionSettings::FunctionSettings()
 		ProcessEnvironment( environment );
 	}
 
+	// "Pools"
+	if ( !ProcessResourcePools( funcStartIter ) )
+	{
+		return false;
+	}
+
 	return true;
 }
 
@@ -131,4 +139,98 @@ void FunctionSettings::ProcessEnvironment( const Array< AString > & envStrings )
 	FBuild::Get().SetEnvironmentString( envString.Get(), size, libEnvVar );
 }
 
+// ProcessResourcePools
+//------------------------------------------------------------------------------
+bool FunctionSettings::ProcessResourcePools( const BFFIterator & iter ) const
+{
+	const BFFVariable * poolsVar = BFFStackFrame::GetVar( ".Pools" );
+	if ( poolsVar == nullptr )
+	{
+		return true; // no pools
+	}
+	if ( poolsVar->IsArrayOfStructs() == false )
+	{
+		Error::Error_1050_PropertyMustBeOfType( iter, this, ".Pools", poolsVar->GetType(), BFFVariable::VAR_ARRAY_OF_STRUCTS );
+		return false;
+	}
+
+	const Array< const BFFVariable * > & structs = poolsVar->GetArrayOfStructs();
+	Array< ResourcePool > pools( structs.GetSize(), false );
+	for ( const BFFVariable * s : structs )
+	{
+		// .PoolName must be provided and unique
+		const BFFVariable * nameVar = nullptr;
+		for ( const BFFVariable * member : s->GetStructMembers() )
+		{
+			if ( member->GetName() == ".PoolName" )
+			{
+				nameVar = member;
+				break;
+			}
+		}
+		if ( nameVar == nullptr )
+		{
+			Error::Error_1101_MissingProperty( iter, this, AStackString<>( ".PoolName" ) );
+			return false;
+		}
+		if ( nameVar->IsString() == false )
+		{
+			Error::Error_1050_PropertyMustBeOfType( iter, this, ".PoolName", nameVar->GetType(), BFFVariable::VAR_STRING );
+			return false;
+		}
+		const AString & name = nameVar->GetString();
+		for ( const ResourcePool & pool : pools )
+		{
+			if ( pool.GetName() == name )
+			{
+				Error::Error_1100_AlreadyDefined( iter, this, name );
+				return false;
+			}
+		}
+
+		// limits are optional (0 = unlimited)
+		uint32_t maxJobs( 0 );
+		uint32_t memoryMiB( 0 );
+		uint32_t jobMemoryMiB( 0 );
+		if ( !GetIntFromStruct( iter, s, ".PoolMaxJobs", maxJobs ) ||
+			 !GetIntFromStruct( iter, s, ".PoolMemoryMB", memoryMiB ) ||
+			 !GetIntFromStruct( iter, s, ".PoolJobMemoryMB", jobMemoryMiB ) )
+		{
+			return false; // GetIntFromStruct will have emitted an error
+		}
+
+		pools.Append( ResourcePool( name, maxJobs, memoryMiB, jobMemoryMiB ) );
+		FLOG_INFO( "Pool: '%s' (MaxJobs: %u, MemoryMB: %u)", name.Get(), maxJobs, memoryMiB );
+	}
+
+	FBuild::Get().SetResourcePools( pools );
+	return true;
+}
+
+// GetIntFromStruct
+//------------------------------------------------------------------------------
+bool FunctionSettings::GetIntFromStruct( const BFFIterator & iter, const BFFVariable * s, const char * name, uint32_t & result ) const
+{
+	for ( const BFFVariable * member : s->GetStructMembers() )
+	{
+		if ( member->GetName() != name )
+		{
+			continue;
+		}
+		if ( member->IsInt() == false )
+		{
+			Error::Error_1050_PropertyMustBeOfType( iter, this, name, member->GetType(), BFFVariable::VAR_INT );
+			return false;
+		}
+		if ( ( member->GetInt() < 0 ) || ( member->GetInt() > 1024 * 1024 ) )
+		{
+			Error::Error_1054_IntegerOutOfRange( iter, this, name, 0, 1024 * 1024 );
+			return false;
+		}
+		result = (uint32_t)member->GetInt();
+		return true;
+	}
+	return true; // optional - result is unchanged
+}
+
 //------------------------------------------------------------------------------
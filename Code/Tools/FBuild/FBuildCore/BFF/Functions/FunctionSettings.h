@@ -27,6 +27,8 @@ protected:
 
 private:
 	void ProcessEnvironment( const Array< AString > & envStrings ) const;
+	bool ProcessResourcePools( const BFFIterator & iter ) const;
+	bool GetIntFromStruct( const BFFIterator & iter, const BFFVariable * s, const char * name, uint32_t & result ) const;
 
 	static AString s_CachePath;
 };
@@ -52,6 +52,11 @@ FunctionTest::FunctionTest()
         return false;
     }
 
+	if ( !ProcessResourcePool( funcStartIter, testNode ) )
+	{
+		return false; // ProcessResourcePool will have emitted an error
+	}
+
 	// handle alias creation
 	return ProcessAlias( nodeGraph, funcStartIter, testNode );
 }
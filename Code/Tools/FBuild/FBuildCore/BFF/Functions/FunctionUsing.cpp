@@ -39,6 +39,13 @@ FunctionUsing::FunctionUsing()
 	return false;
 }
 
+// AffectsOnlyVariables
+//------------------------------------------------------------------------------
+/*virtual*/ bool FunctionUsing::AffectsOnlyVariables() const
+{
+	return true;
+}
+
 //------------------------------------------------------------------------------
 /*virtual*/ bool FunctionUsing::ParseFunction( NodeGraph & /*nodeGraph*/,
 											   const BFFIterator & functionNameStart,
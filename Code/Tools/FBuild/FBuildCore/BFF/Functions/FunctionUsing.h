@@ -20,6 +20,7 @@ protected:
 	virtual bool AcceptsHeader() const override;
 	virtual bool NeedsHeader() const override;
 	virtual bool NeedsBody() const override;
+	virtual bool AffectsOnlyVariables() const override;
 
 	virtual bool ParseFunction( NodeGraph & nodeGraph,
 								const BFFIterator & functionNameStart,
@@ -0,0 +1,612 @@
+// OutputCache - Cache outputs of nodes keyed on the content of their inputs
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Tools/FBuild/FBuildCore/PrecompiledHeader.h"
+
+#include "OutputCache.h"
+
+// FBuild
+#include "Tools/FBuild/FBuildCore/Cache/ICache.h"
+#include "Tools/FBuild/FBuildCore/FBuild.h"
+#include "Tools/FBuild/FBuildCore/FLog.h"
+#include "Tools/FBuild/FBuildCore/Graph/Node.h"
+#include "Tools/FBuild/FBuildCore/Graph/NodeGraph.h"
+#include "Tools/FBuild/FBuildCore/Helpers/Args.h"
+#include "Tools/FBuild/FBuildCore/Helpers/BuildTrace.h"
+#include "Tools/FBuild/FBuildCore/Helpers/Compressor.h"
+#include "Tools/FBuild/FBuildCore/Helpers/MultiBuffer.h"
+
+// Core
+#include "Core/Env/Env.h"
+#include "Core/FileIO/FileIO.h"
+#include "Core/FileIO/FileStream.h"
+#include "Core/FileIO/PathUtils.h"
+#include "Core/Math/xxHash.h"
+#include "Core/Mem/Mem.h"
+#include "Core/Strings/AStackString.h"
+#include "Core/Time/Timer.h"
+
+// system
+#if defined( __WINDOWS__ )
+	#include <windows.h> // for FILETIME etc
+#endif
+#if defined( __OSX__ ) || defined( __LINUX__ )
+	#include <sys/time.h>
+#endif
+
+// CONSTRUCTOR
+//------------------------------------------------------------------------------
+OutputCache::Key::Key()
+	: m_InputHashes( 64, true )
+	, m_ToolHashes( 8, true )
+	, m_StringHashes( 8, true )
+	, m_Buffer( nullptr )
+	, m_NumInputFiles( 0 )
+	, m_NumInputBytes( 0 )
+{
+}
+
+// DESTRUCTOR
+//------------------------------------------------------------------------------
+OutputCache::Key::~Key()
+{
+	FREE( m_Buffer );
+}
+
+// AddInputFile
+//------------------------------------------------------------------------------
+bool OutputCache::Key::AddInputFile( const AString & fileName )
+{
+	if ( m_Buffer == nullptr )
+	{
+		m_Buffer = (char *)ALLOC( FILE_CHUNK_SIZE );
+	}
+
+	uint64_t fileSize( 0 );
+	if ( HashFile( fileName, m_Buffer, m_InputHashes, fileSize ) == false )
+	{
+		return false;
+	}
+	++m_NumInputFiles;
+	m_NumInputBytes += fileSize;
+	return true;
+}
+
+// AddString
+//------------------------------------------------------------------------------
+void OutputCache::Key::AddString( const AString & string )
+{
+	// hash each string separately so boundaries between them are significant
+	m_StringHashes.Append( xxHash::Calc64( string ) );
+}
+
+// AddPath
+//------------------------------------------------------------------------------
+void OutputCache::Key::AddPath( const AString & path, const AString & baseDir )
+{
+	// paths within the base dir are made relative, so keys are
+	// consistent between different checkout locations
+	if ( ( baseDir.IsEmpty() == false ) && PathUtils::PathBeginsWith( path, baseDir ) )
+	{
+		m_StringHashes.Append( xxHash::Calc64( path.Get() + baseDir.GetLength(), path.GetLength() - baseDir.GetLength() ) );
+		return;
+	}
+	AddString( path );
+}
+
+// AddArgs
+//------------------------------------------------------------------------------
+void OutputCache::Key::AddArgs( const AString & args, const AString & baseDir )
+{
+	// as AddPath, but for every occurrence of the base dir
+	if ( baseDir.IsEmpty() == false )
+	{
+		AStackString< 4096 > relativeArgs( args );
+		relativeArgs.Replace( baseDir.Get(), "" );
+		AddString( relativeArgs );
+		return;
+	}
+	AddString( args );
+}
+
+// AddWorkingDir
+//------------------------------------------------------------------------------
+void OutputCache::Key::AddWorkingDir( const AString & workingDir, AString & baseDir )
+{
+	AStackString<> rootDir( FBuild::Get().GetWorkingDir() );
+	PathUtils::EnsureTrailingSlash( rootDir );
+	baseDir = rootDir;
+	if ( workingDir.IsEmpty() == false )
+	{
+		NodeGraph::CleanPath( workingDir, baseDir );
+		PathUtils::EnsureTrailingSlash( baseDir );
+	}
+	AddPath( baseDir, rootDir );
+}
+
+// AddArgsInputFiles
+//------------------------------------------------------------------------------
+bool OutputCache::Key::AddArgsInputFiles( const AString & args, bool msvcStyle, AString & unreadableFile )
+{
+	Array< AString > tokens( 64, true );
+	args.Tokenize( tokens );
+
+	ArgsInputs inputs;
+	if ( msvcStyle )
+	{
+		GetArgsInputsMSVC( tokens, inputs );
+	}
+	else
+	{
+		GetArgsInputsGCC( tokens, inputs );
+	}
+
+	// explicitly named files must be readable
+	for ( const AString & file : inputs.m_Files )
+	{
+		AStackString<> fullPath;
+		NodeGraph::CleanPath( file, fullPath );
+		if ( AddInputFile( fullPath ) == false )
+		{
+			unreadableFile = fullPath;
+			return false;
+		}
+	}
+
+	Array< AString > searchDirs( inputs.m_SearchDirs.GetSize(), false );
+	for ( const AString & dir : inputs.m_SearchDirs )
+	{
+		AStackString<> fullPath;
+		NodeGraph::CleanPath( dir, fullPath );
+		PathUtils::EnsureTrailingSlash( fullPath );
+		searchDirs.Append( fullPath );
+	}
+
+	// libraries are searched for like the linker does
+	for ( const AString & library : inputs.m_Libraries )
+	{
+		Array< AString > candidates( 2, false );
+		const bool searchWorkingDir = ( library.BeginsWith( "-l" ) == false );
+		if ( searchWorkingDir )
+		{
+			candidates.Append( library );
+		}
+		else
+		{
+			// -l<name> prefers lib<name>.so over lib<name>.a
+			AStackString<> name( "lib" );
+			name += ( library.Get() + 2 );
+			AStackString<> sharedLib( name );
+			sharedLib += ".so";
+			AStackString<> staticLib( name );
+			staticLib += ".a";
+			candidates.Append( sharedLib );
+			candidates.Append( staticLib );
+		}
+
+		AStackString<> found;
+		if ( searchWorkingDir && FileIO::FileExists( library.Get() ) )
+		{
+			NodeGraph::CleanPath( library, found );
+		}
+		for ( size_t i = 0; found.IsEmpty() && ( i < searchDirs.GetSize() ); ++i )
+		{
+			for ( const AString & candidate : candidates )
+			{
+				AStackString<> path( searchDirs[ i ] );
+				path += candidate;
+				if ( FileIO::FileExists( path.Get() ) )
+				{
+					found = path;
+					break;
+				}
+			}
+		}
+
+		if ( found.IsEmpty() )
+		{
+			// only in the default search paths (i.e. system libraries, which
+			// are considered part of the toolchain)
+			AddString( library );
+			continue;
+		}
+		if ( AddInputFile( found ) == false )
+		{
+			unreadableFile = found;
+			return false;
+		}
+	}
+	return true;
+}
+
+// GetArgsInputsGCC
+//------------------------------------------------------------------------------
+/*static*/ void OutputCache::Key::GetArgsInputsGCC( const Array< AString > & tokens, ArgsInputs & inputs )
+{
+	// options with a value which isn't an input
+	static const char * const valueOptions[] = { "-o", "-rpath", "-rpath-link", "-soname", "-h", "-Map", "-z", "-e", "-u",
+												 "-install_name", "-arch", "-target", "-isysroot", "--sysroot", "-framework", "-x" };
+	// options with a file as a value (either as the next token, or after '=')
+	static const char * const fileOptions[] = { "-T", "--script", "--version-script", "--dynamic-list",
+												"-exported_symbols_list", "-unexported_symbols_list", "-order_file" };
+
+	Array< AString > linkerArgs( 8, true ); // passed through the compiler driver (-Wl,<args> and -Xlinker <arg>)
+
+	const size_t numTokens = tokens.GetSize();
+	for ( size_t i = 0; i < numTokens; ++i )
+	{
+		AStackString<> token;
+		Args::StripQuotes( tokens[ i ].Get(), tokens[ i ].GetEnd(), token );
+		const AString * next = ( ( i + 1 ) < numTokens ) ? &tokens[ i + 1 ] : nullptr;
+
+		// inputs and outputs (%1, %2 etc) are handled by the caller
+		if ( token.IsEmpty() || token.Find( '%' ) )
+		{
+			continue;
+		}
+
+		if ( token.BeginsWith( '-' ) == false )
+		{
+			AddBareArgsInput( token, inputs );
+			continue;
+		}
+
+		if ( token.BeginsWith( "-Wl," ) )
+		{
+			AStackString<> wlArgs( token.Get() + 4 );
+			wlArgs.Tokenize( linkerArgs, ',' );
+			continue;
+		}
+		if ( token == "-Xlinker" )
+		{
+			if ( next )
+			{
+				linkerArgs.Append( *next );
+				++i;
+			}
+			continue;
+		}
+
+		// search dirs and libraries (-L<dir>, -L <dir>, -l<name>, -l <name>)
+		if ( token.BeginsWith( "-L" ) || token.BeginsWith( "-l" ) )
+		{
+			AStackString<> value( token.Get() + 2 );
+			if ( value.IsEmpty() && next )
+			{
+				Args::StripQuotes( next->Get(), next->GetEnd(), value );
+				++i;
+			}
+			if ( value.IsEmpty() )
+			{
+				continue;
+			}
+			if ( token[ 1 ] == 'L' )
+			{
+				inputs.m_SearchDirs.Append( value );
+			}
+			else if ( value.BeginsWith( ':' ) )
+			{
+				inputs.m_Libraries.Append( AStackString<>( value.Get() + 1 ) ); // -l:<filename>
+			}
+			else
+			{
+				AStackString<> library( "-l" );
+				library += value;
+				inputs.m_Libraries.Append( library );
+			}
+			continue;
+		}
+
+		bool handled = false;
+		for ( const char * option : fileOptions )
+		{
+			const size_t optionLen = AString::StrLen( option );
+			if ( token == option )
+			{
+				if ( next )
+				{
+					AStackString<> value;
+					Args::StripQuotes( next->Get(), next->GetEnd(), value );
+					inputs.m_Files.Append( value );
+					++i;
+				}
+				handled = true;
+				break;
+			}
+			const bool joinedValue = ( optionLen == 2 ); // -T<file>
+			if ( token.BeginsWith( option ) && ( ( token[ optionLen ] == '=' ) || joinedValue ) )
+			{
+				const char * value = token.Get() + optionLen + ( ( token[ optionLen ] == '=' ) ? 1 : 0 );
+				inputs.m_Files.Append( AStackString<>( value ) );
+				handled = true;
+				break;
+			}
+		}
+		if ( handled )
+		{
+			continue;
+		}
+
+		for ( const char * option : valueOptions )
+		{
+			if ( token == option )
+			{
+				++i; // skip value
+				break;
+			}
+		}
+	}
+
+	// args passed through to the linker
+	if ( linkerArgs.IsEmpty() == false )
+	{
+		GetArgsInputsGCC( linkerArgs, inputs );
+	}
+}
+
+// GetArgsInputsMSVC
+//------------------------------------------------------------------------------
+/*static*/ void OutputCache::Key::GetArgsInputsMSVC( const Array< AString > & tokens, ArgsInputs & inputs )
+{
+	for ( const AString & rawToken : tokens )
+	{
+		AStackString<> token;
+		Args::StripQuotes( rawToken.Get(), rawToken.GetEnd(), token );
+
+		// inputs and outputs (%1, %2 etc) are handled by the caller
+		if ( token.IsEmpty() || token.Find( '%' ) )
+		{
+			continue;
+		}
+
+		// response files
+		if ( token.BeginsWith( '@' ) )
+		{
+			inputs.m_Files.Append( AStackString<>( token.Get() + 1 ) );
+			continue;
+		}
+
+		if ( ( token.BeginsWith( '/' ) == false ) && ( token.BeginsWith( '-' ) == false ) )
+		{
+			AddBareArgsInput( token, inputs );
+			continue;
+		}
+
+		const char * option = token.Get() + 1;
+		AStackString<> value;
+		const char * colon = token.Find( ':' );
+		if ( colon )
+		{
+			Args::StripQuotes( colon + 1, token.GetEnd(), value );
+		}
+		if ( value.IsEmpty() )
+		{
+			continue;
+		}
+
+		if ( AString::StrNCmpI( option, "LIBPATH:", 8 ) == 0 )
+		{
+			inputs.m_SearchDirs.Append( value );
+		}
+		else if ( AString::StrNCmpI( option, "WHOLEARCHIVE:", 13 ) == 0 )
+		{
+			inputs.m_Libraries.Append( value );
+		}
+		else if ( AString::StrNCmpI( option, "ORDER:", 6 ) == 0 )
+		{
+			inputs.m_Files.Append( AStackString<>( value.BeginsWith( '@' ) ? ( value.Get() + 1 ) : value.Get() ) );
+		}
+		else if ( ( AString::StrNCmpI( option, "DEF:", 4 ) == 0 ) ||
+				  ( AString::StrNCmpI( option, "NATVIS:", 7 ) == 0 ) ||
+				  ( AString::StrNCmpI( option, "MANIFESTINPUT:", 14 ) == 0 ) )
+		{
+			inputs.m_Files.Append( value );
+		}
+	}
+}
+
+// AddBareArgsInput
+//------------------------------------------------------------------------------
+/*static*/ void OutputCache::Key::AddBareArgsInput( const AString & token, ArgsInputs & inputs )
+{
+	// paths must exist, but plain file names can be found in the search dirs
+	if ( token.Find( '/' ) || token.Find( '\\' ) )
+	{
+		inputs.m_Files.Append( token );
+	}
+	else
+	{
+		inputs.m_Libraries.Append( token );
+	}
+}
+
+// SetTool
+//------------------------------------------------------------------------------
+bool OutputCache::Key::SetTool( const AString & exeName )
+{
+	if ( m_Buffer == nullptr )
+	{
+		m_Buffer = (char *)ALLOC( FILE_CHUNK_SIZE );
+	}
+
+	m_ToolHashes.Clear();
+	uint64_t fileSize( 0 );
+	return HashFile( exeName, m_Buffer, m_ToolHashes, fileSize );
+}
+
+// GetCacheName
+//------------------------------------------------------------------------------
+void OutputCache::Key::GetCacheName( AString & cacheName ) const
+{
+	const uint64_t inputsHash = xxHash::Calc64( m_InputHashes.Begin(), m_InputHashes.GetSize() * sizeof( uint64_t ) );
+	const uint32_t stringsHash = xxHash::Calc32( m_StringHashes.Begin(), m_StringHashes.GetSize() * sizeof( uint64_t ) );
+	const uint64_t toolHash = xxHash::Calc64( m_ToolHashes.Begin(), m_ToolHashes.GetSize() * sizeof( uint64_t ) );
+	FBuild::Get().GetCacheFileName( inputsHash, stringsHash, toolHash, m_NumInputBytes, cacheName );
+}
+
+// HashFile
+//------------------------------------------------------------------------------
+/*static*/ bool OutputCache::Key::HashFile( const AString & fileName, char * buffer, Array< uint64_t > & hashes, uint64_t & fileSize )
+{
+	FileStream fs;
+	if ( fs.Open( fileName.Get(), FileStream::READ_ONLY ) == false )
+	{
+		return false;
+	}
+
+	// files are hashed in chunks to avoid holding large inputs in memory
+	fileSize = fs.GetFileSize();
+	hashes.Append( fileSize );
+	uint64_t remaining = fileSize;
+	while ( remaining > 0 )
+	{
+		const uint64_t chunkSize = ( remaining < FILE_CHUNK_SIZE ) ? remaining : FILE_CHUNK_SIZE;
+		if ( fs.ReadBuffer( buffer, chunkSize ) != chunkSize )
+		{
+			return false;
+		}
+		hashes.Append( xxHash::Calc64( buffer, (size_t)chunkSize ) );
+		remaining -= chunkSize;
+	}
+	return true;
+}
+
+// IsReadEnabled
+//------------------------------------------------------------------------------
+/*static*/ bool OutputCache::IsReadEnabled()
+{
+	return ( FBuild::Get().GetOptions().m_UseCacheRead && ( FBuild::Get().GetCache() != nullptr ) );
+}
+
+// IsWriteEnabled
+//------------------------------------------------------------------------------
+/*static*/ bool OutputCache::IsWriteEnabled()
+{
+	return ( FBuild::Get().GetOptions().m_UseCacheWrite && ( FBuild::Get().GetCache() != nullptr ) );
+}
+
+// Retrieve
+//------------------------------------------------------------------------------
+/*static*/ bool OutputCache::Retrieve( const Node * node, const AString & cacheName, const Array< AString > & outputFiles )
+{
+	ASSERT( IsReadEnabled() );
+
+	Timer t;
+	BuildTrace::Section traceSection( node, BuildTrace::PHASE_CACHE_RETRIEVE );
+
+	ICache * cache = FBuild::Get().GetCache();
+	void * cacheData( nullptr );
+	size_t cacheDataSize( 0 );
+	if ( cache->Retrieve( cacheName, cacheData, cacheDataSize ) )
+	{
+		traceSection.SetBytes( cacheDataSize );
+
+		// do decompression
+		Compressor c;
+		if ( c.IsValidData( cacheData, cacheDataSize ) == false )
+		{
+			cache->FreeMemory( cacheData, cacheDataSize );
+			FLOG_WARN( "Cache returned invalid data for '%s'", node->GetName().Get() );
+			return false;
+		}
+		c.Decompress( cacheData );
+		cache->FreeMemory( cacheData, cacheDataSize );
+
+		MultiBuffer buffer( c.GetResult(), c.GetResultSize() );
+		if ( buffer.GetNumFiles() != outputFiles.GetSize() )
+		{
+			FLOG_WARN( "Cache returned unexpected number of files for '%s'", node->GetName().Get() );
+			return false;
+		}
+
+		// Get current "system time" and convert to "file time"
+		#if defined( __WINDOWS__ )
+			SYSTEMTIME st;
+			FILETIME ft;
+			GetSystemTime( &st );
+			if ( FALSE == SystemTimeToFileTime( &st, &ft ) )
+			{
+				FLOG_ERROR( "Failed to convert file time after cache hit '%s' (%u)", node->GetName().Get(), Env::GetLastErr() );
+				return false;
+			}
+			uint64_t fileTimeNow = ( (uint64_t)ft.dwLowDateTime | ( (uint64_t)ft.dwHighDateTime << 32 ) );
+		#endif
+
+		// Extract the files
+		const size_t numFiles = outputFiles.GetSize();
+		for ( size_t i=0; i<numFiles; ++i )
+		{
+			const AString & fileName = outputFiles[ i ];
+			if ( !buffer.ExtractFile( i, fileName ) )
+			{
+				FLOG_ERROR( "Failed to write local file during cache retrieval '%s'", fileName.Get() );
+				return false;
+			}
+
+			// outputs which weren't produced when stored have been removed
+			if ( FileIO::FileExists( fileName.Get() ) == false )
+			{
+				continue;
+			}
+
+			#if defined( __WINDOWS__ )
+				const bool timeSetOK = FileIO::SetFileLastWriteTime( fileName, fileTimeNow );
+			#elif defined( __APPLE__ ) || defined( __LINUX__ )
+				const bool timeSetOK = ( utimes( fileName.Get(), nullptr ) == 0 );
+			#endif
+
+			// set the time on the local file
+			if ( timeSetOK == false )
+			{
+				FLOG_ERROR( "Failed to set timestamp on file after cache hit '%s' (%u)", fileName.Get(), Env::GetLastErr() );
+				return false;
+			}
+		}
+
+		FileIO::WorkAroundForWindowsFilePermissionProblem( outputFiles[ 0 ] );
+
+		FLOG_INFO( "Cache hit: %u ms '%s'\n", uint32_t( t.GetElapsedMS() ), cacheName.Get() );
+		node->SetStatFlag( Node::STATS_CACHE_HIT );
+		return true;
+	}
+
+	FLOG_INFO( "Cache miss: %u ms '%s'\n", uint32_t( t.GetElapsedMS() ), cacheName.Get() );
+	node->SetStatFlag( Node::STATS_CACHE_MISS );
+	return false;
+}
+
+// Store
+//------------------------------------------------------------------------------
+/*static*/ bool OutputCache::Store( const Node * node, const AString & cacheName, const Array< AString > & outputFiles )
+{
+	ASSERT( IsWriteEnabled() );
+
+	Timer t;
+	BuildTrace::Section traceSection( node, BuildTrace::PHASE_CACHE_STORE );
+
+	MultiBuffer buffer;
+	if ( buffer.CreateFromFiles( outputFiles, true ) )
+	{
+		// try to compress
+		Compressor c;
+		c.Compress( buffer.GetData(), (size_t)buffer.GetDataSize() );
+		const void * data = c.GetResult();
+		const size_t dataSize = c.GetResultSize();
+		traceSection.SetBytes( dataSize );
+
+		if ( FBuild::Get().GetCache()->Publish( cacheName, data, dataSize ) )
+		{
+			// cache store complete
+			FLOG_INFO( "Cache store: %u ms '%s'\n", uint32_t( t.GetElapsedMS() ), cacheName.Get() );
+			node->SetStatFlag( Node::STATS_CACHE_STORE );
+			return true;
+		}
+	}
+
+	FLOG_INFO( "Cache store fail: %u ms '%s'\n", uint32_t( t.GetElapsedMS() ), cacheName.Get() );
+	return false;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,80 @@
+// OutputCache - Cache outputs of nodes keyed on the content of their inputs
+//------------------------------------------------------------------------------
+#pragma once
+#ifndef FBUILD_OUTPUTCACHE_H
+#define FBUILD_OUTPUTCACHE_H
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/Containers/Array.h"
+#include "Core/Strings/AString.h"
+
+// Forward Declarations
+//------------------------------------------------------------------------------
+class Node;
+
+// OutputCache
+//------------------------------------------------------------------------------
+// ObjectNodes key the cache on preprocessed source. Other nodes (such as links)
+// have no equivalent, so the key is built from the contents of every input
+// file, the (unexpanded) arguments and the contents of the tool itself.
+class OutputCache
+{
+public:
+	// Key
+	class Key
+	{
+	public:
+		explicit Key();
+		~Key();
+
+		// all are order dependent
+		bool AddInputFile( const AString & fileName );	// returns false if file can't be read
+		void AddString( const AString & string );
+		void AddPath( const AString & path, const AString & baseDir ); // relative to clean baseDir (when within it)
+		void AddArgs( const AString & args, const AString & baseDir ); // paths within clean baseDir made relative
+		void AddWorkingDir( const AString & workingDir, AString & baseDir ); // baseDir receives the clean dir (FBuild's if empty)
+		bool AddArgsInputFiles( const AString & args, bool msvcStyle, AString & unreadableFile ); // returns false if a named file can't be read
+		bool SetTool( const AString & exeName );		// returns false if file can't be read
+
+		void GetCacheName( AString & cacheName ) const;
+
+		inline uint32_t GetNumInputFiles() const { return m_NumInputFiles; }
+		inline uint64_t GetNumInputBytes() const { return m_NumInputBytes; }
+
+	private:
+		static bool HashFile( const AString & fileName, char * buffer, Array< uint64_t > & hashes, uint64_t & fileSize );
+
+		// files named in args, which aren't dependencies in the graph
+		struct ArgsInputs
+		{
+			ArgsInputs() : m_SearchDirs( 8, true ), m_Files( 8, true ), m_Libraries( 16, true ) {}
+			Array< AString >	m_SearchDirs;	// -L<dir>, /LIBPATH:<dir>
+			Array< AString >	m_Files;		// explicit paths (.def files, linker scripts etc.)
+			Array< AString >	m_Libraries;	// file names found in the working dir or the search dirs
+		};
+		static void GetArgsInputsGCC( const Array< AString > & tokens, ArgsInputs & inputs );
+		static void GetArgsInputsMSVC( const Array< AString > & tokens, ArgsInputs & inputs );
+		static void AddBareArgsInput( const AString & token, ArgsInputs & inputs );
+
+		Array< uint64_t >	m_InputHashes;
+		Array< uint64_t >	m_ToolHashes;
+		Array< uint64_t >	m_StringHashes;
+		char *				m_Buffer;
+		uint32_t			m_NumInputFiles;
+		uint64_t			m_NumInputBytes;
+	};
+
+	static bool IsReadEnabled();
+	static bool IsWriteEnabled();
+
+	// outputs are in a fixed order, and outputs which don't exist when storing
+	// are deleted when retrieving
+	static bool Retrieve( const Node * node, const AString & cacheName, const Array< AString > & outputFiles );
+	static bool Store( const Node * node, const AString & cacheName, const Array< AString > & outputFiles );
+
+	enum : uint32_t { FILE_CHUNK_SIZE = ( 1024 * 1024 ) };
+};
+
+//------------------------------------------------------------------------------
+#endif // FBUILD_OUTPUTCACHE_H
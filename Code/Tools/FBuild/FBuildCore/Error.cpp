@@ -497,6 +497,18 @@
 									    token );
 }
 
+// Error_1107_ResourcePoolNotDefined
+//------------------------------------------------------------------------------
+/*static*/ void Error::Error_1107_ResourcePoolNotDefined( const BFFIterator & iter,
+														  const Function * function,
+														  const char * propertyName,
+														  const AString & poolName )
+{
+	FormatError( iter, 1107u, function, "Resource pool '%s' used by '%s' is not defined in Settings .Pools.",
+										poolName.Get(),
+										propertyName );
+}
+
 // Error_1200_ExpectedVar // TODO:C Remove (Deprecated by 1007)
 //------------------------------------------------------------------------------
 /*static*/ void Error::Error_1200_ExpectedVar( const BFFIterator & iter, const Function * function )
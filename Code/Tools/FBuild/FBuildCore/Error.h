@@ -153,6 +153,10 @@ public:
 												 const Function * function,
 												 const char * propertyName,
 												 const char * token );
+	static void Error_1107_ResourcePoolNotDefined( const BFFIterator & iter,
+												   const Function * function,
+												   const char * propertyName,
+												   const AString & poolName );
 
 	// 1200 - 1299 : ForEach specific errors
 	//------------------------------------------------------------------------------
@@ -17,6 +17,7 @@
 #include "Graph/Node.h"
 #include "Graph/NodeGraph.h"
 #include "Graph/NodeProxy.h"
+#include "Helpers/BuildTrace.h"
 #include "Helpers/Report.h"
 #include "Protocol/Client.h"
 #include "Protocol/Protocol.h"
@@ -29,6 +30,7 @@
 #include "Core/FileIO/FileIO.h"
 #include "Core/FileIO/FileStream.h"
 #include "Core/FileIO/MemoryStream.h"
+#include "Core/Mem/SmallBlockAllocator.h"
 #include "Core/Math/xxHash.h"
 #include "Core/Process/SystemMutex.h"
 #include "Core/Profile/Profile.h"
@@ -55,10 +57,10 @@ FBuild::FBuild( const FBuildOptions & options )
 	, m_Client( nullptr )
 	, m_Cache( nullptr )
 	, m_LastProgressOutputTime( 0.0f )
-	, m_LastProgressCalcTime( 0.0f )
 	, m_SmoothedProgressCurrent( 0.0f )
 	, m_SmoothedProgressTarget( 0.0f )
 	, m_WorkerList( 0, true )
+	, m_ResourcePools( 0, true )
 	, m_EnvironmentString( nullptr )
 	, m_EnvironmentStringSize( 0 )
 	, m_ImportedEnvironmentVars( 0, true )
@@ -356,12 +358,31 @@ bool FBuild::Build( Node * nodeToBuild )
 
 	s_StopBuild = false; // allow multiple runs in same process
 
+	// nodes can be built without a parsed BFF (i.e. in tests), but we
+	// still need a graph to track build state
+	if ( m_DependencyGraph == nullptr )
+	{
+		m_DependencyGraph = FNEW( NodeGraph );
+	}
+
+	if ( m_Options.m_TraceFile.IsEmpty() == false )
+	{
+		BuildTrace::Start();
+	}
+
+	// pool stats are per-build
+	for ( ResourcePool & pool : m_ResourcePools )
+	{
+		pool.ResetStats();
+	}
+
 	// create worker threads
 	m_JobQueue = FNEW( JobQueue( m_Options.m_NumWorkerThreads ) );
 
 	m_Timer.Start();
+	m_BuildStats.m_BuildStartTime = (uint64_t)Timer::GetNow();
 	m_LastProgressOutputTime = 0.0f;
-	m_LastProgressCalcTime = 0.0f;
+	m_DependencyGraph->ResetBuildProgress();
 	m_SmoothedProgressCurrent = 0.0f;
 	m_SmoothedProgressTarget = 0.0f;
 	FLog::StartBuild();
@@ -434,7 +455,7 @@ bool FBuild::Build( Node * nodeToBuild )
 		m_JobQueue->MainThreadWait( 500 );
 
 		// update progress
-		UpdateBuildStatus( nodeToBuild );
+		UpdateBuildStatus();
 	}
 
     // wrap up/free any jobs that come from the last build pass
@@ -443,6 +464,18 @@ bool FBuild::Build( Node * nodeToBuild )
 	FDELETE m_JobQueue;
 	m_JobQueue = nullptr;
 
+	// all threads have finished recording
+	if ( BuildTrace::IsEnabled() )
+	{
+		BuildTrace::Stop( m_Options.m_TraceFile );
+	}
+
+	// worker threads have exited, returning their cached blocks
+	if ( FLog::ShowInfo() )
+	{
+		LogSmallBlockStats();
+	}
+
 	FLog::StopBuild();
 
 	// even if the build has failed, we can still save the graph.
@@ -463,6 +496,29 @@ bool FBuild::Build( Node * nodeToBuild )
 	return ( nodeToBuild->GetState() == Node::UP_TO_DATE );
 }
 
+// LogSmallBlockStats
+//------------------------------------------------------------------------------
+/*static*/ void FBuild::LogSmallBlockStats()
+{
+	SmallBlockAllocator::Stats stats;
+	SmallBlockAllocator::GetStats( stats );
+
+	uint64_t numBlocksOut = 0;
+	uint64_t numRefills = 0;
+	uint64_t numFlushes = 0;
+	for ( const SmallBlockAllocator::SizeClassStats & sizeClass : stats.m_SizeClasses )
+	{
+		numBlocksOut += sizeClass.m_NumBlocksOut;
+		numRefills += sizeClass.m_NumRefills;
+		numFlushes += sizeClass.m_NumFlushes;
+	}
+	FLOG_INFO( "Small block allocator: %u KiB committed, %u blocks in use, %u refills, %u flushes",
+			   (uint32_t)( stats.m_CommittedBytes / 1024 ),
+			   (uint32_t)numBlocksOut,
+			   (uint32_t)numRefills,
+			   (uint32_t)numFlushes );
+}
+
 // SetEnvironmentString
 //------------------------------------------------------------------------------
 void FBuild::SetEnvironmentString( const char * envString, uint32_t size, const AString & libEnvVar )
@@ -545,7 +601,7 @@ void FBuild::GetLibEnvVar( AString & value ) const
 
 // UpdateBuildStatus
 //------------------------------------------------------------------------------
-void FBuild::UpdateBuildStatus( const Node * node )
+void FBuild::UpdateBuildStatus()
 {
 	PROFILE_FUNCTION
 
@@ -555,7 +611,6 @@ void FBuild::UpdateBuildStatus( const Node * node )
 	}
 
 	const float OUTPUT_FREQUENCY( 1.0f );
-	const float CALC_FREQUENCY( 5.0f );
 
 	float timeNow = m_Timer.GetElapsed();
 
@@ -565,17 +620,12 @@ void FBuild::UpdateBuildStatus( const Node * node )
 		return;
 	}
 
-	// recalculate progress estimate?
-	if ( ( timeNow - m_LastProgressCalcTime ) >= CALC_FREQUENCY )
+	// progress totals are maintained by the NodeGraph as the build proceeds
+	FBuildStats & bs = m_BuildStats;
+	bs.m_NodeTimeProgressms = m_DependencyGraph->GetProgressBuiltTime();
+	bs.m_NodeTimeTotalms = m_DependencyGraph->GetProgressTotalTime();
+	if ( bs.m_NodeTimeTotalms > 0 )
 	{
-        PROFILE_SECTION( "CalcPogress" )
-
-		FBuildStats & bs = m_BuildStats;
-		bs.m_NodeTimeProgressms = 0;
-		bs.m_NodeTimeTotalms = 0;
-		m_DependencyGraph->UpdateBuildStatus( node, bs.m_NodeTimeProgressms, bs.m_NodeTimeTotalms );
-		m_LastProgressCalcTime = m_Timer.GetElapsed();
-
 		// calculate percentage
 		float doneRatio = (float)( (double)bs.m_NodeTimeProgressms / (double)bs.m_NodeTimeTotalms );
 
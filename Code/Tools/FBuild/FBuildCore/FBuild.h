@@ -9,6 +9,7 @@
 #include "Tools/FBuild/FBuildCore/FBuildOptions.h"
 
 #include "Helpers/FBuildStats.h"
+#include "WorkerPool/ResourcePool.h"
 #include "WorkerPool/WorkerBrokerage.h"
 
 #include "Core/Containers/Array.h"
@@ -66,6 +67,10 @@ public:
 	void SetWorkerList( const Array< AString > & workers )		{ m_WorkerList = workers; }
 	const Array< AString > & GetWorkerList() const { return m_WorkerList; }
 
+	void SetResourcePools( const Array< ResourcePool > & pools ) { m_ResourcePools = pools; }
+	const Array< ResourcePool > & GetResourcePools() const		{ return m_ResourcePools; }
+	inline ResourcePool & GetResourcePool( uint32_t poolIndex )	{ return m_ResourcePools[ poolIndex ]; }
+
 	void SetEnvironmentString( const char * envString, uint32_t size, const AString & libEnvVar );
 	inline const char * GetEnvironmentString() const			{ return m_EnvironmentString; }
 	inline uint32_t		GetEnvironmentStringSize() const		{ return m_EnvironmentStringSize; }
@@ -98,6 +103,8 @@ public:
 	// stats - write access
 	FBuildStats & GetStatsMutable()			{ return m_BuildStats; }
 
+	inline const NodeGraph & GetDependencyGraph() const { return *m_DependencyGraph; }
+
 	// attempt to cleanly stop the build
 	static inline void AbortBuild() { s_StopBuild = true; }
 	static		  void OnBuildError();
@@ -106,7 +113,8 @@ public:
 	inline ICache * GetCache() const { return m_Cache; }
 
 private:
-	void UpdateBuildStatus( const Node * node );
+	void UpdateBuildStatus();
+	static void LogSmallBlockStats();
 
 	static bool s_StopBuild;
 
@@ -123,7 +131,6 @@ private:
 
 	Timer m_Timer;
 	float m_LastProgressOutputTime;
-	float m_LastProgressCalcTime;
 	float m_SmoothedProgressCurrent;
 	float m_SmoothedProgressTarget;
 
@@ -134,6 +141,7 @@ private:
 	WorkerBrokerage m_WorkerBrokerage;
 
 	Array< AString > m_WorkerList;
+	Array< ResourcePool > m_ResourcePools;
 
 	AString m_OldWorkingDir;
 
@@ -24,6 +24,7 @@ FBuildOptions::FBuildOptions()
 : m_ForceCleanBuild( false )
 , m_UseCacheRead( false )
 , m_UseCacheWrite( false )
+, m_UseContentHashing( false )
 , m_ShowInfo( false )
 , m_ShowCommandLines( false )
 , m_ShowErrors( true )
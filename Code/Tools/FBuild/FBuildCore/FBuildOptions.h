@@ -22,6 +22,7 @@ public:
 	bool m_ForceCleanBuild;
 	bool m_UseCacheRead;
 	bool m_UseCacheWrite;
+	bool m_UseContentHashing; // skip dependents of outputs rebuilt with unchanged contents
 	bool m_ShowInfo;
 	bool m_ShowCommandLines;
 	bool m_ShowErrors;
@@ -37,6 +38,7 @@ public:
 	bool m_StopOnFirstError;
 	uint32_t m_NumWorkerThreads;
 	AString m_ConfigFile;
+	AString m_TraceFile; // write a build timeline to this file (if not empty)
 
     inline uint32_t GetWorkingDirHash() const					{ return m_WorkingDirHash; }
     inline const AString & GetMainProcessMutexName() const		{ return m_ProcessMutexName; }
@@ -0,0 +1,246 @@
+// BuildTimeHistory
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Tools/FBuild/FBuildCore/PrecompiledHeader.h"
+
+#include "BuildTimeHistory.h"
+#include "Node.h"
+
+// Core
+#include "Core/FileIO/IOStream.h"
+#include "Core/Math/CRC32.h"
+#include "Core/Math/Conversions.h"
+
+#include <math.h>
+#include <string.h>
+
+// Defines
+//------------------------------------------------------------------------------
+// weight given to each new sample (higher values adapt faster, but are noisier)
+#define BUILD_TIME_HISTORY_ALPHA ( 0.25f )
+
+// BuildTimeHistory CONSTRUCTOR
+//------------------------------------------------------------------------------
+BuildTimeHistory::BuildTimeHistory()
+{
+	memset( m_Stats, 0, sizeof( m_Stats ) );
+}
+
+// Record
+//------------------------------------------------------------------------------
+void BuildTimeHistory::Record( Kind kind, uint32_t timeMS )
+{
+	Stats & stats = m_Stats[ kind ];
+	const float sample = (float)timeMS;
+
+	if ( stats.m_NumSamples == 0 )
+	{
+		// first sample defines the average
+		stats.m_Mean = sample;
+		stats.m_Variance = 0.0f;
+	}
+	else
+	{
+		// incremental exponentially weighted mean and variance
+		const float diff = ( sample - stats.m_Mean );
+		const float incr = ( BUILD_TIME_HISTORY_ALPHA * diff );
+		stats.m_Mean += incr;
+		stats.m_Variance = ( 1.0f - BUILD_TIME_HISTORY_ALPHA ) * ( stats.m_Variance + ( diff * incr ) );
+	}
+
+	if ( stats.m_NumSamples < 0xFFFFFFFF )
+	{
+		++stats.m_NumSamples;
+	}
+}
+
+// GetTotalSamples
+//------------------------------------------------------------------------------
+uint32_t BuildTimeHistory::GetTotalSamples() const
+{
+	uint64_t total = 0;
+	for ( const Stats & stats : m_Stats )
+	{
+		total += stats.m_NumSamples;
+	}
+	return (uint32_t)Math::Min< uint64_t >( total, 0xFFFFFFFF );
+}
+
+// GetStdDev
+//------------------------------------------------------------------------------
+uint32_t BuildTimeHistory::GetStdDev( Kind kind ) const
+{
+	return (uint32_t)( sqrtf( m_Stats[ kind ].m_Variance ) + 0.5f );
+}
+
+// GetEstimate
+//------------------------------------------------------------------------------
+uint32_t BuildTimeHistory::GetEstimate() const
+{
+	// Prefer the time to actually build the node. Cache hits are only
+	// used if that's all we've ever seen.
+	const Kind kinds[] = { LOCAL, REMOTE, CACHE };
+	for ( const Kind kind : kinds )
+	{
+		if ( m_Stats[ kind ].m_NumSamples > 0 )
+		{
+			// pad by the deviation, so erratic nodes are started sooner
+			return Math::Max< uint32_t >( GetMean( kind ) + GetStdDev( kind ), 1 );
+		}
+	}
+	return 0;
+}
+
+// Load
+//------------------------------------------------------------------------------
+bool BuildTimeHistory::Load( IOStream & stream )
+{
+	for ( Stats & stats : m_Stats )
+	{
+		if ( ( stream.Read( stats.m_Mean ) == false ) ||
+			 ( stream.Read( stats.m_Variance ) == false ) ||
+			 ( stream.Read( stats.m_NumSamples ) == false ) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Save
+//------------------------------------------------------------------------------
+void BuildTimeHistory::Save( IOStream & stream ) const
+{
+	for ( const Stats & stats : m_Stats )
+	{
+		stream.Write( stats.m_Mean );
+		stream.Write( stats.m_Variance );
+		stream.Write( stats.m_NumSamples );
+	}
+}
+
+// BuildTimeEstimator CONSTRUCTOR
+//------------------------------------------------------------------------------
+BuildTimeEstimator::BuildTimeEstimator()
+	: m_DirectoryAverages( 0, true )
+{
+	static_assert( (uint32_t)Node::NUM_NODE_TYPES <= (uint32_t)MAX_NODE_TYPES, "Too many node types for BuildTimeEstimator" );
+	memset( m_TypeAverages, 0, sizeof( m_TypeAverages ) );
+}
+
+// AddSample
+//------------------------------------------------------------------------------
+void BuildTimeEstimator::AddSample( const Node * node, uint32_t timeMS )
+{
+	Average & typeAverage = m_TypeAverages[ node->GetType() ];
+	typeAverage.m_TotalMS += timeMS;
+	typeAverage.m_NumSamples++;
+
+	const uint64_t key = GetDirectoryKey( node );
+	if ( key == 0 )
+	{
+		return; // not a file in a directory
+	}
+
+	Average * dirAverage = const_cast< Average * >( FindDirectoryAverage( key ) );
+	if ( dirAverage )
+	{
+		dirAverage->m_TotalMS += timeMS;
+		dirAverage->m_NumSamples++;
+		return;
+	}
+
+	// first node seen in this directory
+	Average newAverage;
+	newAverage.m_Key = key;
+	newAverage.m_TotalMS = timeMS;
+	newAverage.m_NumSamples = 1;
+	m_DirectoryAverages.Append( newAverage );
+
+	// move into sorted position
+	Average * it = ( m_DirectoryAverages.End() - 1 );
+	while ( ( it != m_DirectoryAverages.Begin() ) && ( newAverage < it[ -1 ] ) )
+	{
+		it[ 0 ] = it[ -1 ];
+		--it;
+	}
+	*it = newAverage;
+}
+
+// Estimate
+//------------------------------------------------------------------------------
+uint32_t BuildTimeEstimator::Estimate( const Node * node ) const
+{
+	// nodes of the same type in the same directory are the best indicator
+	const uint64_t key = GetDirectoryKey( node );
+	if ( key != 0 )
+	{
+		const Average * dirAverage = FindDirectoryAverage( key );
+		if ( dirAverage )
+		{
+			return (uint32_t)( dirAverage->m_TotalMS / dirAverage->m_NumSamples );
+		}
+	}
+
+	// fall back to all nodes of this type
+	const Average & typeAverage = m_TypeAverages[ node->GetType() ];
+	if ( typeAverage.m_NumSamples > 0 )
+	{
+		return (uint32_t)( typeAverage.m_TotalMS / typeAverage.m_NumSamples );
+	}
+
+	return 0;
+}
+
+// GetDirectoryKey
+//------------------------------------------------------------------------------
+/*static*/ uint64_t BuildTimeEstimator::GetDirectoryKey( const Node * node )
+{
+	if ( node->IsAFile() == false )
+	{
+		return 0;
+	}
+
+	const AString & name = node->GetName();
+	const char * lastSlash = name.FindLast( NATIVE_SLASH );
+	if ( lastSlash == nullptr )
+	{
+		return 0;
+	}
+
+	// combine type and directory, so (for example) objects and libraries
+	// in the same directory are averaged separately
+	const uint32_t dirCRC = CRC32::CalcLower( name.Get(), (size_t)( lastSlash - name.Get() ) );
+	return ( ( (uint64_t)( node->GetType() + 1 ) << 32 ) | dirCRC );
+}
+
+// FindDirectoryAverage
+//------------------------------------------------------------------------------
+const BuildTimeEstimator::Average * BuildTimeEstimator::FindDirectoryAverage( uint64_t key ) const
+{
+	// binary search
+	size_t low = 0;
+	size_t high = m_DirectoryAverages.GetSize();
+	while ( low < high )
+	{
+		const size_t mid = ( low + high ) / 2;
+		const Average & average = m_DirectoryAverages[ mid ];
+		if ( average.m_Key == key )
+		{
+			return &average;
+		}
+		if ( average.m_Key < key )
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+	return nullptr;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,92 @@
+// BuildTimeHistory - rolling statistics of the time taken to build nodes
+//------------------------------------------------------------------------------
+#pragma once
+#ifndef FBUILD_GRAPH_BUILDTIMEHISTORY_H
+#define FBUILD_GRAPH_BUILDTIMEHISTORY_H
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/Containers/Array.h"
+#include "Core/Env/Types.h"
+
+// Forward Declarations
+//------------------------------------------------------------------------------
+class IOStream;
+class Node;
+
+// BuildTimeHistory
+//------------------------------------------------------------------------------
+// Exponentially weighted moving average and variance of a node's build time,
+// tracked separately for each way the node can be built.
+class BuildTimeHistory
+{
+public:
+	enum Kind
+	{
+		LOCAL	= 0, // built on this machine
+		REMOTE	= 1, // built by a remote worker
+		CACHE	= 2, // retrieved from the cache
+		NUM_KINDS
+	};
+
+	explicit BuildTimeHistory();
+
+	void Record( Kind kind, uint32_t timeMS );
+
+	inline uint32_t GetNumSamples( Kind kind ) const { return m_Stats[ kind ].m_NumSamples; }
+	uint32_t GetTotalSamples() const;
+	inline uint32_t GetMean( Kind kind ) const { return (uint32_t)( m_Stats[ kind ].m_Mean + 0.5f ); }
+	uint32_t GetStdDev( Kind kind ) const;
+
+	// expected time for a build, or 0 if there is no history
+	uint32_t GetEstimate() const;
+
+	bool Load( IOStream & stream );
+	void Save( IOStream & stream ) const;
+
+private:
+	struct Stats
+	{
+		float		m_Mean;
+		float		m_Variance;
+		uint32_t	m_NumSamples;
+	};
+	Stats m_Stats[ NUM_KINDS ];
+};
+
+// BuildTimeEstimator
+//------------------------------------------------------------------------------
+// Average build times of nodes per type, and per type within each output
+// directory. Used to estimate the cost of nodes which have no history of
+// their own (for example, on a clean build).
+class BuildTimeEstimator
+{
+public:
+	explicit BuildTimeEstimator();
+
+	void AddSample( const Node * node, uint32_t timeMS );
+
+	// average time for similar nodes, or 0 if no similar nodes have been built
+	uint32_t Estimate( const Node * node ) const;
+
+private:
+	struct Average
+	{
+		inline bool operator < ( const Average & other ) const { return ( m_Key < other.m_Key ); }
+
+		uint64_t	m_Key;
+		uint64_t	m_TotalMS;
+		uint32_t	m_NumSamples;
+	};
+
+	enum { MAX_NODE_TYPES = 32 };
+
+	static uint64_t GetDirectoryKey( const Node * node );
+	const Average * FindDirectoryAverage( uint64_t key ) const;
+
+	Average				m_TypeAverages[ MAX_NODE_TYPES ];
+	Array< Average >	m_DirectoryAverages; // sorted by key
+};
+
+//------------------------------------------------------------------------------
+#endif // FBUILD_GRAPH_BUILDTIMEHISTORY_H
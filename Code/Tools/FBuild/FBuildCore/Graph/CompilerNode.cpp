@@ -112,7 +112,7 @@ bool CompilerNode::DetermineNeedToBuild( bool forceClean ) const
 	// check additional files
 	for ( const auto & dep : m_StaticDependencies )
 	{
-		if ( dep.GetNode()->GetStamp() > m_Stamp )
+		if ( dep.GetNode()->GetChangeStamp() > m_Stamp )
 		{
 			return true;
 		}
@@ -22,9 +22,11 @@
 CopyDirNode::CopyDirNode( const AString & name,
 						  Dependencies & staticDeps,
 						  const AString & destPath,
-						  const Dependencies & preBuildDeps )
+						  const Dependencies & preBuildDeps,
+						  bool useHardLinks )
 : Node( name, Node::COPY_DIR_NODE, Node::FLAG_NONE )
 , m_DestPath( destPath )
+, m_UseHardLinks( useHardLinks )
 {
 	m_StaticDependencies.Append( staticDeps );
 	m_PreBuildDependencies = preBuildDeps;
@@ -102,11 +104,13 @@ CopyDirNode::~CopyDirNode()
 				CopyFileNode * copyFileNode = nodeGraph.CreateCopyFileNode( dstFile );
 				copyFileNode->m_Source = srcFileNode->GetName();
 				copyFileNode->m_PreBuildDependencyNames = preBuildDependencyNames; // inherit PreBuildDependencies
+				copyFileNode->m_UseHardLinks = m_UseHardLinks;
 				BFFIterator iter;
 				if ( !copyFileNode->Initialize( nodeGraph, iter, nullptr ) )
 				{
 					return false; // Initialize will have emitted an error
 				}
+				nodeGraph.MigrateNode( copyFileNode );
 				n = copyFileNode;
 			}
 			else if ( n->GetType() != Node::COPY_FILE_NODE )
@@ -142,14 +146,25 @@ CopyDirNode::~CopyDirNode()
 {
 	// consider ourselves to be as recent as the newest file
 	uint64_t timeStamp = 0;
+	uint64_t changeStamp = 0;
+	bool contentUnchanged = false;
 	const Dependency * const end = m_DynamicDependencies.End();
 	for ( const Dependency * it = m_DynamicDependencies.Begin(); it != end; ++it )
 	{
 		CopyFileNode * cn = it->GetNode()->CastTo< CopyFileNode >();
 		timeStamp = Math::Max< uint64_t >( timeStamp, cn->GetStamp() );
+		changeStamp = Math::Max< uint64_t >( changeStamp, cn->GetChangeStamp() );
+		contentUnchanged |= cn->GetStatFlag( Node::STATS_CONTENT_UNCHANGED );
 	}
 	m_Stamp = timeStamp;
 
+	// files rebuilt with unchanged contents don't make our contents newer
+	m_ChangeStamp = ( changeStamp < timeStamp ) ? changeStamp : 0;
+	if ( contentUnchanged )
+	{
+		SetStatFlag( Node::STATS_CONTENT_UNCHANGED );
+	}
+
 	return NODE_RESULT_OK;
 }
 
@@ -161,8 +176,9 @@ CopyDirNode::~CopyDirNode()
 	NODE_LOAD_DEPS( 4,			staticDeps );
 	NODE_LOAD( AStackString<>,  destPath );
 	NODE_LOAD_DEPS( 0,			preBuildDeps );
+	NODE_LOAD( bool,			useHardLinks );
 
-	CopyDirNode * n = nodeGraph.CreateCopyDirNode( name, staticDeps, destPath, preBuildDeps );
+	CopyDirNode * n = nodeGraph.CreateCopyDirNode( name, staticDeps, destPath, preBuildDeps, useHardLinks );
 	ASSERT( n );
 	return n;
 }
@@ -175,6 +191,7 @@ CopyDirNode::~CopyDirNode()
 	NODE_SAVE_DEPS( m_StaticDependencies );
 	NODE_SAVE( m_DestPath );
 	NODE_SAVE_DEPS( m_PreBuildDependencies );
+	NODE_SAVE( m_UseHardLinks );
 }
 
 //------------------------------------------------------------------------------
@@ -19,7 +19,8 @@ public:
 	explicit CopyDirNode( const AString & name,
 						  Dependencies & staticDeps,
 						  const AString & destPath,
-						  const Dependencies & preBuildDeps );
+						  const Dependencies & preBuildDeps,
+						  bool useHardLinks );
 	virtual ~CopyDirNode();
 
 	static inline Node::Type GetTypeS() { return Node::COPY_DIR_NODE; }
@@ -33,6 +34,7 @@ private:
 	virtual BuildResult DoBuild( Job * job ) override;
 
 	AString m_DestPath;
+	bool	m_UseHardLinks;
 };
 
 //------------------------------------------------------------------------------
@@ -24,12 +24,14 @@ REFLECT_BEGIN( CopyFileNode, Node, MetaNone() )
 	REFLECT(		m_Dest,						"Dest",						MetaPath() )
 	REFLECT(		m_SourceBasePath,			"SourceBasePath",			MetaOptional() + MetaPath() )
 	REFLECT_ARRAY(	m_PreBuildDependencyNames,	"PreBuildDependencies",		MetaOptional() + MetaFile() )
+	REFLECT(		m_UseHardLinks,				"UseHardLinks",				MetaOptional() )
 REFLECT_END( CopyFileNode )
 
 // CONSTRUCTOR
 //------------------------------------------------------------------------------
 CopyFileNode::CopyFileNode()
 : FileNode( AString::GetEmpty(), Node::FLAG_NONE )
+, m_UseHardLinks( false )
 {
 	m_Type = Node::COPY_FILE_NODE;
 }
@@ -72,6 +74,15 @@ CopyFileNode::~CopyFileNode()
 {
 	EmitCopyMessage();
 
+	// link the file (if possible)
+	if ( m_UseHardLinks && FileIO::FileHardLink( GetSourceNode()->GetName().Get(), m_Name.Get() ) )
+	{
+		// the link shares the source's data and attributes (so must not be modified)
+		m_Stamp = FileIO::GetFileLastWriteTime( m_Name );
+		ASSERT( m_Stamp );
+		return NODE_RESULT_OK;
+	}
+
 	// copy the file
 	if ( FileIO::FileCopy( GetSourceNode()->GetName().Get(), m_Name.Get() ) == false )
 	{
@@ -39,6 +39,7 @@ private:
 	AString				m_Dest;
 	AString				m_SourceBasePath;
 	Array< AString >	m_PreBuildDependencyNames;
+	bool				m_UseHardLinks;
 };
 
 //------------------------------------------------------------------------------
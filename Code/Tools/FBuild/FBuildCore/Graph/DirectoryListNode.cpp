@@ -12,6 +12,7 @@
 #include "Tools/FBuild/FBuildCore/Graph/NodeGraph.h"
 
 // Core
+#include "Core/FileIO/DirectoryWalker.h"
 #include "Core/FileIO/FileIO.h"
 #include "Core/FileIO/FileStream.h"
 #include "Core/FileIO/PathUtils.h"
@@ -121,55 +122,20 @@ DirectoryListNode::~DirectoryListNode()
 	// NOTE: The DirectoryListNode makes no assumptions about whether no files
 	// is an error or not.  That's up to the dependent nodes to decide.
 
-	Array< FileIO::FileInfo > files( 4096, true );
-	FileIO::GetFilesEx( m_Path, &m_Patterns, m_Recursive, &files );
-
-	m_Files.SetCapacity( files.GetSize() );
-
-	// filter exclusions
-	const FileIO::FileInfo * const end = files.End();
-	for ( const FileIO::FileInfo * it = files.Begin(); it != end; it++ )
-	{
-		bool excluded = false;
-        
-		// filter excluded paths
-		const AString * const eEnd = m_ExcludePaths.End();
-		for ( const AString * eIt=m_ExcludePaths.Begin(); eIt != eEnd; ++eIt )
-		{
-			if ( PathUtils::PathBeginsWith( it->m_Name, *eIt ) )
-			{
-				excluded = true;
-				break;
-			}
-		}
-
-        // filter excluded files
-		if ( !excluded )
-		{
-	        const AString * fit = m_FilesToExclude.Begin();
-	        const AString * const fend = m_FilesToExclude.End();
-	        for ( ; fit != fend; ++fit )
-	        {
-				if ( PathUtils::PathEndsWithFile( it->m_Name, *fit ) )
-	            {
-	                excluded = true;
-	                break;
-	            }
-	        }
-		}
-
-		if ( !excluded )
-		{
-			m_Files.Append( *it );
-		}
-	}
+	// excluded paths prune whole sub-trees while listing, and excluded files
+	// are rejected by name before their attributes are retrieved
+	DirectoryWalker walker( &m_Patterns, m_ExcludePaths, m_FilesToExclude );
+	m_Files.Clear();
+	walker.GetFiles( m_Path, m_Recursive, m_Files );
 
 	if ( FLog::ShowInfo() )
 	{
 		const size_t numFiles = m_Files.GetSize();
-		FLOG_INFO( "Dir: '%s' (found %u files)\n", 
+		FLOG_INFO( "Dir: '%s' (found %u files in %u dirs, %u dirs excluded)\n", 
 							m_Name.Get(), 
-							(uint32_t)numFiles);
+							(uint32_t)numFiles,
+							walker.GetNumDirectoriesListed(),
+							walker.GetNumDirectoriesPruned() );
 		for ( size_t i=0; i<numFiles; ++i )
 		{
 			FLOG_INFO( " - %s\n", m_Files[ i ].m_Name.Get() );
@@ -7,6 +7,7 @@
 
 #include "ExecNode.h"
 
+#include "Tools/FBuild/FBuildCore/Cache/OutputCache.h"
 #include "Tools/FBuild/FBuildCore/FBuild.h"
 #include "Tools/FBuild/FBuildCore/FLog.h"
 #include "Tools/FBuild/FBuildCore/Graph/NodeGraph.h"
@@ -26,7 +27,8 @@ ExecNode::ExecNode( const AString & dstFileName,
 						const AString & workingDir,
 						int32_t expectedReturnCode,
 						const Dependencies & preBuildDependencies,
-						bool useStdOutAsOutput )
+						bool useStdOutAsOutput,
+						bool cacheable )
 : FileNode( dstFileName, Node::FLAG_NONE )
 , m_InputFiles( inputFiles )
 , m_Executable( executable )
@@ -34,6 +36,7 @@ ExecNode::ExecNode( const AString & dstFileName,
 , m_WorkingDir( workingDir )
 , m_ExpectedReturnCode( expectedReturnCode )
 , m_UseStdOutAsOutput( useStdOutAsOutput )
+, m_Cacheable( cacheable )
 {
 	ASSERT( executable );
 	m_StaticDependencies.SetCapacity( m_InputFiles.GetSize() + 1 );
@@ -54,6 +57,23 @@ ExecNode::~ExecNode()
 //------------------------------------------------------------------------------
 /*virtual*/ Node::BuildResult ExecNode::DoBuild( Job * job )
 {
+	// try to retrieve outputs from the cache
+	AStackString<> cacheName;
+	const bool useCache = m_Cacheable &&
+						  ( OutputCache::IsReadEnabled() || OutputCache::IsWriteEnabled() ) &&
+						  GetCacheName( cacheName );
+	Array< AString > outputFiles( 1, false );
+	outputFiles.Append( m_Name );
+	if ( useCache && OutputCache::IsReadEnabled() )
+	{
+		if ( OutputCache::Retrieve( this, cacheName, outputFiles ) )
+		{
+			m_Stamp = FileIO::GetFileLastWriteTime( m_Name );
+			FLOG_BUILD( "Run: %s <CACHE>\n", GetName().Get() );
+			return NODE_RESULT_OK_CACHE;
+		}
+	}
+
 	// If the workingDir is empty, use the current dir for the process
 	const char * workingDir = m_WorkingDir.IsEmpty() ? nullptr : m_WorkingDir.Get();
 
@@ -110,6 +130,11 @@ ExecNode::~ExecNode()
 		f.Close();
 	}
 
+	if ( useCache && OutputCache::IsWriteEnabled() )
+	{
+		OutputCache::Store( this, cacheName, outputFiles );
+	}
+
 	// update the file's "last modified" time
 	m_Stamp = FileIO::GetFileLastWriteTime( m_Name );
 	return NODE_RESULT_OK;
@@ -127,6 +152,7 @@ ExecNode::~ExecNode()
 	NODE_LOAD( int32_t,			expectedReturnCode );
 	NODE_LOAD_DEPS( 0,			preBuildDependencies );
 	NODE_LOAD( bool,			useStdOutAsOutput);
+	NODE_LOAD( bool,			cacheable );
 
 	Node * execNode = nodeGraph.FindNode( executable );
 	ASSERT( execNode ); // load/save logic should ensure the src was saved first
@@ -138,7 +164,8 @@ ExecNode::~ExecNode()
 								  workingDir,
 								  expectedReturnCode,
 								  preBuildDependencies,
-								  useStdOutAsOutput );
+								  useStdOutAsOutput,
+								  cacheable );
 	ASSERT( n );
 
 	return n;
@@ -156,6 +183,7 @@ ExecNode::~ExecNode()
 	NODE_SAVE( m_ExpectedReturnCode );
 	NODE_SAVE_DEPS( m_PreBuildDependencies );
 	NODE_SAVE( m_UseStdOutAsOutput );
+	NODE_SAVE( m_Cacheable );
 }
 
 // EmitCompilationMessage
@@ -184,6 +212,42 @@ void ExecNode::EmitCompilationMessage( const AString & args ) const
     FLOG_BUILD_DIRECT( output.Get() );
 }
 
+// GetCacheName
+//------------------------------------------------------------------------------
+bool ExecNode::GetCacheName( AString & cacheName ) const
+{
+	OutputCache::Key key;
+	AStackString<> workingDir;
+	key.AddWorkingDir( m_WorkingDir, workingDir );
+
+	const Dependency * const end = m_InputFiles.End();
+	for ( const Dependency * it = m_InputFiles.Begin(); it != end; ++it )
+	{
+		const AString & inputFile = it->GetNode()->GetName();
+		if ( key.AddInputFile( inputFile ) == false )
+		{
+			FLOG_INFO( "Caching disabled for '%s' - can't read input '%s'\n", GetName().Get(), inputFile.Get() );
+			return false;
+		}
+		key.AddPath( inputFile, workingDir );
+	}
+
+	key.AddString( m_Arguments );
+	key.AddPath( m_Name, workingDir );
+	AStackString<> options;
+	options.Format( "%i %u", m_ExpectedReturnCode, (uint32_t)m_UseStdOutAsOutput );
+	key.AddString( options );
+
+	if ( key.SetTool( m_Executable->GetName() ) == false )
+	{
+		FLOG_INFO( "Caching disabled for '%s' - can't read executable '%s'\n", GetName().Get(), m_Executable->GetName().Get() );
+		return false;
+	}
+
+	key.GetCacheName( cacheName );
+	return true;
+}
+
 // GetFullArgs
 //------------------------------------------------------------------------------
 void ExecNode::GetFullArgs(AString & fullArgs) const
@@ -24,7 +24,8 @@ public:
 						const AString & workingDir,
 						int32_t expectedReturnCode,
 						const Dependencies & preBuildDependencies,
-						bool useStdOutAsOutput );
+						bool useStdOutAsOutput,
+						bool cacheable );
 	virtual ~ExecNode();
 
 	static inline Node::Type GetTypeS() { return Node::EXEC_NODE; }
@@ -39,12 +40,15 @@ private:
 
 	void EmitCompilationMessage( const AString & args ) const;
 
+	bool GetCacheName( AString & cacheName ) const;
+
 	Dependencies m_InputFiles;
 	FileNode * m_Executable;
 	AString		m_Arguments;
 	AString		m_WorkingDir;
 	int32_t		m_ExpectedReturnCode;
 	bool		m_UseStdOutAsOutput;
+	bool		m_Cacheable;
 };
 
 //------------------------------------------------------------------------------
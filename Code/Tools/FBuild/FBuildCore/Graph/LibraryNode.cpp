@@ -9,20 +9,25 @@
 #include "DirectoryListNode.h"
 #include "UnityNode.h"
 
+#include "Tools/FBuild/FBuildCore/Cache/OutputCache.h"
 #include "Tools/FBuild/FBuildCore/FBuild.h"
 #include "Tools/FBuild/FBuildCore/FLog.h"
 #include "Tools/FBuild/FBuildCore/Graph/CompilerNode.h"
 #include "Tools/FBuild/FBuildCore/Graph/NodeGraph.h"
 #include "Tools/FBuild/FBuildCore/Graph/ObjectListNode.h"
 #include "Tools/FBuild/FBuildCore/Graph/ObjectNode.h"
+#include "Tools/FBuild/FBuildCore/Helpers/Archiver.h"
 #include "Tools/FBuild/FBuildCore/Helpers/Args.h"
+#include "Tools/FBuild/FBuildCore/Helpers/BuildTrace.h"
 #include "Tools/FBuild/FBuildCore/Helpers/ResponseFile.h"
 
 // Core
 #include "Core/FileIO/FileIO.h"
 #include "Core/FileIO/FileStream.h"
 #include "Core/FileIO/PathUtils.h"
+#include "Core/Math/xxHash.h"
 #include "Core/Process/Process.h"
+#include "Core/Profile/Profile.h"
 #include "Core/Strings/AStackString.h"
 
 // CONSTRUCTOR
@@ -64,6 +69,8 @@ LibraryNode::LibraryNode( const AString & libraryName,
                   preprocessorArgs,
 				  baseDirectory )
 , m_AdditionalInputs( additionalInputs )
+, m_ArchiveInputsHash( 0 )
+, m_NumArchiveMembersReused( 0 )
 {
 	m_Type = LIBRARY_NODE;
 	m_LastBuildTimeMs = 10000; // TODO:C Reduce this when dynamic deps are saved
@@ -104,6 +111,68 @@ LibraryNode::~LibraryNode()
 //------------------------------------------------------------------------------
 /*virtual*/ Node::BuildResult LibraryNode::DoBuild( Job * UNUSED( job ) )
 {
+	m_NumArchiveMembersReused = 0;
+
+	// try to retrieve library from the cache
+	AStackString<> cacheName;
+	const bool useCache = ( ShouldUseCache() && GetCacheName( cacheName ) );
+	Array< AString > outputFiles( 1, false );
+	outputFiles.Append( m_Name );
+	if ( useCache && OutputCache::IsReadEnabled() )
+	{
+		if ( OutputCache::Retrieve( this, cacheName, outputFiles ) )
+		{
+			m_Stamp = FileIO::GetFileLastWriteTime( m_Name );
+			m_ArchiveInputsHash = 0;
+			FLOG_BUILD( "Lib: %s <CACHE>\n", GetName().Get() );
+			return NODE_RESULT_OK_CACHE;
+		}
+	}
+
+	// use the built-in archiver if possible
+	bool unsupported = true;
+	BuildResult result = NODE_RESULT_FAILED;
+	if ( GetFlag( LIB_FLAG_NATIVE_AR ) )
+	{
+		result = DoBuildWithArchiver( unsupported );
+	}
+	if ( unsupported )
+	{
+		result = DoBuildWithLibrarian();
+	}
+	if ( result != NODE_RESULT_OK )
+	{
+		return result;
+	}
+
+	if ( useCache && OutputCache::IsWriteEnabled() )
+	{
+		OutputCache::Store( this, cacheName, outputFiles );
+	}
+
+	// record time stamp for next time
+	m_Stamp = FileIO::GetFileLastWriteTime( m_Name );
+	ASSERT( m_Stamp );
+
+	return NODE_RESULT_OK;
+}
+
+// Migrate
+//------------------------------------------------------------------------------
+/*virtual*/ void LibraryNode::Migrate( const Node & oldNode )
+{
+	Node::Migrate( oldNode );
+
+	// allows built-in archiver to re-use the previous library
+	m_ArchiveInputsHash = oldNode.CastTo< LibraryNode >()->m_ArchiveInputsHash;
+}
+
+// DoBuildWithLibrarian
+//------------------------------------------------------------------------------
+Node::BuildResult LibraryNode::DoBuildWithLibrarian()
+{
+	m_ArchiveInputsHash = 0;
+
 	// delete library before creation (so ar.exe will not merge old symbols)
 	if ( FileIO::FileExists( GetName().Get() ) )
 	{
@@ -125,6 +194,7 @@ LibraryNode::~LibraryNode()
 	EmitCompilationMessage( fullArgs );
 
 	// spawn the process
+	BuildTrace::Section traceSection( this, BuildTrace::PHASE_LINK );
 	Process p;
 	bool spawnOK = p.Spawn( m_LibrarianPath.Get(),
 							fullArgs.GetFinalArgs().Get(),
@@ -161,10 +231,51 @@ LibraryNode::~LibraryNode()
 		return NODE_RESULT_FAILED;
 	}
 
-	// record time stamp for next time
-	m_Stamp = FileIO::GetFileLastWriteTime( m_Name );
-	ASSERT( m_Stamp );
+	return NODE_RESULT_OK;
+}
+
+// DoBuildWithArchiver
+//------------------------------------------------------------------------------
+Node::BuildResult LibraryNode::DoBuildWithArchiver( bool & unsupported )
+{
+	unsupported = false;
+
+	Array< AString > inputFiles( 1024, true );
+	GetObjectFiles( inputFiles );
+
+	// members of the previous library can only be re-used if it was
+	// created by the archiver from the same list of inputs
+	Array< uint64_t > inputHashes( inputFiles.GetSize(), false );
+	for ( const AString & inputFile : inputFiles )
+	{
+		inputHashes.Append( xxHash::Calc64( inputFile ) );
+	}
+	const uint64_t inputsHash = xxHash::Calc64( inputHashes.Begin(), inputHashes.GetSize() * sizeof( uint64_t ) );
+	const uint64_t previousStamp = ( inputsHash == m_ArchiveInputsHash ) ? m_Stamp : 0;
+	m_ArchiveInputsHash = 0;
+
+	BuildTrace::Section traceSection( this, BuildTrace::PHASE_LINK );
+	Archiver archiver;
+	const Archiver::Result result = archiver.Create( m_Name, inputFiles, previousStamp );
+	if ( result == Archiver::ARCHIVE_UNSUPPORTED )
+	{
+		// librarian will emit the build message
+		FLOG_INFO( "Built-in archiver can't create '%s' - using librarian\n", GetName().Get() );
+		unsupported = true;
+		return NODE_RESULT_FAILED;
+	}
+
+	FLOG_BUILD( "Lib: %s\n", GetName().Get() );
+
+	if ( result != Archiver::ARCHIVE_OK )
+	{
+		FLOG_ERROR( "Failed to build Library '%s'", GetName().Get() );
+		return NODE_RESULT_FAILED;
+	}
 
+	FLOG_INFO( "Archived %u inputs (%u re-used from previous library) '%s'\n", (uint32_t)inputFiles.GetSize(), archiver.GetNumMembersReused(), GetName().Get() );
+	m_ArchiveInputsHash = inputsHash;
+	m_NumArchiveMembersReused = archiver.GetNumMembersReused();
 	return NODE_RESULT_OK;
 }
 
@@ -272,6 +383,64 @@ bool LibraryNode::BuildArgs( Args & fullArgs ) const
 	return flags;
 }
 
+// ShouldUseCache
+//------------------------------------------------------------------------------
+bool LibraryNode::ShouldUseCache() const
+{
+	if ( ( OutputCache::IsReadEnabled() == false ) && ( OutputCache::IsWriteEnabled() == false ) )
+	{
+		return false;
+	}
+	return m_AllowCaching;
+}
+
+// GetCacheName
+//------------------------------------------------------------------------------
+bool LibraryNode::GetCacheName( AString & cacheName ) const
+{
+	PROFILE_FUNCTION
+
+	Array< AString > inputFiles( 1024, true );
+	GetObjectFiles( inputFiles );
+
+	OutputCache::Key key;
+	for ( const AString & inputFile : inputFiles )
+	{
+		if ( key.AddInputFile( inputFile ) == false )
+		{
+			FLOG_INFO( "Caching disabled for '%s' - can't read input '%s'\n", GetName().Get(), inputFile.Get() );
+			return false;
+		}
+	}
+
+	// libraries, .def files etc named in the args
+	AStackString<> unreadableFile;
+	if ( key.AddArgsInputFiles( m_LibrarianArgs, GetFlag( LIB_FLAG_LIB ), unreadableFile ) == false )
+	{
+		FLOG_INFO( "Caching disabled for '%s' - can't read input '%s'\n", GetName().Get(), unreadableFile.Get() );
+		return false;
+	}
+
+	// args and output
+	AStackString<> workingDir( FBuild::Get().GetWorkingDir() );
+	PathUtils::EnsureTrailingSlash( workingDir );
+	key.AddArgs( m_LibrarianArgs, workingDir );
+	key.AddPath( m_Name, workingDir );
+	if ( GetFlag( LIB_FLAG_NATIVE_AR ) )
+	{
+		key.AddString( AStackString<>( "NativeArchiver" ) ); // output differs from librarian's
+	}
+
+	if ( key.SetTool( m_LibrarianPath ) == false )
+	{
+		FLOG_INFO( "Caching disabled for '%s' - can't read librarian '%s'\n", GetName().Get(), m_LibrarianPath.Get() );
+		return false;
+	}
+
+	key.GetCacheName( cacheName );
+	return true;
+}
+
 // EmitCompilationMessage
 //------------------------------------------------------------------------------
 void LibraryNode::EmitCompilationMessage( const Args & fullArgs ) const
@@ -319,6 +488,7 @@ void LibraryNode::EmitCompilationMessage( const Args & fullArgs ) const
 	NODE_LOAD( AStackString<>,	librarianArgs );
 	NODE_LOAD( uint32_t,		flags );
     NODE_LOAD_DEPS( 0,			additionalInputs );
+	NODE_LOAD( uint64_t,		archiveInputsHash );
 
 	LibraryNode * n = nodeGraph.CreateLibraryNode( name, 
 								 staticDeps, 
@@ -344,6 +514,7 @@ void LibraryNode::EmitCompilationMessage( const Args & fullArgs ) const
     n->m_CompilerOutputPrefix = compilerOutputPrefix;
     n->m_ExtraPDBPath = extraPDBPath;
     n->m_ExtraASMPath = extraASMPath;
+	n->m_ArchiveInputsHash = archiveInputsHash;
 
 	// TODO:B Need to save the dynamic deps, for better progress estimates
 	// but we can't right now because we rely on the nodes we depend on 
@@ -366,6 +537,7 @@ void LibraryNode::EmitCompilationMessage( const Args & fullArgs ) const
 	NODE_SAVE( m_LibrarianArgs );
 	NODE_SAVE( m_Flags );
 	NODE_SAVE_DEPS( m_AdditionalInputs );
+	NODE_SAVE( m_ArchiveInputsHash );
 }
 
 // CanUseResponseFile
@@ -56,13 +56,21 @@ public:
 		LIB_FLAG_AR		= 0x02,	// gcc/clang style ar.exe
 		LIB_FLAG_ORBIS_AR=0x04, // Orbis ar.exe
 		LIB_FLAG_GREENHILLS_AX=0x08, // Greenhills (WiiU) ax.exe
+		LIB_FLAG_NATIVE_AR = 0x10, // use built-in archiver (for LIB_FLAG_AR)
 	};
 	static uint32_t DetermineFlags( const AString & librarianName );
+
+	// members the built-in archiver re-used from the previous library (during the last build)
+	inline uint32_t GetNumArchiveMembersReused() const { return m_NumArchiveMembersReused; }
 private:
 	friend class FunctionLibrary;
 
     virtual bool GatherDynamicDependencies( NodeGraph & nodeGraph, bool forceClean ) override;
 	virtual BuildResult DoBuild( Job * job ) override;
+	virtual void Migrate( const Node & oldNode ) override;
+
+	BuildResult DoBuildWithLibrarian();
+	BuildResult DoBuildWithArchiver( bool & unsupported );
 
 	// internal helpers
 	bool BuildArgs( Args & fullArgs ) const;
@@ -72,10 +80,16 @@ private:
 
 	bool CanUseResponseFile() const;
 
+	// caching
+	bool ShouldUseCache() const;
+	bool GetCacheName( AString & cacheName ) const;
+
 	AString m_LibrarianPath;
 	AString m_LibrarianArgs;
 	uint32_t m_Flags;
 	Dependencies m_AdditionalInputs;
+	uint64_t m_ArchiveInputsHash; // inputs of library written by built-in archiver (0 if not)
+	uint32_t m_NumArchiveMembersReused; // not serialized
 };
 
 //------------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 
 #include "LinkerNode.h"
 
+#include "Tools/FBuild/FBuildCore/Cache/OutputCache.h"
 #include "Tools/FBuild/FBuildCore/FBuild.h"
 #include "Tools/FBuild/FBuildCore/FLog.h"
 #include "Tools/FBuild/FBuildCore/Graph/CopyFileNode.h"
@@ -17,10 +18,12 @@
 #include "Tools/FBuild/FBuildCore/Graph/ObjectNode.h"
 #include "Tools/FBuild/FBuildCore/Graph/NodeGraph.h"
 #include "Tools/FBuild/FBuildCore/Helpers/Args.h"
+#include "Tools/FBuild/FBuildCore/Helpers/BuildTrace.h"
 #include "Tools/FBuild/FBuildCore/Helpers/ResponseFile.h"
 
 #include "Core/FileIO/FileIO.h"
 #include "Core/FileIO/FileStream.h"
+#include "Core/FileIO/PathUtils.h"
 #include "Core/Process/Process.h"
 #include "Core/Profile/Profile.h"
 #include "Core/Strings/AStackString.h"
@@ -98,6 +101,32 @@ LinkerNode::~LinkerNode()
 		}
 	}
 
+	// try to retrieve outputs from the cache
+	AStackString<> cacheName;
+	const bool useCache = ( ShouldUseCache() && GetCacheName( cacheName ) );
+	if ( useCache && OutputCache::IsReadEnabled() )
+	{
+		Array< AString > outputFiles( 4, false );
+		GetCacheOutputFiles( outputFiles );
+		if ( OutputCache::Retrieve( this, cacheName, outputFiles ) )
+		{
+			#if defined( __LINUX__ ) || defined( __APPLE__ )
+				// the cache only holds file contents, so restore the exe bit
+				if ( FileIO::SetExecutable( m_Name.Get() ) == false )
+				{
+					FLOG_ERROR( "Failed to set executable permission on '%s' after cache hit", GetName().Get() );
+					return NODE_RESULT_FAILED;
+				}
+			#endif
+
+			// the file time we set and local file system might have different 
+			// granularity for timekeeping, so we need to update with the actual time written
+			m_Stamp = FileIO::GetFileLastWriteTime( m_Name );
+			FLOG_BUILD( "%s: %s <CACHE>\n", GetDLLOrExe(), GetName().Get() );
+			return NODE_RESULT_OK_CACHE;
+		}
+	}
+
 	// Format compiler args string
 	Args fullArgs;
 	if ( !BuildArgs( fullArgs ) )
@@ -112,6 +141,8 @@ LinkerNode::~LinkerNode()
 
 	EmitCompilationMessage( fullArgs );
 
+	BuildTrace::Section traceSection( this, BuildTrace::PHASE_LINK );
+
 	// we retry if linker crashes
 	uint32_t attempt( 0 );
 
@@ -205,6 +236,13 @@ LinkerNode::~LinkerNode()
 		// success!
 	}
 
+	if ( useCache && OutputCache::IsWriteEnabled() )
+	{
+		Array< AString > outputFiles( 4, false );
+		GetCacheOutputFiles( outputFiles );
+		OutputCache::Store( this, cacheName, outputFiles );
+	}
+
 	// record time stamp for next time
 	m_Stamp = FileIO::GetFileLastWriteTime( m_Name );
 	ASSERT( m_Stamp );
@@ -398,6 +436,42 @@ void LinkerNode::GetInputFiles( Node * n, Args & fullArgs, const AString & pre,
 	fullArgs.AddDelimiter();
 }
 
+// GetInputFiles
+//------------------------------------------------------------------------------
+void LinkerNode::GetInputFiles( const Node * n, Array< AString > & files ) const
+{
+	// NOTE: must match the files emitted by GetInputFiles( Node *, Args & ... )
+	if ( n->GetType() == Node::LIBRARY_NODE )
+	{
+		if ( GetFlag( LINK_OBJECTS ) )
+		{
+			n->CastTo< LibraryNode >()->GetObjectFiles( files );
+		}
+		else
+		{
+			files.Append( n->GetName() );
+		}
+	}
+	else if ( n->GetType() == Node::OBJECT_LIST_NODE )
+	{
+		n->CastTo< ObjectListNode >()->GetObjectFiles( files );
+	}
+	else if ( n->GetType() == Node::DLL_NODE )
+	{
+		AStackString<> importLibName;
+		n->CastTo< DLLNode >()->GetImportLibName( importLibName );
+		files.Append( importLibName );
+	}
+	else if ( n->GetType() == Node::COPY_FILE_NODE )
+	{
+		GetInputFiles( n->CastTo< CopyFileNode >()->GetSourceNode(), files );
+	}
+	else
+	{
+		files.Append( n->GetName() );
+	}
+}
+
 // GetAssemblyResourceFiles
 //------------------------------------------------------------------------------
 void LinkerNode::GetAssemblyResourceFiles( Args & fullArgs, const AString & pre, const AString & post ) const
@@ -615,6 +689,143 @@ void LinkerNode::GetAssemblyResourceFiles( Args & fullArgs, const AString & pre,
 	return flags;
 }
 
+// GetPDBName
+//------------------------------------------------------------------------------
+void LinkerNode::GetPDBName( AString & pdbName ) const
+{
+	ASSERT( GetFlag( LINK_FLAG_MSVC ) );
+
+	// explicitly specified with /PDB:<file>
+	Array< AString > tokens( 1024, true );
+	m_LinkerArgs.Tokenize( tokens );
+	const AString * const end = tokens.End();
+	for ( const AString * it = tokens.Begin(); it != end; ++it )
+	{
+		const AString & token = *it;
+		if ( ( token.BeginsWithI( "/PDB:" ) || token.BeginsWithI( "-PDB:" ) ) && ( token.GetLength() > 5 ) )
+		{
+			Args::StripQuotes( token.Get() + 5, token.GetEnd(), pdbName );
+			return;
+		}
+	}
+
+	// otherwise, next to the output
+	const char * lastDot = GetName().FindLast( '.' );
+	pdbName.Assign( GetName().Get(), lastDot ? lastDot : GetName().GetEnd() );
+	pdbName += ".pdb";
+}
+
+// ShouldUseCache
+//------------------------------------------------------------------------------
+bool LinkerNode::ShouldUseCache() const
+{
+	if ( GetFlag( LINK_FLAG_ALLOW_CACHING ) == false )
+	{
+		return false;
+	}
+
+	if ( ( OutputCache::IsReadEnabled() == false ) && ( OutputCache::IsWriteEnabled() == false ) )
+	{
+		return false;
+	}
+
+	// incremental links depend on the previous output, and the stamp
+	// step can have side effects we can't capture
+	if ( GetFlag( LINK_FLAG_INCREMENTAL ) || m_LinkerStampExe )
+	{
+		return false;
+	}
+
+	return true;
+}
+
+// GetCacheName
+//------------------------------------------------------------------------------
+bool LinkerNode::GetCacheName( AString & cacheName ) const
+{
+	PROFILE_FUNCTION
+
+	// contents of everything passed to the linker (objects, libs, assembly
+	// resources and other libraries), in link order
+	Array< AString > inputFiles( 1024, true );
+	const Dependency * const end = m_StaticDependencies.End();
+	for ( Dependencies::Iter i = m_StaticDependencies.Begin(); i != end; i++ )
+	{
+		GetInputFiles( i->GetNode(), inputFiles );
+	}
+
+	OutputCache::Key key;
+	for ( const AString & inputFile : inputFiles )
+	{
+		if ( key.AddInputFile( inputFile ) == false )
+		{
+			FLOG_INFO( "Caching disabled for '%s' - can't read input '%s'\n", GetName().Get(), inputFile.Get() );
+			return false;
+		}
+	}
+
+	// libraries, .def files, linker scripts etc named in the args
+	AStackString<> unreadableFile;
+	if ( key.AddArgsInputFiles( m_LinkerArgs, GetFlag( LINK_FLAG_MSVC ), unreadableFile ) == false )
+	{
+		FLOG_INFO( "Caching disabled for '%s' - can't read input '%s'\n", GetName().Get(), unreadableFile.Get() );
+		return false;
+	}
+
+	// args and outputs
+	AStackString<> workingDir( FBuild::Get().GetWorkingDir() );
+	PathUtils::EnsureTrailingSlash( workingDir );
+	key.AddArgs( m_LinkerArgs, workingDir );
+	key.AddPath( m_Name, workingDir );
+	AStackString<> importLibName;
+	if ( m_ImportLibName.IsEmpty() == false )
+	{
+		NodeGraph::CleanPath( m_ImportLibName, importLibName );
+	}
+	key.AddPath( importLibName, workingDir );
+
+	// linker
+	if ( key.SetTool( m_Linker ) == false )
+	{
+		FLOG_INFO( "Caching disabled for '%s' - can't read linker '%s'\n", GetName().Get(), m_Linker.Get() );
+		return false;
+	}
+
+	key.GetCacheName( cacheName );
+	return true;
+}
+
+// GetCacheOutputFiles
+//------------------------------------------------------------------------------
+void LinkerNode::GetCacheOutputFiles( Array< AString > & files ) const
+{
+	// NOTE: order must be stable, as outputs are stored by index
+	files.Append( m_Name );
+
+	if ( GetFlag( LINK_FLAG_MSVC ) )
+	{
+		AStackString<> pdbName;
+		GetPDBName( pdbName );
+		files.Append( pdbName );
+	}
+
+	if ( m_ImportLibName.IsEmpty() == false )
+	{
+		AStackString<> importLibName;
+		NodeGraph::CleanPath( m_ImportLibName, importLibName );
+		files.Append( importLibName );
+
+		// MSVC also writes an export file alongside the import lib
+		if ( GetFlag( LINK_FLAG_MSVC ) )
+		{
+			const char * lastDot = importLibName.FindLast( '.' );
+			AStackString<> expName( importLibName.Get(), lastDot ? lastDot : importLibName.GetEnd() );
+			expName += ".exp";
+			files.Append( expName );
+		}
+	}
+}
+
 // EmitCompilationMessage
 //------------------------------------------------------------------------------
 void LinkerNode::EmitCompilationMessage( const Args & fullArgs ) const
@@ -41,7 +41,8 @@ public:
 		LINK_FLAG_ORBIS_LD	= 0x20,
 		LINK_FLAG_INCREMENTAL = 0x40,
 		LINK_FLAG_GREENHILLS_ELXR = 0x80,
-		LINK_FLAG_CODEWARRIOR_LD=0x100
+		LINK_FLAG_CODEWARRIOR_LD=0x100,
+		LINK_FLAG_ALLOW_CACHING = 0x200
 	};
 
 	inline bool IsADLL() const { return GetFlag( LINK_FLAG_DLL ); }
@@ -59,6 +60,8 @@ protected:
 	void GetInputFiles( Args & fullArgs, const AString & pre, const AString & post ) const;
 	void GetInputFiles( Node * n, Args & fullArgs, const AString & pre, const AString & post ) const;
 	void GetAssemblyResourceFiles( Args & fullArgs, const AString & pre, const AString & post ) const;
+	void GetInputFiles( const Node * n, Array< AString > & files ) const;
+	void GetPDBName( AString & pdbName ) const;
 	void EmitCompilationMessage( const Args & fullArgs ) const;
 	void EmitStampMessage() const;
 
@@ -68,6 +71,11 @@ protected:
 
 	bool CanUseResponseFile() const;
 
+	// caching
+	bool ShouldUseCache() const;
+	bool GetCacheName( AString & cacheName ) const;
+	void GetCacheOutputFiles( Array< AString > & files ) const;
+
 	AString m_LinkerType;
 	AString m_Linker;
 	AString m_LinkerArgs;
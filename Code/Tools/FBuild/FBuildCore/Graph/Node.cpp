@@ -37,9 +37,13 @@
 // Core
 #include "Core/Containers/Array.h"
 #include "Core/FileIO/FileIO.h"
+#include "Core/FileIO/FileStream.h"
 #include "Core/FileIO/IOStream.h"
 #include "Core/FileIO/PathUtils.h"
+#include "Core/Math/Conversions.h"
 #include "Core/Math/CRC32.h"
+#include "Core/Math/xxHash.h"
+#include "Core/Mem/ScratchArena.h"
 #include "Core/Profile/Profile.h"
 #include "Core/Reflection/ReflectedProperty.h"
 #include "Core/Strings/AStackString.h"
@@ -93,13 +97,20 @@ Node::Node( const AString & name, Type type, uint32_t controlFlags )
 	, m_ControlFlags( controlFlags )
 	, m_StatsFlags( 0 )
 	, m_Stamp( 0 )
+	, m_ContentHash( 0 )
+	, m_HashStamp( 0 )
+	, m_ChangeStamp( 0 )
 	, m_RecursiveCost( 0 )
 	, m_Type( type )
 	, m_Next( nullptr )
 	, m_LastBuildTimeMs( 0 )
 	, m_ProcessingTime( 0 )
-	, m_ProgressAccumulator( 0 )
+	, m_BuildStartTime( 0 )
+	, m_BuildEndTime( 0 )
+	, m_ProgressCost( 0 )
 	, m_Index( INVALID_NODE_INDEX )
+	, m_ResourcePool( 0 )
+	, m_ResourcePoolJobMemoryMiB( 0 )
 {
 	SetName( name );
 
@@ -161,6 +172,9 @@ bool Node::DetermineNeedToBuild( bool forceClean ) const
 		}
 	}
 
+	// deps rebuilt with unchanged contents (when content hashing)
+	const Node * earlyCutoffDep = nullptr;
+
 	// static deps
 	const Dependencies & staticDeps = GetStaticDependencies();
 	for ( Dependencies::ConstIter it = staticDeps.Begin();
@@ -197,12 +211,18 @@ bool Node::DetermineNeedToBuild( bool forceClean ) const
 			return true;
 		}
 
-		if ( n->GetStamp() > m_Stamp )
+		if ( n->GetChangeStamp() > m_Stamp )
 		{
 			// file is newer than us
-			FLOG_INFO( "Need to build '%s' (dep is newer: '%s' this = %llu, dep = %llu)", GetName().Get(), n->GetName().Get(), m_Stamp, n->GetStamp() );
+			FLOG_INFO( "Need to build '%s' (dep is newer: '%s' this = %llu, dep = %llu)", GetName().Get(), n->GetName().Get(), m_Stamp, n->GetChangeStamp() );
 			return true;
 		}
+
+		// rebuilt, but with the same contents?
+		if ( ( n->GetStamp() > m_Stamp ) && n->GetStatFlag( Node::STATS_CONTENT_UNCHANGED ) )
+		{
+			earlyCutoffDep = n;
+		}
 	}
 
 	// dynamic deps
@@ -230,14 +250,27 @@ bool Node::DetermineNeedToBuild( bool forceClean ) const
 			return true;
 		}
 
-		if ( n->GetStamp() > m_Stamp )
+		if ( n->GetChangeStamp() > m_Stamp )
 		{
 			// file is newer than us
-			FLOG_INFO( "Need to build '%s' (dep is newer: '%s' this = %llu, dep = %llu)", GetName().Get(), n->GetName().Get(), m_Stamp, n->GetStamp() );
+			FLOG_INFO( "Need to build '%s' (dep is newer: '%s' this = %llu, dep = %llu)", GetName().Get(), n->GetName().Get(), m_Stamp, n->GetChangeStamp() );
 			return true;
 		}
+
+		// rebuilt, but with the same contents?
+		if ( ( n->GetStamp() > m_Stamp ) && n->GetStatFlag( Node::STATS_CONTENT_UNCHANGED ) )
+		{
+			earlyCutoffDep = n;
+		}
 	}
 
+	if ( earlyCutoffDep )
+	{
+		// would have been rebuilt if timestamps alone were considered
+		SetStatFlag( Node::STATS_EARLY_CUTOFF );
+		FLOG_INFO( "Up-To-Date '%s' (dep contents unchanged: '%s')", GetName().Get(), earlyCutoffDep->GetName().Get() );
+		return false;
+	}
 
 	// nothing needs building
 	FLOG_INFO( "Up-To-Date '%s'", GetName().Get() );
@@ -268,6 +301,115 @@ bool Node::DetermineNeedToBuild( bool forceClean ) const
 	return true;
 }
 
+// Migrate
+//------------------------------------------------------------------------------
+/*virtual*/ void Node::Migrate( const Node & oldNode )
+{
+	ASSERT( oldNode.GetType() == GetType() );
+
+	m_Stamp = oldNode.m_Stamp;
+	m_ContentHash = oldNode.m_ContentHash;
+	m_HashStamp = oldNode.m_HashStamp;
+	m_ChangeStamp = oldNode.m_ChangeStamp;
+	m_LastBuildTimeMs = oldNode.m_LastBuildTimeMs;
+	m_BuildTimeHistory = oldNode.m_BuildTimeHistory;
+}
+
+// RecordBuildTime
+//------------------------------------------------------------------------------
+void Node::RecordBuildTime( BuildTimeHistory::Kind kind, uint32_t timeMS )
+{
+	// cache retrievals don't represent how long it takes to create this resource
+	if ( kind != BuildTimeHistory::CACHE )
+	{
+		m_LastBuildTimeMs = timeMS;
+	}
+	m_BuildTimeHistory.Record( kind, timeMS );
+}
+
+// UpdateContentHash
+//------------------------------------------------------------------------------
+void Node::UpdateContentHash()
+{
+	// lists of files track the change stamps of their contents (in DoBuild)
+	if ( IsAFile() == false )
+	{
+		return;
+	}
+
+	if ( ( FBuild::Get().GetOptions().m_UseContentHashing == false ) || ( m_Stamp == 0 ) )
+	{
+		m_ContentHash = 0;
+		m_HashStamp = 0;
+		m_ChangeStamp = 0;
+		return;
+	}
+
+	// files not modified since they were hashed don't need to be hashed again
+	if ( ( m_ContentHash != 0 ) && ( m_Stamp == m_HashStamp ) )
+	{
+		return;
+	}
+
+	uint64_t hash( 0 );
+	if ( HashFileContents( m_Name, hash ) == false )
+	{
+		m_ContentHash = 0;
+		m_HashStamp = 0;
+		m_ChangeStamp = 0;
+		return;
+	}
+	m_HashStamp = m_Stamp;
+
+	if ( ( hash == m_ContentHash ) && ( m_ChangeStamp != 0 ) )
+	{
+		// contents are the same, so dependents only need to consider when they last changed
+		SetStatFlag( Node::STATS_CONTENT_UNCHANGED );
+		FLOG_INFO( "Contents unchanged '%s' (stamp = %llu, changed = %llu)", GetName().Get(), m_Stamp, m_ChangeStamp );
+		return;
+	}
+
+	m_ContentHash = hash;
+	m_ChangeStamp = m_Stamp;
+}
+
+// HashFileContents
+//------------------------------------------------------------------------------
+/*static*/ bool Node::HashFileContents( const AString & fileName, uint64_t & hash )
+{
+	FileStream fs;
+	if ( fs.Open( fileName.Get(), FileStream::READ_ONLY ) == false )
+	{
+		return false;
+	}
+
+	// hash in chunks to avoid holding large outputs in memory
+	const uint64_t chunkSize = ( 1024 * 1024 );
+	ScratchArena::Scope scratchScope( ScratchArena::GetThreadArena() );
+	char * buffer = (char *)ScratchArena::GetThreadArena().Alloc( (size_t)chunkSize );
+
+	uint64_t fileSize = fs.GetFileSize();
+	hash = xxHash::Calc64( &fileSize, sizeof( fileSize ) );
+	while ( fileSize > 0 )
+	{
+		const uint64_t size = Math::Min( fileSize, chunkSize );
+		if ( fs.ReadBuffer( buffer, size ) != size )
+		{
+			return false;
+		}
+		const uint64_t chunkHashes[ 2 ] = { hash, xxHash::Calc64( buffer, (size_t)size ) };
+		hash = xxHash::Calc64( chunkHashes, sizeof( chunkHashes ) );
+		fileSize -= size;
+	}
+
+	// 0 is reserved for "unknown"
+	if ( hash == 0 )
+	{
+		hash = 1;
+	}
+	return true;
+}
+
 // SaveNode
 //------------------------------------------------------------------------------
 /*static*/ void Node::SaveNode( IOStream & fileStream, const Node * node )
@@ -714,7 +856,7 @@ bool Node::Deserialize( NodeGraph & nodeGraph, IOStream & stream )
 void Node::SetName( const AString & name )
 {
 	m_Name = name;
-	m_NameCRC = CRC32::CalcLower( name );
+	m_NameCRC = CRC32::CalcLower( m_Name ); // also caches hash in m_Name for lookups
 }
 
 // ReplaceDummyName
@@ -7,6 +7,7 @@
 // Includes
 //------------------------------------------------------------------------------
 // FBuild
+#include "Tools/FBuild/FBuildCore/Graph/BuildTimeHistory.h"
 #include "Tools/FBuild/FBuildCore/Graph/Dependencies.h"
 
 // Core
@@ -92,6 +93,10 @@ public:
 		STATS_CACHE_STORE	= 0x10, // needed building, was cacheable & was stored to the cache
 		STATS_BUILT_REMOTE  = 0x20, // node was built remotely
 		STATS_FAILED		= 0x40, // node needed building, but failed
+		STATS_CONTENT_UNCHANGED	= 0x80, // node was built, but output contents were unchanged
+		STATS_EARLY_CUTOFF	= 0x100, // node was up-to-date because newer deps had unchanged contents
+		STATS_DEDUPLICATED	= 0x200, // needed building, but output was copied from an identical job
+		STATS_PROGRESS_COUNTED	= 0x2000, // cost added to the build progress total
 		STATS_REPORT_PROCESSED	= 0x4000, // seen during report processing
 		STATS_STATS_PROCESSED	= 0x8000 // mark during stats gathering (leave this last)
 	};
@@ -101,7 +106,8 @@ public:
 		NODE_RESULT_FAILED		= 0,	// something went wrong building
 		NODE_RESULT_NEED_SECOND_BUILD_PASS,	// needs build called again
 		NODE_RESULT_OK,					// built ok
-		NODE_RESULT_OK_CACHE			// retrieved from the cache
+		NODE_RESULT_OK_CACHE,			// retrieved from the cache
+		NODE_RESULT_DEFERRED			// waiting for an identical job to complete
 	};
 
 	enum State
@@ -136,9 +142,11 @@ public:
 	inline uint32_t GetLastBuildTime() const	{ return m_LastBuildTimeMs; }
 	inline uint32_t GetProcessingTime() const	{ return m_ProcessingTime; }
 	inline uint32_t GetRecursiveCost() const	{ return m_RecursiveCost; }
+	inline const BuildTimeHistory & GetBuildTimeHistory() const { return m_BuildTimeHistory; }
 
-	inline uint32_t GetProgressAccumulator() const { return m_ProgressAccumulator; }
-	inline void		SetProgressAccumulator( uint32_t p ) const { m_ProgressAccumulator = p; }
+	// when processing of this node began and ended (Timer::GetNow() values)
+	inline uint64_t GetBuildStartTime() const	{ return m_BuildStartTime; }
+	inline uint64_t GetBuildEndTime() const		{ return m_BuildEndTime; }
 
 	static Node *	Load( NodeGraph & nodeGraph, IOStream & stream );
 	static void		Save( IOStream & stream, const Node * node );
@@ -152,9 +160,15 @@ public:
 	static bool EnsurePathExistsForFile( const AString & name );
 
 	inline uint64_t GetStamp() const { return m_Stamp; }
+	inline uint64_t GetChangeStamp() const { return m_ChangeStamp ? m_ChangeStamp : m_Stamp; }
+	inline uint64_t GetContentHash() const { return m_ContentHash; }
 
 	inline uint32_t GetIndex() const { return m_Index; }
 
+	// resource pool (0 = none, otherwise index + 1)
+	inline uint32_t GetResourcePool() const				{ return m_ResourcePool; }
+	inline uint32_t GetResourcePoolJobMemoryMiB() const	{ return m_ResourcePoolJobMemoryMiB; }
+
 	static void DumpOutput( Job * job,
 							const char * data, 
 							uint32_t dataSize,
@@ -199,8 +213,17 @@ protected:
 	virtual BuildResult DoBuild2( Job * job, bool racingRemoteJob );
 	virtual bool Finalize( NodeGraph & nodeGraph );
 
+	// take build state from equivalent node in previous DB
+	virtual void Migrate( const Node & oldNode );
+
 	inline void		SetLastBuildTime( uint32_t ms ) { m_LastBuildTimeMs = ms; }
+	void			RecordBuildTime( BuildTimeHistory::Kind kind, uint32_t timeMS );
+	void			UpdateContentHash();
+	static bool		HashFileContents( const AString & fileName, uint64_t & hash );
 	inline void		AddProcessingTime( uint32_t ms ){ m_ProcessingTime += ms; }
+	inline void		ResetBuildTimestamps()			{ m_BuildStartTime = 0; m_BuildEndTime = 0; }
+	inline void		RecordBuildStart( uint64_t time ){ if ( m_BuildStartTime == 0 ) { m_BuildStartTime = time; } }
+	inline void		RecordBuildEnd( uint64_t time )	{ m_BuildEndTime = time; }
 
 	static void SaveNode( IOStream & stream, const Node * node );
 	static bool LoadNode( NodeGraph & nodeGraph, IOStream & stream, Node * & node );
@@ -221,14 +244,22 @@ protected:
 	uint32_t		m_ControlFlags;
 	mutable uint32_t		m_StatsFlags;
 	uint64_t		m_Stamp;
+	uint64_t		m_ContentHash;	// hash of file contents when content hashing is enabled (0 if unknown)
+	uint64_t		m_HashStamp;	// stamp of the file when m_ContentHash was calculated
+	uint64_t		m_ChangeStamp;	// stamp when contents last changed (0 if same as m_Stamp)
 	uint32_t		m_RecursiveCost;
 	Type m_Type;
 	Node *			m_Next; // node map linked list pointer
 	uint32_t		m_NameCRC;
 	uint32_t m_LastBuildTimeMs;	// time it took to do last known full build of this node
 	uint32_t m_ProcessingTime;	// time spent on this node
-	mutable uint32_t m_ProgressAccumulator;
+	BuildTimeHistory m_BuildTimeHistory; // rolling times of previous builds of this node
+	uint64_t m_BuildStartTime;	// first processed in the current build (0 if not processed)
+	uint64_t m_BuildEndTime;	// last processed (or result received) in the current build
+	uint32_t m_ProgressCost;	// estimated time counted towards build progress
 	uint32_t		m_Index;
+	uint32_t		m_ResourcePool;				// 0 = none, otherwise index + 1
+	uint32_t		m_ResourcePoolJobMemoryMiB;	// 0 = pool default
 
 	Dependencies m_PreBuildDependencies;
 	Dependencies m_StaticDependencies;
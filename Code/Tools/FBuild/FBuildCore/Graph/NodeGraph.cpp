@@ -8,6 +8,7 @@
 #include "NodeGraph.h"
 
 #include "Tools/FBuild/FBuildCore/BFF/BFFParser.h"
+#include "Tools/FBuild/FBuildCore/BFF/BFFVariable.h"
 #include "Tools/FBuild/FBuildCore/BFF/Functions/FunctionSettings.h"
 #include "Tools/FBuild/FBuildCore/FLog.h"
 #include "Tools/FBuild/FBuildCore/FBuild.h"
@@ -39,6 +40,7 @@
 #include "Core/FileIO/ConstMemoryStream.h"
 #include "Core/FileIO/FileIO.h"
 #include "Core/FileIO/FileStream.h"
+#include "Core/FileIO/MemoryStream.h"
 #include "Core/FileIO/PathUtils.h"
 #include "Core/Math/CRC32.h"
 #include "Core/Math/xxHash.h"
@@ -64,6 +66,10 @@ NodeGraph::NodeGraph()
 : m_AllNodes( 1024, true )
 , m_NextNodeIndex( 0 )
 , m_UsedFiles( 16, true )
+, m_ProgressTotalTime( 0 )
+, m_ProgressBuiltTime( 0 )
+, m_PreviousNodeGraph( nullptr )
+, m_NumNodesMigrated( 0 )
 {
 	m_NodeMap = FNEW_ARRAY( Node *[NODEMAP_TABLE_SIZE] );
 	memset( m_NodeMap, 0, sizeof( Node * ) * NODEMAP_TABLE_SIZE );
@@ -73,14 +79,11 @@ NodeGraph::NodeGraph()
 //------------------------------------------------------------------------------
 NodeGraph::~NodeGraph()
 {
-	Array< Node * >::Iter i = m_AllNodes.Begin();
-	Array< Node * >::Iter end = m_AllNodes.End();
-	for ( ; i != end; ++i )
-	{
-		FDELETE ( *i );
-	}
+	FreeNodes();
 
 	FDELETE_ARRAY( m_NodeMap );
+
+	FDELETE( m_PreviousNodeGraph );
 }
 
 // Initialize
@@ -121,7 +124,9 @@ NodeGraph::~NodeGraph()
 		case LoadResult::OK_BFF_CHANGED:
 		{
 			// Create a fresh DB by parsing the modified BFF
+			// (unchanged includes can be reused from the old DB)
 			NodeGraph * newNG = FNEW( NodeGraph );
+			newNG->m_IncludeCache.Swap( oldNG->m_IncludeCache );
 			if ( newNG->ParseFromRoot( bffFile ) == false )
 			{
 				FDELETE( newNG );
@@ -129,8 +134,8 @@ NodeGraph::~NodeGraph()
 				return nullptr;
 			}
 
-			// TODO: Migrate old DB info to new DB
-			FDELETE( oldNG );
+			// Reuse build state of nodes which haven't changed
+			newNG->MigrateNodes( oldNG );
 
 			return newNG;
 		}
@@ -145,6 +150,118 @@ NodeGraph::~NodeGraph()
 	return nullptr;
 }
 
+// FreeNodes
+//------------------------------------------------------------------------------
+void NodeGraph::FreeNodes()
+{
+	Array< Node * >::Iter i = m_AllNodes.Begin();
+	Array< Node * >::Iter end = m_AllNodes.End();
+	for ( ; i != end; ++i )
+	{
+		FDELETE ( *i );
+	}
+	m_AllNodes.Clear();
+	m_NextNodeIndex = 0;
+	memset( m_NodeMap, 0, sizeof( Node * ) * NODEMAP_TABLE_SIZE );
+}
+
+// MigrateNodes
+//------------------------------------------------------------------------------
+void NodeGraph::MigrateNodes( NodeGraph * oldNodeGraph )
+{
+	PROFILE_FUNCTION
+
+	ASSERT( m_PreviousNodeGraph == nullptr );
+
+	// Nodes in the old DB are only used for comparison from now on, so we
+	// re-purpose their indices to refer to the equivalent node in this DB.
+	// This allows node definitions to be compared by serializing them.
+	for ( Node * oldNode : oldNodeGraph->m_AllNodes )
+	{
+		Node * newNode = FindNodeInternal( oldNode->GetName() );
+		oldNode->SetIndex( newNode ? newNode->GetIndex() : INVALID_NODE_INDEX );
+	}
+
+	// keep old DB around, for nodes which are created during the build
+	m_PreviousNodeGraph = oldNodeGraph;
+	m_BuildTimeEstimator = oldNodeGraph->m_BuildTimeEstimator;
+
+	// migrate nodes created by parsing the BFF
+	const size_t numNodes = m_AllNodes.GetSize(); // migration can add file nodes
+	for ( size_t i = 0; i < numNodes; ++i )
+	{
+		MigrateNode( m_AllNodes[ i ] );
+	}
+
+	FLOG_INFO( "Migrated build state of %u of %u nodes from previous DB", m_NumNodesMigrated, (uint32_t)numNodes );
+}
+
+// MigrateNode
+//------------------------------------------------------------------------------
+void NodeGraph::MigrateNode( Node * newNode )
+{
+	ASSERT( Thread::IsMainThread() );
+
+	if ( m_PreviousNodeGraph == nullptr )
+	{
+		return; // nothing to migrate from
+	}
+
+	// File nodes have no persistent state
+	if ( newNode->GetType() == Node::FILE_NODE )
+	{
+		return;
+	}
+
+	// Find node of the same name and type
+	const Node * oldNode = m_PreviousNodeGraph->FindNodeInternal( newNode->GetName() );
+	if ( ( oldNode == nullptr ) || ( oldNode->GetType() != newNode->GetType() ) )
+	{
+		return;
+	}
+
+	ASSERT( newNode->GetStamp() == 0 ); // new node should not have been built yet
+	ASSERT( newNode->m_DynamicDependencies.IsEmpty() );
+
+	// dynamic dependencies from the old DB must exist in this one
+	Dependencies dynamicDeps( oldNode->m_DynamicDependencies.GetSize(), false );
+	for ( const Dependency & dep : oldNode->m_DynamicDependencies )
+	{
+		const Node * oldDepNode = dep.GetNode();
+		Node * newDepNode = FindNodeInternal( oldDepNode->GetName() );
+		if ( newDepNode == nullptr )
+		{
+			if ( oldDepNode->GetType() != Node::FILE_NODE )
+			{
+				return; // can't migrate
+			}
+			newDepNode = CreateFileNode( oldDepNode->GetName(), false ); // AddNode updates index of old node
+		}
+		dynamicDeps.Append( Dependency( newDepNode, dep.IsWeak() ) );
+	}
+
+	// take build state of old node
+	newNode->m_DynamicDependencies.Swap( dynamicDeps );
+	newNode->Migrate( *oldNode );
+
+	// only keep it if the definition of the node is identical
+	MemoryStream oldDefinition;
+	MemoryStream newDefinition;
+	Node::Save( oldDefinition, oldNode );
+	Node::Save( newDefinition, newNode );
+	if ( ( oldDefinition.GetSize() != newDefinition.GetSize() ) ||
+		 ( memcmp( oldDefinition.GetData(), newDefinition.GetData(), oldDefinition.GetSize() ) != 0 ) )
+	{
+		// node has changed - revert (zero stamp ensures other state is rebuilt)
+		// but keep the build times, which are still the best estimate we have
+		newNode->m_DynamicDependencies.Swap( dynamicDeps );
+		newNode->m_Stamp = 0;
+		return;
+	}
+
+	++m_NumNodesMigrated;
+}
+
 // ParseFromRoot
 //------------------------------------------------------------------------------
 bool NodeGraph::ParseFromRoot( const char * bffFile )
@@ -173,9 +290,23 @@ bool NodeGraph::ParseFromRoot( const char * bffFile )
 	const uint64_t rootBFFDataHash = xxHash::Calc64( data.Get(), size );
 
 	// re-parse the BFF from scratch, clean build will result
+	BFFVariable::ResetStats();
 	BFFParser bffParser( *this );
 	data.Get()[ size ] = '\0'; // data passed to parser must be NULL terminated
-	return bffParser.Parse( data.Get(), size, bffFile, rootBFFTimeStamp, rootBFFDataHash ); // pass size excluding sentinel
+	const bool ok = bffParser.Parse( data.Get(), size, bffFile, rootBFFTimeStamp, rootBFFDataHash ); // pass size excluding sentinel
+
+	// forget includes which are no longer used
+	m_IncludeCache.RemoveUnused();
+	FLOG_INFO( "BFF includes: %u replayed from cache, %u recorded",
+			   m_IncludeCache.GetNumReplayed(),
+			   m_IncludeCache.GetNumRecorded() );
+
+	FLOG_INFO( "BFF variables: %u created, %u values allocated, %u values shared",
+			   BFFVariable::GetNumVariablesCreated(),
+			   BFFVariable::GetNumValuesCreated(),
+			   BFFVariable::GetNumValuesShared() );
+
+	return ok;
 }
 
 // Load
@@ -220,7 +351,15 @@ NodeGraph::LoadResult NodeGraph::Load( IOStream & stream, const char * nodeGraph
 		return LoadResult::OK_BFF_CHANGED;
 	}
 
+	// results of parsing includes
+	if ( m_IncludeCache.Load( stream ) == false )
+	{
+		return LoadResult::LOAD_ERROR;
+	}
+
 	// check if any files used have changed
+	// (if so, we still load the nodes so their build state can be migrated)
+	bool bffChanged = false;
 	for ( size_t i=0; i<usedFiles.GetSize(); ++i )
 	{
 		const AString & fileName = usedFiles[ i ].m_FileName;
@@ -234,7 +373,8 @@ NodeGraph::LoadResult NodeGraph::Load( IOStream & stream, const char * nodeGraph
 		if ( fs.Open( fileName.Get(), FileStream::READ_ONLY ) == false )	
 		{
 			FLOG_INFO( "BFF file '%s' missing or unopenable (reparsing will occur).", fileName.Get() );
-			return LoadResult::OK_BFF_CHANGED; // not opening the file is not an error, it could be not needed anymore
+			bffChanged = true; // not opening the file is not an error, it could be not needed anymore
+			break;
 		}
 
 		const size_t size = (size_t)fs.GetFileSize();
@@ -253,10 +393,14 @@ NodeGraph::LoadResult NodeGraph::Load( IOStream & stream, const char * nodeGraph
 		}
 
 		FLOG_WARN( "BFF file '%s' has changed (reparsing will occur).", fileName.Get() );
-		return LoadResult::OK_BFF_CHANGED;
+		bffChanged = true;
+		break;
 	}
 
-	m_UsedFiles = usedFiles;
+	if ( bffChanged == false )
+	{
+		m_UsedFiles = usedFiles;
+	}
 
 	// TODO:C The serialization of these settings doesn't really belong here (not part of node graph)
 	// cachepath
@@ -317,6 +461,17 @@ NodeGraph::LoadResult NodeGraph::Load( IOStream & stream, const char * nodeGraph
 			{
 				return LoadResult::LOAD_ERROR;
 			}
+			if ( bffChanged )
+			{
+				// BFF will be re-parsed (and will import what it needs), but build
+				// state can only be migrated if the environment is the same
+				if ( ( Env::GetEnvVariable( varName.Get(), varValue ) == false ) ||
+					 ( xxHash::Calc32( varValue ) != savedVarHash ) )
+				{
+					return LoadResult::OK_BFF_CHANGED;
+				}
+				continue;
+			}
 			if ( FBuild::Get().ImportEnvironmentVar( varName.Get(), varValue, importedVarHash ) == false )
 			{
 				// make sure the user knows why some things might re-build
@@ -357,6 +512,22 @@ NodeGraph::LoadResult NodeGraph::Load( IOStream & stream, const char * nodeGraph
 		return LoadResult::LOAD_ERROR;
 	}
 
+	// resource pools
+	uint32_t numResourcePools( 0 );
+	if ( stream.Read( numResourcePools ) == false )
+	{
+		return LoadResult::LOAD_ERROR;
+	}
+	Array< ResourcePool > resourcePools( numResourcePools, false );
+	resourcePools.SetSize( numResourcePools );
+	for ( ResourcePool & pool : resourcePools )
+	{
+		if ( pool.Load( stream ) == false )
+		{
+			return LoadResult::LOAD_ERROR;
+		}
+	}
+
 	ASSERT( m_AllNodes.GetSize() == 0 );
 
 	// Read nodes
@@ -372,10 +543,23 @@ NodeGraph::LoadResult NodeGraph::Load( IOStream & stream, const char * nodeGraph
 	{
 		if ( LoadNode( stream ) == false )
 		{
+			if ( bffChanged )
+			{
+				// can't migrate build state, but BFF will be re-parsed anyway
+				FreeNodes();
+				return LoadResult::OK_BFF_CHANGED;
+			}
 			return LoadResult::LOAD_ERROR;
 		}
 	}
 
+	// nodes are only needed for migration if BFF has changed, and
+	// settings will come from the re-parsed BFF
+	if ( bffChanged )
+	{
+		return LoadResult::OK_BFF_CHANGED;
+	}
+
 	// sanity check loading
 	for ( size_t i=0; i<numNodes; ++i )
 	{
@@ -403,6 +587,9 @@ NodeGraph::LoadResult NodeGraph::Load( IOStream & stream, const char * nodeGraph
 	// Workers
 	FBuild::Get().SetWorkerList( workerList );
 
+	// Resource Pools
+	FBuild::Get().SetResourcePools( resourcePools );
+
 	return LoadResult::OK;
 }
 
@@ -439,6 +626,26 @@ bool NodeGraph::LoadNode( IOStream & stream )
 		return false;
 	}
 	n->SetLastBuildTime( lastTimeToBuild );
+	if ( n->m_BuildTimeHistory.Load( stream ) == false )
+	{
+		return false;
+	}
+	UpdateBuildTimeEstimates( n );
+
+	// load content hash state
+	if ( ( stream.Read( n->m_ContentHash ) == false ) ||
+		 ( stream.Read( n->m_HashStamp ) == false ) ||
+		 ( stream.Read( n->m_ChangeStamp ) == false ) )
+	{
+		return false;
+	}
+
+	// load resource pool
+	if ( ( stream.Read( n->m_ResourcePool ) == false ) ||
+		 ( stream.Read( n->m_ResourcePoolJobMemoryMiB ) == false ) )
+	{
+		return false;
+	}
 
 	return true;
 }
@@ -471,6 +678,9 @@ void NodeGraph::Save( IOStream & stream, const char* nodeGraphDBFile ) const
 		stream.Write( dataHash );
 	}
 
+	// results of parsing includes
+	m_IncludeCache.Save( stream );
+
 	// TODO:C The serialization of these settings doesn't really belong here (not part of node graph)
 	{
 		// cache path
@@ -509,6 +719,14 @@ void NodeGraph::Save( IOStream & stream, const char* nodeGraphDBFile ) const
 		// worker list
 		const Array< AString > & workerList = FBuild::Get().GetWorkerList();
 		stream.Write( workerList );
+
+		// resource pools
+		const Array< ResourcePool > & resourcePools = FBuild::Get().GetResourcePools();
+		stream.Write( (uint32_t)resourcePools.GetSize() );
+		for ( const ResourcePool & pool : resourcePools )
+		{
+			pool.Save( stream );
+		}
 	}
 
 	// Write nodes
@@ -560,6 +778,16 @@ void NodeGraph::Save( IOStream & stream, const char* nodeGraphDBFile ) const
 	// save build time
 	uint32_t lastBuildTime = node->GetLastBuildTime();
 	stream.Write( lastBuildTime );
+	node->m_BuildTimeHistory.Save( stream );
+
+	// save content hash state
+	stream.Write( node->m_ContentHash );
+	stream.Write( node->m_HashStamp );
+	stream.Write( node->m_ChangeStamp );
+
+	// save resource pool (not part of the node's build settings)
+	stream.Write( node->m_ResourcePool );
+	stream.Write( node->m_ResourcePoolJobMemoryMiB );
 
 	savedNodeFlags[ nodeIndex ] = true; // mark as saved
 }
@@ -627,11 +855,12 @@ CopyFileNode * NodeGraph::CreateCopyFileNode( const AString & dstFileName )
 CopyDirNode * NodeGraph::CreateCopyDirNode( const AString & nodeName, 
 											Dependencies & staticDeps,
 											const AString & destPath,
-											const Dependencies & preBuildDependencies )
+											const Dependencies & preBuildDependencies,
+											bool useHardLinks )
 {
 	ASSERT( Thread::IsMainThread() );
 
-	CopyDirNode * node = FNEW( CopyDirNode( nodeName, staticDeps, destPath, preBuildDependencies ) );
+	CopyDirNode * node = FNEW( CopyDirNode( nodeName, staticDeps, destPath, preBuildDependencies, useHardLinks ) );
 	AddNode( node );
 	return node;
 }
@@ -658,14 +887,15 @@ ExecNode * NodeGraph::CreateExecNode( const AString & dstFileName,
 									  const AString & workingDir,
 									  int32_t expectedReturnCode,
 									  const Dependencies & preBuildDependencies,
-									  bool useStdOutAsOutput )
+									  bool useStdOutAsOutput,
+									  bool cacheable )
 {
 	ASSERT( Thread::IsMainThread() );
 
 	AStackString< 512 > fullPath;
 	CleanPath( dstFileName, fullPath );
 
-	ExecNode * node = FNEW( ExecNode( fullPath, inputFiles, executable, arguments, workingDir, expectedReturnCode, preBuildDependencies, useStdOutAsOutput ) );
+	ExecNode * node = FNEW( ExecNode( fullPath, inputFiles, executable, arguments, workingDir, expectedReturnCode, preBuildDependencies, useStdOutAsOutput, cacheable ) );
 	AddNode( node );
 	return node;
 }
@@ -1073,7 +1303,7 @@ void NodeGraph::AddNode( Node * node )
 	ASSERT( FindNodeInternal( node->GetName() ) == nullptr ); // node name must be unique
 
 	// track in NodeMap
-	const uint32_t crc = CRC32::CalcLower( node->GetName() );
+	const uint32_t crc = node->GetNameCRC();
 	const size_t key = ( crc & 0xFFFF );
 	node->m_Next = m_NodeMap[ key ];
 	m_NodeMap[ key ] = node;
@@ -1094,6 +1324,16 @@ void NodeGraph::AddNode( Node * node )
 	// set index on node
 	node->SetIndex( m_NextNodeIndex );
 	m_NextNodeIndex = (uint32_t)m_AllNodes.GetSize();
+
+	// equivalent node in old DB (if migrating) now refers to this one
+	if ( m_PreviousNodeGraph )
+	{
+		Node * oldNode = m_PreviousNodeGraph->FindNodeInternal( node->GetName() );
+		if ( oldNode )
+		{
+			oldNode->SetIndex( node->GetIndex() );
+		}
+	}
 }
 
 // Build
@@ -1163,8 +1403,20 @@ void NodeGraph::BuildRecurse( Node * nodeToBuild, uint32_t cost )
 	// already building, or queued to build?
 	ASSERT( nodeToBuild->GetState() != Node::BUILDING )
 
-	// accumulate recursive cost
-	cost += nodeToBuild->GetLastBuildTime();
+	// accumulate recursive cost (the time from the start of this node to the
+	// completion of the target). The longest path seen in any pass is kept,
+	// and passed on to dependencies.
+	const uint32_t estimatedTime = GetEstimatedBuildTime( nodeToBuild );
+	RecordProgressDiscovered( nodeToBuild, estimatedTime );
+	cost += estimatedTime;
+	if ( cost > nodeToBuild->m_RecursiveCost )
+	{
+		nodeToBuild->m_RecursiveCost = cost;
+	}
+	else
+	{
+		cost = nodeToBuild->m_RecursiveCost;
+	}
 
 	// check pre-build dependencies
 	if ( nodeToBuild->GetState() == Node::NOT_PROCESSED )
@@ -1230,12 +1482,18 @@ void NodeGraph::BuildRecurse( Node * nodeToBuild, uint32_t cost )
 	nodeToBuild->SetStatFlag( Node::STATS_PROCESSED );
 	if ( nodeToBuild->DetermineNeedToBuild( forceClean ) )
 	{
-		nodeToBuild->m_RecursiveCost = cost;
 		JobQueue::Get().AddJobToBatch( nodeToBuild );
+
+		// trivial builds are completed immediately
+		if ( nodeToBuild->GetState() == Node::UP_TO_DATE )
+		{
+			RecordProgressCompleted( nodeToBuild );
+		}
 	}
 	else
 	{
 		nodeToBuild->SetState( Node::UP_TO_DATE );
+		RecordProgressCompleted( nodeToBuild );
 	}
 }
 
@@ -1271,6 +1529,15 @@ bool NodeGraph::CheckDependencies( Node * nodeToBuild, const Dependencies & depe
 	
 				BuildRecurse( n, cost );
 			}
+			else
+			{
+				// already seen via another path, but this one may be longer
+				const uint32_t depCost = cost + GetEstimatedBuildTime( n );
+				if ( depCost > n->m_RecursiveCost )
+				{
+					n->m_RecursiveCost = depCost;
+				}
+			}
 		}
 
 		// dependency is uptodate, nothing more to be done
@@ -1281,15 +1548,6 @@ bool NodeGraph::CheckDependencies( Node * nodeToBuild, const Dependencies & depe
 			continue;
 		}
 
-		if ( state == Node::BUILDING )
-		{
-			// ensure deepest traversal cost is kept
-			if ( cost > nodeToBuild->m_RecursiveCost )
-			{
-				nodeToBuild->m_RecursiveCost = cost;
-			}
-		}
-
 		allDependenciesUpToDate = false;
 
 		// dependency failed?
@@ -1381,6 +1639,18 @@ bool NodeGraph::CheckDependencies( Node * nodeToBuild, const Dependencies & depe
     #endif
 	while ( src < srcEnd )
 	{
+		// copy runs of characters needing no special handling in bulk
+		const char * runEnd = AString::FindFirstOf( src, srcEnd, NATIVE_SLASH, OTHER_SLASH, '.' );
+		if ( runEnd != src )
+		{
+			const size_t runLength = (size_t)( runEnd - src );
+			memcpy( dst, src, runLength );
+			dst += runLength;
+			src = runEnd;
+			lastChar = *( runEnd - 1 );
+			continue;
+		}
+
 		const char thisChar = *src;
 
 		// hit a slash?
@@ -1620,75 +1890,77 @@ void NodeGraph::FindNearestNodesInternal( const AString & fullPath, Array< NodeW
     }
 }
 
-// UpdateBuildStatus
-//------------------------------------------------------------------------------
-/*static*/ void NodeGraph::UpdateBuildStatus( const Node * node, 
-											  uint32_t & nodesBuiltTime, 
-											  uint32_t & totalNodeTime )
-{
-	s_BuildPassTag++;
-	UpdateBuildStatusRecurse( node, nodesBuiltTime, totalNodeTime );
-}
-
-// UpdateBuildStatusRecurse
+// GetEstimatedBuildTime
 //------------------------------------------------------------------------------
-/*static*/ void NodeGraph::UpdateBuildStatusRecurse( const Node * node, 
-													 uint32_t & nodesBuiltTime, 
-													 uint32_t & totalNodeTime )
+uint32_t NodeGraph::GetEstimatedBuildTime( const Node * node ) const
 {
-	// record time for this node
-	uint32_t nodeTime = node->GetLastBuildTime();
-	totalNodeTime += nodeTime;
-	nodesBuiltTime += ( node->GetState() == Node::UP_TO_DATE ) ? nodeTime : 0;
-
-	// record accumulated child time if available
-	uint32_t accumulatedProgress = node->GetProgressAccumulator();
-	if ( accumulatedProgress > 0 )
+	// use history of this node if we have it
+	uint32_t estimate = node->GetBuildTimeHistory().GetEstimate();
+	if ( estimate > 0 )
 	{
-		nodesBuiltTime += accumulatedProgress;
-		totalNodeTime += accumulatedProgress;
-		return;
+		return estimate;
 	}
 
-	// don't recurse the same node multiple times in the same pass
-	const uint32_t buildPassTag = s_BuildPassTag;
-	if ( node->GetBuildPassTag() == buildPassTag )
+	// otherwise, use history of similar nodes (i.e. for clean builds)
+	estimate = m_BuildTimeEstimator.Estimate( node );
+	if ( estimate > 0 )
 	{
-		return;
+		return estimate;
 	}
-	node->SetBuildPassTag( buildPassTag );
 
-	// calculate time for children
+	// fall back to default for the node type
+	return node->GetLastBuildTime();
+}
 
-	uint32_t progress = 0;
-	uint32_t total = 0;
+// UpdateBuildTimeEstimates
+//------------------------------------------------------------------------------
+void NodeGraph::UpdateBuildTimeEstimates( const Node * node )
+{
+	const uint32_t estimate = node->GetBuildTimeHistory().GetEstimate();
+	if ( estimate > 0 )
+	{
+		m_BuildTimeEstimator.AddSample( node, estimate );
+	}
+}
 
-	UpdateBuildStatusRecurse( node->GetPreBuildDependencies(), progress, total );
-	UpdateBuildStatusRecurse( node->GetStaticDependencies(), progress, total );
-	UpdateBuildStatusRecurse( node->GetDynamicDependencies(), progress, total );
+// ResetBuildProgress
+//------------------------------------------------------------------------------
+void NodeGraph::ResetBuildProgress()
+{
+	m_ProgressTotalTime = 0;
+	m_ProgressBuiltTime = 0;
 
-	nodesBuiltTime += progress;
-	totalNodeTime += total;
+	// nodes can be counted again by the next build (in the same process)
+	for ( Node * node : m_AllNodes )
+	{
+		node->m_StatsFlags &= ~(uint32_t)Node::STATS_PROGRESS_COUNTED;
+	}
+}
 
-	// if node is building, then progress of children cannot change
-	// and we can store it in the accumulator
-	if ( node->GetState() >= Node::BUILDING )
+// RecordProgressDiscovered (Main Thread)
+//------------------------------------------------------------------------------
+void NodeGraph::RecordProgressDiscovered( Node * node, uint32_t estimatedTime )
+{
+	// only count each node once per build
+	if ( node->GetStatFlag( Node::STATS_PROGRESS_COUNTED ) )
 	{
-		node->SetProgressAccumulator(total);
+		return;
 	}
+	node->SetStatFlag( Node::STATS_PROGRESS_COUNTED );
+
+	// remember what was added, so completion adds the same amount
+	node->m_ProgressCost = estimatedTime;
+	m_ProgressTotalTime += estimatedTime;
 }
 
-// UpdateBuildStatusRecurse
+// RecordProgressCompleted (Main Thread)
 //------------------------------------------------------------------------------
-/*static*/ void NodeGraph::UpdateBuildStatusRecurse( const Dependencies & dependencies, 
-													 uint32_t & nodesBuiltTime, 
-													 uint32_t & totalNodeTime )
+void NodeGraph::RecordProgressCompleted( const Node * node )
 {
-	for ( Dependencies::Iter i = dependencies.Begin();
-		i != dependencies.End();
-		i++ )
+	ASSERT( node->GetState() == Node::UP_TO_DATE );
+	if ( node->GetStatFlag( Node::STATS_PROGRESS_COUNTED ) )
 	{
-		UpdateBuildStatusRecurse( i->GetNode(), nodesBuiltTime, totalNodeTime );
+		m_ProgressBuiltTime += node->m_ProgressCost;
 	}
 }
 
@@ -6,6 +6,8 @@
 
 // Includes
 //------------------------------------------------------------------------------
+#include "Tools/FBuild/FBuildCore/BFF/BFFIncludeCache.h"
+#include "Tools/FBuild/FBuildCore/Graph/BuildTimeHistory.h"
 #include "Tools/FBuild/FBuildCore/Helpers/SLNGenerator.h"
 #include "Tools/FBuild/FBuildCore/Helpers/VSProjectGenerator.h"
 
@@ -54,7 +56,7 @@ public:
 	}
 	inline ~NodeGraphHeader() {}
 
-	enum { NODE_GRAPH_CURRENT_VERSION = 87 };
+	enum { NODE_GRAPH_CURRENT_VERSION = 95 };
 
 	bool IsValid() const
 	{
@@ -100,7 +102,8 @@ public:
 	CopyDirNode * CreateCopyDirNode( const AString & nodeName, 
 									 Dependencies & staticDeps,
 									 const AString & destPath,
-									 const Dependencies & preBuildDependencies );
+									 const Dependencies & preBuildDependencies,
+									 bool useHardLinks );
 	RemoveDirNode * CreateRemoveDirNode(const AString & nodeName,
 									 	Dependencies & staticDeps,
 									 	const Dependencies & preBuildDependencies );
@@ -111,7 +114,8 @@ public:
 							   const AString & workingDir,
 							   int32_t expectedReturnCode,
 							   const Dependencies & preBuildDependencies,
-							   bool useStdOutAsOutput );
+							   bool useStdOutAsOutput,
+							   bool cacheable );
 	FileNode * CreateFileNode( const AString & fileName, bool cleanPath = true );
 	DirectoryListNode * CreateDirectoryListNode( const AString & name,
 												 const AString & path,
@@ -242,24 +246,35 @@ public:
 	bool IsOneUseFile( const AString & fileName ) const;
 	void SetCurrentFileAsOneUse();
 
-	static void UpdateBuildStatus( const Node * node, 
-								   uint32_t & nodesBuiltTime, 
-								   uint32_t & totalNodeTime );
+	// reuse build state of an identical node from the previous DB (when BFF has changed)
+	void MigrateNode( Node * newNode );
+
+	// results of parsing includes, reused when the BFF is re-parsed
+	inline BFFIncludeCache & GetIncludeCache() { return m_IncludeCache; }
+
+	// expected time to build a node, used to prioritize the critical path
+	uint32_t GetEstimatedBuildTime( const Node * node ) const;
+	void UpdateBuildTimeEstimates( const Node * node );
+	inline const BuildTimeEstimator & GetBuildTimeEstimator() const { return m_BuildTimeEstimator; }
+
+	// build progress, accumulated as nodes are discovered and completed
+	void ResetBuildProgress();
+	void RecordProgressCompleted( const Node * node );
+	inline uint32_t GetProgressBuiltTime() const { return m_ProgressBuiltTime; }
+	inline uint32_t GetProgressTotalTime() const { return m_ProgressTotalTime; }
 private:
 	friend class FBuild;
 
 	bool ParseFromRoot( const char * bffFile );
 
+	void FreeNodes();
+	void MigrateNodes( NodeGraph * oldNodeGraph );
+
 	void AddNode( Node * node );
 
 	void BuildRecurse( Node * nodeToBuild, uint32_t cost );
 	bool CheckDependencies( Node * nodeToBuild, const Dependencies & dependencies, uint32_t cost );
-	static void UpdateBuildStatusRecurse( const Node * node, 
-										  uint32_t & nodesBuiltTime, 
-										  uint32_t & totalNodeTime );
-	static void UpdateBuildStatusRecurse( const Dependencies & dependencies, 
-										  uint32_t & nodesBuiltTime, 
-										  uint32_t & totalNodeTime );
+	void RecordProgressDiscovered( Node * node, uint32_t estimatedTime );
 
 	Node * FindNodeInternal( const AString & fullPath ) const;
 
@@ -299,6 +314,19 @@ private:
 	};
 	Array< UsedFile > m_UsedFiles;
 
+	BFFIncludeCache m_IncludeCache;
+
+	// average build times of similar nodes, for nodes with no history
+	BuildTimeEstimator m_BuildTimeEstimator;
+
+	// estimated time of nodes seen in this build, and of those completed
+	uint32_t		m_ProgressTotalTime;
+	uint32_t		m_ProgressBuiltTime;
+
+	// DB from before the BFF changed, used to migrate build state
+	NodeGraph *		m_PreviousNodeGraph;
+	uint32_t		m_NumNodesMigrated;
+
 	static uint32_t s_BuildPassTag;
 };
 
@@ -273,14 +273,25 @@ ObjectListNode::~ObjectListNode()
 {
 	// consider ourselves to be as recent as the newest file
 	uint64_t timeStamp = 0;
+	uint64_t changeStamp = 0;
+	bool contentUnchanged = false;
 	const Dependency * const end = m_DynamicDependencies.End();
 	for ( const Dependency * it = m_DynamicDependencies.Begin(); it != end; ++it )
 	{
 		ObjectNode * on = it->GetNode()->CastTo< ObjectNode >();
 		timeStamp = Math::Max< uint64_t >( timeStamp, on->GetStamp() );
+		changeStamp = Math::Max< uint64_t >( changeStamp, on->GetChangeStamp() );
+		contentUnchanged |= on->GetStatFlag( Node::STATS_CONTENT_UNCHANGED );
 	}
 	m_Stamp = timeStamp;
 
+	// files rebuilt with unchanged contents don't make our contents newer
+	m_ChangeStamp = ( changeStamp < timeStamp ) ? changeStamp : 0;
+	if ( contentUnchanged )
+	{
+		SetStatFlag( Node::STATS_CONTENT_UNCHANGED );
+	}
+
 	return NODE_RESULT_OK;
 }
 
@@ -337,6 +348,45 @@ void ObjectListNode::GetInputFiles( Args & fullArgs, const AString & pre, const
 	}
 }
 
+// GetObjectFiles
+//------------------------------------------------------------------------------
+void ObjectListNode::GetObjectFiles( Array< AString > & files ) const
+{
+	// NOTE: must match the files emitted by GetInputFiles( Args & ... )
+	for ( Dependencies::Iter i = m_DynamicDependencies.Begin();
+		  i != m_DynamicDependencies.End();
+		  i++ )
+	{
+		const Node * n = i->GetNode();
+
+		// handle pch files - get path to object
+		if ( n->GetType() == Node::OBJECT_NODE )
+		{
+			const ObjectNode * on = n->CastTo< ObjectNode >();
+			if ( on->IsCreatingPCH() )
+			{
+				if ( on->IsMSVC() )
+				{
+					AStackString<> objName( on->GetName() );
+					objName += on->GetObjExtension();
+					files.Append( objName );
+				}
+				continue; // Clang/GCC/SNC don't have an object to link for a pch
+			}
+		}
+
+		// extract objects from additional lists
+		if ( n->GetType() == Node::OBJECT_LIST_NODE )
+		{
+			n->CastTo< ObjectListNode >()->GetObjectFiles( files );
+			continue;
+		}
+
+		// normal object
+		files.Append( n->GetName() );
+	}
+}
+
 // GetInputFiles
 //------------------------------------------------------------------------------
 void ObjectListNode::GetInputFiles( Array< AString > & files ) const
@@ -419,6 +469,7 @@ bool ObjectListNode::CreateDynamicObjectNode( NodeGraph & nodeGraph, Node * inpu
         }
 
 		on = nodeGraph.CreateObjectNode( objFile, inputFile, m_Compiler, m_CompilerArgs, m_CompilerArgsDeoptimized, m_PrecompiledHeader, flags, m_CompilerForceUsing, m_DeoptimizeWritableFiles, m_DeoptimizeWritableFilesWithToken, m_AllowDistribution, m_AllowCaching, m_Preprocessor, m_PreprocessorArgs, preprocessorFlags );
+		nodeGraph.MigrateNode( on );
 	}
 	else if ( on->GetType() != Node::OBJECT_NODE )
 	{
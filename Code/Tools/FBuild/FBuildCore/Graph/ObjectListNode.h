@@ -50,6 +50,7 @@ public:
 
 	void GetInputFiles( Args & fullArgs, const AString & pre, const AString & post ) const;
 	void GetInputFiles( Array< AString > & files ) const;
+	void GetObjectFiles( Array< AString > & files ) const; // files passed to the linker/librarian
 
 	inline const AString & GetCompilerArgs() const { return m_CompilerArgs; }
 protected:
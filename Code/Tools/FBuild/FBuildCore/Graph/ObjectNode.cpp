@@ -14,6 +14,7 @@
 #include "Tools/FBuild/FBuildCore/Graph/NodeGraph.h"
 #include "Tools/FBuild/FBuildCore/Graph/NodeProxy.h"
 #include "Tools/FBuild/FBuildCore/Helpers/Args.h"
+#include "Tools/FBuild/FBuildCore/Helpers/BuildTrace.h"
 #include "Tools/FBuild/FBuildCore/Helpers/CIncludeParser.h"
 #include "Tools/FBuild/FBuildCore/Helpers/Compressor.h"
 #include "Tools/FBuild/FBuildCore/Helpers/MultiBuffer.h"
@@ -157,7 +158,7 @@ ObjectNode::~ObjectNode()
 	const uint64_t stamp = GetStamp();
 	for ( const Dependency & dep : m_StaticDependencies )
 	{
-		if ( dep.GetNode()->GetStamp() > stamp )
+		if ( dep.GetNode()->GetChangeStamp() > stamp )
 		{
 			m_DynamicDependencies.Clear(); // We will update deps in Finalize after DoBuild
 			return true;
@@ -263,6 +264,16 @@ ObjectNode::~ObjectNode()
 	return true;
 }
 
+// Migrate
+//------------------------------------------------------------------------------
+/*virtual*/ void ObjectNode::Migrate( const Node & oldNode )
+{
+	Node::Migrate( oldNode );
+
+	// cache key of precompiled header used by dependent objects
+	m_PCHCacheKey = oldNode.CastTo< ObjectNode >()->m_PCHCacheKey;
+}
+
 // DoBuildMSCL_NoCache
 //------------------------------------------------------------------------------
 /*virtual*/ Node::BuildResult ObjectNode::DoBuildMSCL_NoCache( Job * job, bool useDeoptimization )
@@ -278,6 +289,7 @@ ObjectNode::~ObjectNode()
 	EmitCompilationMessage( fullArgs, useDeoptimization );
 
 	// spawn the process
+	BuildTrace::Section traceSection( this, BuildTrace::PHASE_COMPILE );
 	CompileHelper ch;
 	if ( !ch.SpawnCompiler( job, GetName(), GetCompiler()->GetName(), fullArgs ) ) // use response file for MSVC
 	{
@@ -322,31 +334,60 @@ ObjectNode::~ObjectNode()
 //------------------------------------------------------------------------------
 Node::BuildResult ObjectNode::DoBuildWithPreProcessor( Job * job, bool useDeoptimization, bool useCache )
 {
-	Args fullArgs;
+	// when caching, the build message is held back until we know the output
+	// won't come from the cache or an identical job (which emit their own)
+	const bool emitMessage = ( useCache == false );
+
+	// a deferred job was already preprocessed (and missed the cache) before waiting
 	const bool showIncludes( false );
-	if ( !BuildArgs( job, fullArgs, PASS_PREPROCESSOR_ONLY, useDeoptimization, showIncludes ) )
-	{
-		return NODE_RESULT_FAILED; // BuildArgs will have emitted an error
-	}
-	if ( BuildPreprocessedOutput( fullArgs, job, useDeoptimization ) == false )
+	Args fullArgs;
+	if ( job->WasDeferred() == false )
 	{
-		return NODE_RESULT_FAILED; // BuildPreprocessedOutput will have emitted an error
-	}
+		if ( !BuildArgs( job, fullArgs, PASS_PREPROCESSOR_ONLY, useDeoptimization, showIncludes ) )
+		{
+			return NODE_RESULT_FAILED; // BuildArgs will have emitted an error
+		}
+		if ( BuildPreprocessedOutput( fullArgs, job, useDeoptimization, emitMessage ) == false )
+		{
+			return NODE_RESULT_FAILED; // BuildPreprocessedOutput will have emitted an error
+		}
 
-	// preprocessed ok, try to extract includes
-	if ( ProcessIncludesWithPreProcessor( job ) == false )
-	{
-		return NODE_RESULT_FAILED; // ProcessIncludesWithPreProcessor will have emitted an error
+		// preprocessed ok, try to extract includes
+		if ( ProcessIncludesWithPreProcessor( job ) == false )
+		{
+			return NODE_RESULT_FAILED; // ProcessIncludesWithPreProcessor will have emitted an error
+		}
+
+		// calculate the cache entry lookup
+		if ( useCache )
+		{
+			// try to get from cache
+			if ( RetrieveFromCache( job ) )
+			{
+				return NODE_RESULT_OK_CACHE;
+			}
+		}
 	}
 
-	// calculate the cache entry lookup
+	// is an identical compilation (same cache key) already in progress?
 	if ( useCache )
 	{
-		// try to get from cache
-		if ( RetrieveFromCache( job ) )
+		const Node * builtBy = nullptr;
+		switch ( JobQueue::Get().RegisterInFlightCompilation( job, GetCacheName( job ), builtBy ) )
 		{
-			return NODE_RESULT_OK_CACHE;
+			case JobQueue::IN_FLIGHT_NONE:		break; // we build it
+			case JobQueue::IN_FLIGHT_BUILDING:	return NODE_RESULT_DEFERRED; // wait for it
+			case JobQueue::IN_FLIGHT_SUCCEEDED:	return CopyFromIdenticalJob( job, builtBy->CastTo< ObjectNode >() );
+			default:							ASSERT( false ); break;
 		}
+
+		// we build it, so show the held back message
+		if ( job->WasDeferred() &&
+			 !BuildArgs( job, fullArgs, PASS_PREPROCESSOR_ONLY, useDeoptimization, showIncludes ) )
+		{
+			return NODE_RESULT_FAILED; // BuildArgs will have emitted an error
+		}
+		EmitCompilationMessage( fullArgs, useDeoptimization, false, false, ( GetDedicatedPreprocessor() != nullptr ) );
 	}
 
 	// can we do the rest of the work remotely?
@@ -582,6 +623,7 @@ Node::BuildResult ObjectNode::DoBuild_QtRCC( Job * job )
 	EmitCompilationMessage( fullArgs, useDeoptimization );
 
 	// spawn the process
+	BuildTrace::Section traceSection( this, BuildTrace::PHASE_COMPILE );
 	CompileHelper ch;
 	if ( !ch.SpawnCompiler( job, GetName(), GetCompiler()->GetName(), fullArgs ) )
 	{
@@ -1050,6 +1092,7 @@ bool ObjectNode::RetrieveFromCache( Job * job )
 	const AString & cacheFileName = GetCacheName(job);
 
 	Timer t;
+	BuildTrace::Section traceSection( this, BuildTrace::PHASE_CACHE_RETRIEVE );
 
 	ICache * cache = FBuild::Get().GetCache();
 	ASSERT( cache );
@@ -1059,6 +1102,8 @@ bool ObjectNode::RetrieveFromCache( Job * job )
 		size_t cacheDataSize( 0 );
 		if ( cache->Retrieve( cacheFileName, cacheData, cacheDataSize ) )
 		{
+			traceSection.SetBytes( cacheDataSize );
+
 			// do decompression
 			Compressor c;
 			if ( c.IsValidData( cacheData, cacheDataSize ) == false )
@@ -1161,6 +1206,7 @@ void ObjectNode::WriteToCache( Job * job )
 	ASSERT(!cacheFileName.IsEmpty());
 
 	Timer t;
+	BuildTrace::Section traceSection( this, BuildTrace::PHASE_CACHE_STORE );
 
 	ICache * cache = FBuild::Get().GetCache();
 	ASSERT( cache );
@@ -1183,6 +1229,7 @@ void ObjectNode::WriteToCache( Job * job )
 			c.Compress( buffer.GetData(), (size_t)buffer.GetDataSize() );
 			const void * data = c.GetResult();
 			const size_t dataSize = c.GetResultSize();
+			traceSection.SetBytes( dataSize );
 
 			if ( cache->Publish( cacheFileName, data, dataSize ) )
 			{
@@ -1221,6 +1268,52 @@ bool ObjectNode::GetExtraCacheFilePath( const Job * job, AString & extraFileName
 	return false;
 }
 
+// CopyFromIdenticalJob
+//------------------------------------------------------------------------------
+Node::BuildResult ObjectNode::CopyFromIdenticalJob( Job * job, const ObjectNode * builtBy )
+{
+	ASSERT( builtBy != this );
+
+	Timer t;
+
+	bool copied = FileIO::FileCopy( builtBy->GetName().Get(), m_Name.Get() );
+
+	AStackString<> extraFile;
+	if ( copied && GetExtraCacheFilePath( job, extraFile ) )
+	{
+		copied = FileIO::FileCopy( builtBy->m_PCHObjectFileName.Get(), extraFile.Get() );
+	}
+
+	if ( copied == false )
+	{
+		// output of identical job may have been written to the cache instead
+		if ( RetrieveFromCache( job ) )
+		{
+			return NODE_RESULT_OK_CACHE;
+		}
+
+		FLOG_ERROR( "Failed to copy output of identical job '%s' to '%s'", builtBy->GetName().Get(), m_Name.Get() );
+		return NODE_RESULT_FAILED;
+	}
+
+	FileIO::WorkAroundForWindowsFilePermissionProblem( m_Name );
+	m_Stamp = FileIO::GetFileLastWriteTime( m_Name );
+
+	FLOG_INFO( "Deduplicated: %u ms '%s' (from '%s')\n", uint32_t( t.GetElapsedMS() ), m_Name.Get(), builtBy->GetName().Get() );
+	FLOG_BUILD( "Obj: %s <DEDUPLICATED>\n", GetName().Get() );
+	SetStatFlag( Node::STATS_DEDUPLICATED );
+
+	// Dependent objects need to know the PCH key to be able to pull from the cache
+	// (only set if the identical job stored the PCH to the cache)
+	if ( GetFlag( FLAG_CREATING_PCH ) )
+	{
+		m_PCHCacheKey = builtBy->m_PCHCacheKey;
+	}
+
+	// timed like a cache retrieval, as no compilation was done
+	return NODE_RESULT_OK_CACHE;
+}
+
 // EmitCompilationMessage
 //------------------------------------------------------------------------------
 void ObjectNode::EmitCompilationMessage( const Args & fullArgs, bool useDeoptimization, bool stealingRemoteJob, bool racingRemoteJob, bool useDedicatedPreprocessor, bool isRemote ) const
@@ -1607,12 +1700,16 @@ void ObjectNode::ExpandTokenList( const Dependencies & nodes, Args & fullArgs, c
 
 // BuildPreprocessedOutput
 //------------------------------------------------------------------------------
-bool ObjectNode::BuildPreprocessedOutput( const Args & fullArgs, Job * job, bool useDeoptimization ) const
+bool ObjectNode::BuildPreprocessedOutput( const Args & fullArgs, Job * job, bool useDeoptimization, bool emitMessage ) const
 {
 	const bool useDedicatedPreprocessor = ( GetDedicatedPreprocessor() != nullptr );
-	EmitCompilationMessage( fullArgs, useDeoptimization, false, false, useDedicatedPreprocessor );
+	if ( emitMessage )
+	{
+		EmitCompilationMessage( fullArgs, useDeoptimization, false, false, useDedicatedPreprocessor );
+	}
 
 	// spawn the process
+	BuildTrace::Section traceSection( this, BuildTrace::PHASE_PREPROCESS );
 	CompileHelper ch( false ); // don't handle output (we'll do that)
     // TODO:A Add checks in BuildArgs for length of dedicated preprocessor
 	if ( !ch.SpawnCompiler( job, GetName(),
@@ -1632,6 +1729,7 @@ bool ObjectNode::BuildPreprocessedOutput( const Args & fullArgs, Job * job, bool
 
 	// take a copy of the output because ReadAllData uses huge buffers to avoid re-sizing
     TransferPreprocessedData( ch.GetOut().Get(), ch.GetOutSize(), job );
+	traceSection.SetBytes( ch.GetOutSize() );
 
 	return true;
 }
@@ -1824,6 +1922,7 @@ bool ObjectNode::BuildFinalOutput( Job * job, const Args & fullArgs ) const
 	}
 
 	// spawn the process
+	BuildTrace::Section traceSection( this, BuildTrace::PHASE_COMPILE );
 	CompileHelper ch;
 	if ( !ch.SpawnCompiler( job, GetName(), compiler, fullArgs, workingDir.IsEmpty() ? nullptr : workingDir.Get() ) )
 	{
@@ -99,6 +99,7 @@ private:
 	virtual BuildResult DoBuild( Job * job ) override;
 	virtual BuildResult DoBuild2( Job * job, bool racingRemoteJob ) override;
 	virtual bool Finalize( NodeGraph & nodeGraph ) override;
+	virtual void Migrate( const Node & oldNode ) override;
 
 	BuildResult DoBuildMSCL_NoCache( Job * job, bool useDeoptimization );
 	BuildResult DoBuildWithPreProcessor( Job * job, bool useDeoptimization, bool useCache );
@@ -113,6 +114,7 @@ private:
 	bool RetrieveFromCache( Job * job );
 	void WriteToCache( Job * job );
 	bool GetExtraCacheFilePath( const Job * job, AString & extraFileName ) const;
+	BuildResult CopyFromIdenticalJob( Job * job, const ObjectNode * builtBy );
 
 	void HandleWarningsMSCL( Job* job, const char * data, uint32_t dataSize ) const;
 
@@ -131,7 +133,7 @@ private:
 	bool BuildArgs( const Job * job, Args & fullArgs, Pass pass, bool useDeoptimization, bool useShowIncludes, const AString & overrideSrcFile = AString::GetEmpty() ) const;
 
 	void ExpandTokenList( const Dependencies & nodes, Args & fullArgs, const AString & pre, const AString & post ) const;
-	bool BuildPreprocessedOutput( const Args & fullArgs, Job * job, bool useDeoptimization ) const;
+	bool BuildPreprocessedOutput( const Args & fullArgs, Job * job, bool useDeoptimization, bool emitMessage ) const;
 	void TransferPreprocessedData( const char * data, size_t dataSize, Job * job ) const;
 	bool WriteTmpFile( Job * job, AString & tmpDirectory, AString & tmpFileName ) const;
 	bool BuildFinalOutput( Job * job, const Args & fullArgs ) const;
@@ -7,6 +7,7 @@
 
 #include "TestNode.h"
 
+#include "Tools/FBuild/FBuildCore/Cache/OutputCache.h"
 #include "Tools/FBuild/FBuildCore/FBuild.h"
 #include "Tools/FBuild/FBuildCore/FLog.h"
 #include "Tools/FBuild/FBuildCore/Graph/NodeGraph.h"
@@ -25,6 +26,7 @@ REFLECT_BEGIN( TestNode, Node, MetaName( "TestOutput" ) + MetaFile() )
 	REFLECT( m_TestArguments,		"TestArguments",		MetaOptional() )
 	REFLECT( m_TestWorkingDir,		"TestWorkingDir",		MetaOptional() + MetaPath() )
 	REFLECT( m_TestTimeOut,			"TestTimeOut",			MetaOptional() + MetaRange( 0, 4 * 60 * 60 ) ) // 4hrs
+	REFLECT( m_TestCacheable,		"TestCacheable",		MetaOptional() )
 REFLECT_END( TestNode )
 
 // CONSTRUCTOR
@@ -35,6 +37,7 @@ TestNode::TestNode()
 	, m_TestArguments()
 	, m_TestWorkingDir()
 	, m_TestTimeOut( 0 )
+	, m_TestCacheable( false )
 {
 	m_Type = Node::TEST_NODE;
 }
@@ -62,6 +65,23 @@ TestNode::~TestNode()
 //------------------------------------------------------------------------------
 /*virtual*/ Node::BuildResult TestNode::DoBuild( Job * job )
 {
+	// try to retrieve test output from the cache (only passing tests are stored)
+	AStackString<> cacheName;
+	const bool useCache = m_TestCacheable &&
+						  ( OutputCache::IsReadEnabled() || OutputCache::IsWriteEnabled() ) &&
+						  GetCacheName( cacheName );
+	Array< AString > outputFiles( 1, false );
+	outputFiles.Append( m_Name );
+	if ( useCache && OutputCache::IsReadEnabled() )
+	{
+		if ( OutputCache::Retrieve( this, cacheName, outputFiles ) )
+		{
+			m_Stamp = FileIO::GetFileLastWriteTime( m_Name );
+			FLOG_BUILD( "Running Test: %s <CACHE>\n", GetName().Get() );
+			return NODE_RESULT_OK_CACHE;
+		}
+	}
+
 	// If the workingDir is empty, use the current dir for the process
 	const char * workingDir = m_TestWorkingDir.IsEmpty() ? nullptr : m_TestWorkingDir.Get();
 
@@ -125,11 +145,37 @@ TestNode::~TestNode()
 	}
 
 	// test passed 
+	if ( useCache && OutputCache::IsWriteEnabled() )
+	{
+		OutputCache::Store( this, cacheName, outputFiles );
+	}
+
 	// we only keep the "last modified" time of the test output for passed tests
 	m_Stamp = FileIO::GetFileLastWriteTime( m_Name );
 	return NODE_RESULT_OK;
 }
 
+// GetCacheName
+//------------------------------------------------------------------------------
+bool TestNode::GetCacheName( AString & cacheName ) const
+{
+	OutputCache::Key key;
+	AStackString<> workingDir;
+	key.AddWorkingDir( m_TestWorkingDir, workingDir );
+	key.AddString( m_TestArguments );
+	key.AddPath( m_Name, workingDir );
+
+	const AString & testExe = GetTestExecutable()->GetName();
+	if ( key.SetTool( testExe ) == false )
+	{
+		FLOG_INFO( "Caching disabled for '%s' - can't read executable '%s'\n", GetName().Get(), testExe.Get() );
+		return false;
+	}
+
+	key.GetCacheName( cacheName );
+	return true;
+}
+
 // EmitCompilationMessage
 //------------------------------------------------------------------------------
 void TestNode::EmitCompilationMessage( const char * workingDir ) const
@@ -34,10 +34,13 @@ private:
 
 	void EmitCompilationMessage( const char * workingDir ) const;
 
+	bool GetCacheName( AString & cacheName ) const;
+
 	AString		m_TestExecutable;
 	AString		m_TestArguments;
 	AString		m_TestWorkingDir;
 	uint32_t	m_TestTimeOut;
+	bool		m_TestCacheable;
 };
 
 //------------------------------------------------------------------------------
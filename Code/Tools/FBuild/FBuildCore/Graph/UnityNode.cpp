@@ -19,9 +19,21 @@
 #include "Core/FileIO/FileIO.h"
 #include "Core/FileIO/FileStream.h"
 #include "Core/FileIO/PathUtils.h"
+#include "Core/Math/Conversions.h"
 #include "Core/Process/Process.h"
 #include "Core/Strings/AStackString.h"
 
+// FileAndOriginComp
+//------------------------------------------------------------------------------
+struct FileAndOriginComp
+{
+	bool operator ()( const UnityNode::FileAndOrigin & a, const UnityNode::FileAndOrigin & b ) const
+	{
+		// case-insensitive so order is the same on all platforms
+		return ( a.GetName().CompareI( b.GetName() ) < 0 );
+	}
+};
+
 // Reflection
 //------------------------------------------------------------------------------
 REFLECT_BEGIN( UnityNode, Node, MetaNone() )
@@ -38,6 +50,7 @@ REFLECT_BEGIN( UnityNode, Node, MetaNone() )
 	REFLECT( m_NumUnityFilesToCreate,	"UnityNumFiles",						MetaOptional() + MetaRange( 1, 1048576 ) )
 	REFLECT( m_MaxIsolatedFiles,		"UnityInputIsolateWritableFilesLimit",	MetaOptional() + MetaRange( 0, 1048576 ) )
 	REFLECT( m_IsolateWritableFiles,	"UnityInputIsolateWritableFiles",		MetaOptional() )
+	REFLECT( m_IsolateChangedFiles,		"UnityInputIsolateChangedFiles",		MetaOptional() )
 	REFLECT( m_PrecompiledHeader,		"UnityPCH",								MetaOptional() + MetaFile( true ) ) // relative
 	REFLECT_ARRAY( m_PreBuildDependencyNames,	"PreBuildDependencies",			MetaOptional() + MetaFile() )
 REFLECT_END( UnityNode )
@@ -56,10 +69,12 @@ UnityNode::UnityNode()
 , m_PathsToExclude( 0, true )
 , m_FilesToExclude( 0, true )
 , m_IsolateWritableFiles( false )
+, m_IsolateChangedFiles( false )
 , m_MaxIsolatedFiles( 0 )
 , m_ExcludePatterns( 0, true )
 , m_IsolatedFiles( 0, true )
 , m_UnityFileNames( 0, true )
+, m_FileHistory( 0, true )
 {
 	m_InputPattern.Append( AStackString<>( "*.cpp" ) );
 	m_LastBuildTimeMs = 100; // higher default than a file node
@@ -145,12 +160,32 @@ UnityNode::~UnityNode()
         return NODE_RESULT_FAILED; // GetFiles will have emitted an error
     }
 
-    // TODO:A Sort files for consistent ordering across file systems/platforms
-    
-	// how many files should go in each unity file?
+	// sort files for consistent ordering across file systems/platforms
+	files.Sort( FileAndOriginComp() );
+
+	// which files should go in each unity file?
 	const size_t numFiles = files.GetSize();
-	float numFilesPerUnity = (float)numFiles / m_NumUnityFilesToCreate;
-	float remainingInThisUnity( 0.0 );
+	Array< uint32_t > unityEnds( m_NumUnityFilesToCreate, false );
+	PartitionFiles( files, m_NumUnityFilesToCreate, unityEnds );
+
+	// files which are being modified can optionally be excluded from the unity,
+	// either because they are writable, or because they changed recently
+	Array< bool > recentlyChanged( numFiles, false );
+	if ( m_IsolateChangedFiles )
+	{
+		UpdateFileHistory( files, recentlyChanged );
+	}
+	else
+	{
+		m_FileHistory.Clear();
+	}
+	Array< bool > isolationCandidates( numFiles, false );
+	for ( size_t i = 0; i < numFiles; ++i )
+	{
+		const bool writable = ( m_IsolateWritableFiles && ( files[ i ].IsReadOnly() == false ) );
+		const bool changed = ( m_IsolateChangedFiles && recentlyChanged[ i ] );
+		isolationCandidates.Append( writable || changed );
+	}
 
 	uint32_t numFilesWritten( 0 );
 
@@ -162,9 +197,6 @@ UnityNode::~UnityNode()
 	// create each unity file
 	for ( size_t i=0; i<m_NumUnityFilesToCreate; ++i )
 	{
-		// add allocation to this unity
-		remainingInThisUnity += numFilesPerUnity;
-
 		// header
 		output = "// Auto-generated Unity file - do not modify\r\n\r\n";
 		
@@ -176,33 +208,16 @@ UnityNode::~UnityNode()
 			output += "\"\r\n\r\n";
 		}
 
-		// make sure any remaining files are added to the last unity to account
-		// for floating point imprecision
-
 		// determine allocation of includes for this unity file
-		Array< FileAndOrigin > filesInThisUnity( 256, true );
 		uint32_t numIsolated( 0 );
-		const bool lastUnity = ( i == ( m_NumUnityFilesToCreate - 1 ) );
-		while ( ( remainingInThisUnity > 0.0f ) || lastUnity )
+		const size_t unityStart = index;
+		const size_t unityEnd = unityEnds[ i ];
+		while ( index < unityEnd )
 		{
-			remainingInThisUnity -= 1.0f; // reduce allocation, but leave rounding
-
-			// handle cases where there's more unity files than source files
-			if ( index >= numFiles )
-			{
-				break;
-			}
-
-			filesInThisUnity.Append( files[index ] );
-
-			// files which are modified (writable) can optionally be excluded from the unity
-			if ( m_IsolateWritableFiles )
+			// files which are modified can optionally be excluded from the unity
+			if ( isolationCandidates[ index ] )
 			{
-				// is the file writable?
-				if ( files[ index ].IsReadOnly() == false )
-				{
-					numIsolated++;
-				}
+				numIsolated++;
 			}
 
 			// count the file, whether we wrote it or not, to keep unity files stable
@@ -211,10 +226,11 @@ UnityNode::~UnityNode()
 		}
 
 		// write allocation of includes for this unity file
-		const FileAndOrigin * const end = filesInThisUnity.End();
         size_t numFilesActuallyIsolatedInThisUnity( 0 );
-		for ( const FileAndOrigin * file = filesInThisUnity.Begin(); file != end; ++file )
+		for ( size_t fileIndex = unityStart; fileIndex < unityEnd; ++fileIndex )
 		{
+			const FileAndOrigin * file = &files[ fileIndex ];
+
 			// write pragma showing cpp file being compiled to assist resolving compilation errors
 			AStackString<> buffer( file->GetName().Get() );
 			buffer.Replace( BACK_SLASH, FORWARD_SLASH ); // avoid problems with slashes in generated code
@@ -225,11 +241,11 @@ UnityNode::~UnityNode()
 			output += buffer;
 			output += "\" )\r\n";
 
-			// files which are modified (writable) can optionally be excluded from the unity
-			if ( m_IsolateWritableFiles && ( ( m_MaxIsolatedFiles == 0 ) || ( numIsolated <= m_MaxIsolatedFiles ) ) )
+			// files which are modified can optionally be excluded from the unity
+			if ( ( m_MaxIsolatedFiles == 0 ) || ( numIsolated <= m_MaxIsolatedFiles ) )
 			{
-				// is the file writable?
-				if ( file->IsReadOnly() == false )
+				// is the file being modified?
+				if ( isolationCandidates[ fileIndex ] )
 				{
 					// disable compilation of this file (comment it out)
 					output += "//";
@@ -255,7 +271,7 @@ UnityNode::~UnityNode()
 		}
 
 		// only keep track of non-empty unity files (to avoid link errors with empty objects)
-        if ( filesInThisUnity.GetSize() != numFilesActuallyIsolatedInThisUnity )
+        if ( ( unityEnd - unityStart ) != numFilesActuallyIsolatedInThisUnity )
         {
 			m_UnityFileNames.Append( unityName );
         }
@@ -338,6 +354,70 @@ UnityNode::~UnityNode()
 	return NODE_RESULT_OK;
 }
 
+// GetFileCost
+//------------------------------------------------------------------------------
+/*static*/ uint32_t UnityNode::GetFileCost( const FileAndOrigin & file )
+{
+	// Cost is estimated from the size of the file (in KiB), plus a fixed amount
+	// for the work every file incurs (mostly processing included headers). Files
+	// from ObjectLists have no size, so are balanced by count.
+	uint64_t sizeKiB = ( file.GetSize() + 1023 ) / 1024;
+	sizeKiB = Math::Min< uint64_t >( sizeKiB, 1024 * 1024 );
+
+	// keep only the 3 most significant bits, so small edits don't change the
+	// cost, and therefore don't move files between unities
+	uint32_t shift = 0;
+	while ( ( sizeKiB >> shift ) >= 8 )
+	{
+		++shift;
+	}
+	sizeKiB = ( sizeKiB >> shift ) << shift;
+
+	return ( FILE_COST_OVERHEAD_KIB + (uint32_t)sizeKiB );
+}
+
+// PartitionFiles
+//------------------------------------------------------------------------------
+/*static*/ void UnityNode::PartitionFiles( const Array< FileAndOrigin > & files, uint32_t numUnityFiles, Array< uint32_t > & unityEnds )
+{
+	const size_t numFiles = files.GetSize();
+
+	Array< uint32_t > costs( numFiles, false );
+	uint64_t totalCost = 0;
+	for ( const FileAndOrigin & file : files )
+	{
+		const uint32_t cost = GetFileCost( file );
+		costs.Append( cost );
+		totalCost += cost;
+	}
+
+	// Each unity takes a contiguous range of files. A file is added to a unity
+	// if the middle of its cost falls within that unity's share of the total.
+	// Every unity takes at least one file (while there are files remaining), so
+	// a very expensive file doesn't leave empty unities behind it.
+	uint64_t costSoFar = 0;
+	size_t index = 0;
+	for ( uint32_t i = 0; i < numUnityFiles; ++i )
+	{
+		const bool lastUnity = ( i == ( numUnityFiles - 1 ) );
+		const uint64_t unityEndCost = ( totalCost * ( i + 1 ) ) / numUnityFiles;
+		const size_t unityStart = index;
+		while ( index < numFiles )
+		{
+			const uint64_t cost = costs[ index ];
+			const bool beyondShare = ( ( ( costSoFar * 2 ) + cost ) > ( unityEndCost * 2 ) );
+			if ( beyondShare && !lastUnity && ( index > unityStart ) )
+			{
+				break;
+			}
+			costSoFar += cost;
+			++index;
+		}
+		unityEnds.Append( (uint32_t)index );
+	}
+	ASSERT( index == numFiles );
+}
+
 // Load
 //------------------------------------------------------------------------------
 /*static*/ Node * UnityNode::Load( NodeGraph & nodeGraph, IOStream & stream )
@@ -351,6 +431,19 @@ UnityNode::~UnityNode()
 		return nullptr;
 	}
 
+	NODE_LOAD( uint32_t, numFileHistory );
+	un->m_FileHistory.SetSize( numFileHistory );
+	for ( FileHistory & history : un->m_FileHistory )
+	{
+		if ( ( stream.Read( history.m_Name ) == false ) ||
+			 ( stream.Read( history.m_Stamp ) == false ) ||
+			 ( stream.Read( history.m_Hash ) == false ) ||
+			 ( stream.Read( history.m_BuildsSinceChange ) == false ) )
+		{
+			return nullptr;
+		}
+	}
+
 	return un;
 }
 
@@ -360,6 +453,90 @@ UnityNode::~UnityNode()
 {
 	NODE_SAVE( m_Name );
 	Node::Serialize( stream );
+
+	NODE_SAVE( (uint32_t)m_FileHistory.GetSize() );
+	for ( const FileHistory & history : m_FileHistory )
+	{
+		NODE_SAVE( history.m_Name );
+		NODE_SAVE( history.m_Stamp );
+		NODE_SAVE( history.m_Hash );
+		NODE_SAVE( history.m_BuildsSinceChange );
+	}
+}
+
+// Migrate
+//------------------------------------------------------------------------------
+/*virtual*/ void UnityNode::Migrate( const Node & oldNode )
+{
+	Node::Migrate( oldNode );
+
+	// keep tracking recently changed files
+	m_FileHistory = oldNode.CastTo< UnityNode >()->m_FileHistory;
+}
+
+// UpdateFileHistory
+//------------------------------------------------------------------------------
+void UnityNode::UpdateFileHistory( const Array< FileAndOrigin > & files, Array< bool > & recentlyChanged )
+{
+	// both the files and the history are sorted, so can be compared in one pass
+	Array< FileHistory > oldHistory( 0, true );
+	oldHistory.Swap( m_FileHistory );
+	m_FileHistory.SetCapacity( files.GetSize() );
+
+	const FileHistory * oldIt = oldHistory.Begin();
+	const FileHistory * const oldEnd = oldHistory.End();
+	for ( const FileAndOrigin & file : files )
+	{
+		// skip history of files no longer in the unity
+		while ( ( oldIt != oldEnd ) && ( oldIt->m_Name.CompareI( file.GetName() ) < 0 ) )
+		{
+			++oldIt;
+		}
+		const FileHistory * old = ( ( oldIt != oldEnd ) && ( oldIt->m_Name.CompareI( file.GetName() ) == 0 ) ) ? oldIt : nullptr;
+
+		// files from ObjectLists have no time stamp, so are never isolated
+		const uint64_t stamp = file.GetLastWriteTime();
+		if ( stamp == 0 )
+		{
+			recentlyChanged.Append( false );
+			continue;
+		}
+
+		m_FileHistory.SetSize( m_FileHistory.GetSize() + 1 );
+		FileHistory & history = m_FileHistory.Top();
+		history.m_Name = file.GetName();
+		history.m_Stamp = stamp;
+		if ( old == nullptr )
+		{
+			// files not seen before (including all files the first time) have
+			// nothing to be compared with, so are not isolated
+			history.m_Hash = 0;
+			HashFileContents( file.GetName(), history.m_Hash );
+			history.m_BuildsSinceChange = CHANGED_FILE_ISOLATION_BUILDS;
+		}
+		else if ( old->m_Stamp == stamp )
+		{
+			// contents are only checked when the time stamp changes
+			history.m_Hash = old->m_Hash;
+			history.m_BuildsSinceChange = old->m_BuildsSinceChange;
+		}
+		else
+		{
+			// time stamp changed, but contents may not have (e.g. switching branches)
+			history.m_Hash = 0;
+			HashFileContents( file.GetName(), history.m_Hash );
+			history.m_BuildsSinceChange = ( history.m_Hash == old->m_Hash ) ? old->m_BuildsSinceChange : 0;
+		}
+
+		// changed files are isolated in the build which sees the change, and
+		// stay isolated for the following builds (CHANGED_FILE_ISOLATION_BUILDS in total)
+		const bool changed = ( history.m_BuildsSinceChange < CHANGED_FILE_ISOLATION_BUILDS );
+		recentlyChanged.Append( changed );
+		if ( changed )
+		{
+			++history.m_BuildsSinceChange;
+		}
+	}
 }
 
 // GetFiles
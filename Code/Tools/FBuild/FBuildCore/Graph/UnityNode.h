@@ -44,6 +44,8 @@ public:
 
         inline const AString &              GetName() const             { return m_Info->m_Name; }
         inline bool                         IsReadOnly() const          { return m_Info->IsReadOnly(); }
+        inline uint64_t                     GetSize() const             { return m_Info->m_Size; }
+        inline uint64_t                     GetLastWriteTime() const    { return m_Info->m_LastWriteTime; }
         inline const DirectoryListNode *    GetDirListOrigin() const    { return m_DirListOrigin; }
 
     protected:
@@ -59,8 +61,15 @@ private:
 
 	virtual bool IsAFile() const override { return false; }
 
+	virtual void Migrate( const Node & oldNode ) override;
+
 	bool GetFiles( Array< FileAndOrigin > & files );
 
+	// split the (sorted) files into unities of similar estimated compile cost
+	static uint32_t GetFileCost( const FileAndOrigin & file );
+	static void		PartitionFiles( const Array< FileAndOrigin > & files, uint32_t numUnityFiles, Array< uint32_t > & unityEnds );
+	enum : uint32_t { FILE_COST_OVERHEAD_KIB = 8 }; // fixed cost of each file, as an equivalent size
+
 	// Exposed properties
 	Array< AString > m_InputPaths;
 	bool m_InputPathRecurse;
@@ -74,6 +83,7 @@ private:
 	Array< AString > m_PathsToExclude;
 	Array< AString > m_FilesToExclude;
 	bool m_IsolateWritableFiles;
+	bool m_IsolateChangedFiles;
 	uint32_t m_MaxIsolatedFiles;
 	Array< AString > m_ExcludePatterns;
 	Array< FileAndOrigin > m_IsolatedFiles;
@@ -82,6 +92,18 @@ private:
 	// Temporary data
 	Array< AString > m_UnityFileNames;
 	Array< FileIO::FileInfo* > m_FilesInfo;
+
+	// Input files seen in previous builds, to isolate recently changed files
+	struct FileHistory
+	{
+		AString		m_Name;
+		uint64_t	m_Stamp;
+		uint64_t	m_Hash;					// of file contents
+		uint32_t	m_BuildsSinceChange;
+	};
+	void UpdateFileHistory( const Array< FileAndOrigin > & files, Array< bool > & recentlyChanged );
+	enum : uint32_t { CHANGED_FILE_ISOLATION_BUILDS = 3 }; // builds a changed file is isolated for (including the one which sees the change)
+	Array< FileHistory > m_FileHistory;
 };
 
 //------------------------------------------------------------------------------
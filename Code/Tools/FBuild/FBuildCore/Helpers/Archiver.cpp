@@ -0,0 +1,703 @@
+// Archiver - create static libraries (GNU ar format) in-process
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Tools/FBuild/FBuildCore/PrecompiledHeader.h"
+
+#include "Archiver.h"
+
+// FBuild
+#include "Tools/FBuild/FBuildCore/FLog.h"
+
+// Core
+#include "Core/Containers/AutoPtr.h"
+#include "Core/FileIO/FileIO.h"
+#include "Core/Mem/Mem.h"
+#include "Core/Profile/Profile.h"
+#include "Core/Strings/AStackString.h"
+
+// system
+#include <string.h>
+
+// ELF
+//------------------------------------------------------------------------------
+#define ELF_CLASS_32		( 1 )
+#define ELF_CLASS_64		( 2 )
+#define ELF_DATA_LSB		( 1 )
+#define ELF_DATA_MSB		( 2 )
+#define ELF_TYPE_REL		( 1 )
+#define ELF_SHT_SYMTAB		( 2 )
+#define ELF_SHN_UNDEF		( 0 )
+#define ELF_SHN_XINDEX		( 0xFFFF )
+#define ELF_STB_GLOBAL		( 1 )
+#define ELF_STB_WEAK		( 2 )
+#define ELF_STB_GNU_UNIQUE	( 10 )
+
+// CONSTRUCTOR
+//------------------------------------------------------------------------------
+Archiver::Archiver()
+	: m_Members( 0, true )
+	, m_SymbolNames( 64 * 1024 )
+	, m_NumSymbols( 0 )
+	, m_NumMembersReused( 0 )
+	, m_OldMembers( 0, true )
+	, m_OldSymbolTable( nullptr )
+{
+}
+
+// DESTRUCTOR
+//------------------------------------------------------------------------------
+Archiver::~Archiver()
+{
+	FREE( m_OldSymbolTable );
+}
+
+// Create
+//------------------------------------------------------------------------------
+Archiver::Result Archiver::Create( const AString & archiveName, const Array< AString > & inputFiles, uint64_t previousStamp )
+{
+	PROFILE_FUNCTION
+
+	// the previous archive can only be re-used if it's the one we wrote
+	const bool reuseOldArchive = ( previousStamp != 0 ) &&
+								 ( FileIO::GetFileLastWriteTime( archiveName ) == previousStamp ) &&
+								 ReadOldArchive( archiveName );
+
+	m_Members.SetCapacity( inputFiles.GetSize() );
+	for ( size_t i = 0; i < inputFiles.GetSize(); ++i )
+	{
+		const OldMember * oldMember = ( reuseOldArchive && ( i < m_OldMembers.GetSize() ) ) ? &m_OldMembers[ i ] : nullptr;
+		const Result result = AddMember( inputFiles[ i ], oldMember, previousStamp );
+		if ( result != ARCHIVE_OK )
+		{
+			return result;
+		}
+	}
+
+	// write to a temp file, so the archive is never left partially written
+	AStackString<> tmpFileName( archiveName );
+	tmpFileName += ".tmp";
+	const bool writeOK = WriteArchive( tmpFileName );
+	if ( m_OldArchive.IsOpen() )
+	{
+		m_OldArchive.Close(); // must be closed before it can be replaced
+	}
+	if ( writeOK == false )
+	{
+		FileIO::FileDelete( tmpFileName.Get() );
+		return ARCHIVE_FAILED; // WriteArchive will have emitted an error
+	}
+
+	if ( FileIO::FileMove( tmpFileName, archiveName ) == false )
+	{
+		FLOG_ERROR( "Failed to replace archive '%s'", archiveName.Get() );
+		FileIO::FileDelete( tmpFileName.Get() );
+		return ARCHIVE_FAILED;
+	}
+
+	return ARCHIVE_OK;
+}
+
+// AddMember
+//------------------------------------------------------------------------------
+Archiver::Result Archiver::AddMember( const AString & fileName, const OldMember * oldMember, uint64_t previousStamp )
+{
+	FileIO::FileInfo info;
+	if ( FileIO::GetFileInfo( fileName, info ) == false )
+	{
+		FLOG_ERROR( "Failed to open input '%s' for archive", fileName.Get() );
+		return ARCHIVE_FAILED;
+	}
+
+	Member member;
+	member.m_OldDataOffset = 0;
+	member.m_HeaderOffset = 0;
+	member.m_NameTableOffset = NO_NAME_TABLE_OFFSET;
+	member.m_NumSymbols = 0;
+
+	// members are named after the file (without the path)
+	const char * slash = fileName.FindLast( '/' );
+	const char * backSlash = fileName.FindLast( '\\' );
+	const char * lastSlash = ( backSlash > slash ) ? backSlash : slash;
+	member.m_MemberName = lastSlash ? ( lastSlash + 1 ) : fileName.Get();
+
+	// re-use member from the previous archive?
+	if ( oldMember &&
+		 ( oldMember->m_MemberName == member.m_MemberName ) &&
+		 ( oldMember->m_Size == info.m_Size ) &&
+		 ( info.m_LastWriteTime < previousStamp ) )
+	{
+		member.m_Size = oldMember->m_Size;
+		member.m_OldDataOffset = oldMember->m_DataOffset;
+		member.m_NumSymbols = oldMember->m_NumSymbols;
+		m_SymbolNames.WriteBuffer( oldMember->m_SymbolNames, oldMember->m_SymbolNamesSize );
+		++m_NumMembersReused;
+	}
+	else
+	{
+		FileStream f;
+		if ( f.Open( fileName.Get(), FileStream::READ_ONLY ) == false )
+		{
+			FLOG_ERROR( "Failed to open input '%s' for archive", fileName.Get() );
+			return ARCHIVE_FAILED;
+		}
+		member.m_FileName = fileName;
+		member.m_Size = f.GetFileSize();
+		const Result result = ReadSymbols( f, fileName, member.m_NumSymbols );
+		if ( result != ARCHIVE_OK )
+		{
+			return result;
+		}
+	}
+
+	m_NumSymbols += member.m_NumSymbols;
+	m_Members.Append( member );
+	return ARCHIVE_OK;
+}
+
+// ReadSymbols
+//------------------------------------------------------------------------------
+Archiver::Result Archiver::ReadSymbols( FileStream & f, const AString & fileName, uint32_t & numSymbols )
+{
+	// ELF header (ELF32 headers are smaller, but objects never are)
+	uint8_t header[ 64 ];
+	const uint64_t fileSize = f.GetFileSize();
+	if ( ( fileSize < sizeof( header ) ) ||
+		 ( f.ReadBuffer( header, sizeof( header ) ) != sizeof( header ) ) ||
+		 ( memcmp( header, "\177ELF", 4 ) != 0 ) ||
+		 ( ( header[ 4 ] != ELF_CLASS_32 ) && ( header[ 4 ] != ELF_CLASS_64 ) ) ||
+		 ( ( header[ 5 ] != ELF_DATA_LSB ) && ( header[ 5 ] != ELF_DATA_MSB ) ) )
+	{
+		FLOG_INFO( "Archiver: '%s' is not an ELF object\n", fileName.Get() );
+		return ARCHIVE_UNSUPPORTED;
+	}
+	const bool is64 = ( header[ 4 ] == ELF_CLASS_64 );
+	const bool bigEndian = ( header[ 5 ] == ELF_DATA_MSB );
+	const uint32_t addrSize = is64 ? 8 : 4;
+	if ( ReadUInt( header + 16, 2, bigEndian ) != ELF_TYPE_REL )
+	{
+		FLOG_INFO( "Archiver: '%s' is not a relocatable ELF object\n", fileName.Get() );
+		return ARCHIVE_UNSUPPORTED;
+	}
+
+	// section headers
+	const uint8_t * shFields = header + 24 + ( 3 * addrSize ) + 6; // after e_entry, e_phoff, e_shoff, e_flags, e_ehsize
+	const uint64_t shOffset = ReadUInt( header + 24 + ( 2 * addrSize ), addrSize, bigEndian );
+	const uint32_t shEntSize = (uint32_t)ReadUInt( shFields + 4, 2, bigEndian );
+	uint64_t shNum = ReadUInt( shFields + 6, 2, bigEndian );
+	uint64_t shStrIndex = ReadUInt( shFields + 8, 2, bigEndian );
+	numSymbols = 0;
+	if ( shOffset == 0 )
+	{
+		return ARCHIVE_OK; // no sections
+	}
+	const uint32_t minShEntSize = is64 ? 64 : 40;
+	if ( ( shEntSize < minShEntSize ) || ( shOffset + shEntSize > fileSize ) )
+	{
+		FLOG_ERROR( "Corrupt section headers in '%s'", fileName.Get() );
+		return ARCHIVE_FAILED;
+	}
+
+	// large section counts are stored in the first section header
+	if ( ( shNum == 0 ) || ( shStrIndex == ELF_SHN_XINDEX ) )
+	{
+		uint8_t sh0[ 64 ];
+		VERIFY( f.Seek( shOffset ) );
+		if ( f.ReadBuffer( sh0, minShEntSize ) != minShEntSize )
+		{
+			FLOG_ERROR( "Corrupt section headers in '%s'", fileName.Get() );
+			return ARCHIVE_FAILED;
+		}
+		Section section0;
+		GetSection( sh0, is64, bigEndian, section0 );
+		shNum = ( shNum == 0 ) ? section0.m_Size : shNum;
+		shStrIndex = ( shStrIndex == ELF_SHN_XINDEX ) ? section0.m_Link : shStrIndex;
+	}
+
+	const uint64_t shTableSize = ( shNum * shEntSize );
+	if ( shOffset + shTableSize > fileSize )
+	{
+		FLOG_ERROR( "Corrupt section headers in '%s'", fileName.Get() );
+		return ARCHIVE_FAILED;
+	}
+	AutoPtr< uint8_t > shTable( (uint8_t *)ALLOC( (size_t)shTableSize ) );
+	VERIFY( f.Seek( shOffset ) );
+	if ( f.ReadBuffer( shTable.Get(), shTableSize ) != shTableSize )
+	{
+		FLOG_ERROR( "Failed to read section headers from '%s'", fileName.Get() );
+		return ARCHIVE_FAILED;
+	}
+	Array< Section > sections( (size_t)shNum, false );
+	for ( uint64_t i = 0; i < shNum; ++i )
+	{
+		Section section;
+		GetSection( shTable.Get() + ( i * shEntSize ), is64, bigEndian, section );
+		sections.Append( section );
+	}
+
+	// LTO objects are only understood by the compiler (via the librarian's plugin)
+	if ( shStrIndex < shNum )
+	{
+		AutoPtr< char > shStrTab( ReadSection( f, fileSize, sections[ (size_t)shStrIndex ] ) );
+		if ( shStrTab.Get() == nullptr )
+		{
+			FLOG_ERROR( "Failed to read section names from '%s'", fileName.Get() );
+			return ARCHIVE_FAILED;
+		}
+		for ( const Section & section : sections )
+		{
+			if ( ( section.m_Name < sections[ (size_t)shStrIndex ].m_Size ) &&
+				 ( strncmp( shStrTab.Get() + section.m_Name, ".gnu.lto_", 9 ) == 0 ) )
+			{
+				FLOG_INFO( "Archiver: '%s' is an LTO object\n", fileName.Get() );
+				return ARCHIVE_UNSUPPORTED;
+			}
+		}
+	}
+
+	// find symbol table
+	const Section * symTabSection = nullptr;
+	for ( const Section & section : sections )
+	{
+		if ( section.m_Type == ELF_SHT_SYMTAB )
+		{
+			symTabSection = &section;
+			break;
+		}
+	}
+	if ( symTabSection == nullptr )
+	{
+		return ARCHIVE_OK; // no symbols (stripped or empty object)
+	}
+	AutoPtr< char > symTab( ReadSection( f, fileSize, *symTabSection ) );
+	AutoPtr< char > strTab( ( symTabSection->m_Link < shNum ) ? ReadSection( f, fileSize, sections[ symTabSection->m_Link ] ) : nullptr );
+	if ( ( symTab.Get() == nullptr ) || ( strTab.Get() == nullptr ) )
+	{
+		FLOG_ERROR( "Failed to read symbol table from '%s'", fileName.Get() );
+		return ARCHIVE_FAILED;
+	}
+	const uint64_t symTabSize = symTabSection->m_Size;
+	const uint64_t strTabSize = sections[ symTabSection->m_Link ].m_Size;
+
+	// global symbols which are defined (or common) by this object are indexed
+	// (the first symbol is always the null symbol)
+	const uint32_t symSize = is64 ? 24 : 16;
+	const uint32_t infoOffset = is64 ? 4 : 12;
+	const uint32_t shndxOffset = is64 ? 6 : 14;
+	const uint64_t numSyms = ( symTabSize / symSize );
+	for ( uint64_t i = 1; i < numSyms; ++i )
+	{
+		const uint8_t * sym = (const uint8_t *)symTab.Get() + ( i * symSize );
+		const uint32_t bind = ( sym[ infoOffset ] >> 4 );
+		if ( ( bind != ELF_STB_GLOBAL ) && ( bind != ELF_STB_WEAK ) && ( bind != ELF_STB_GNU_UNIQUE ) )
+		{
+			continue;
+		}
+		if ( ReadUInt( sym + shndxOffset, 2, bigEndian ) == ELF_SHN_UNDEF )
+		{
+			continue;
+		}
+		const uint64_t nameOffset = ReadUInt( sym, 4, bigEndian );
+		if ( nameOffset >= strTabSize )
+		{
+			FLOG_ERROR( "Corrupt symbol table in '%s'", fileName.Get() );
+			return ARCHIVE_FAILED;
+		}
+		const char * name = strTab.Get() + nameOffset;
+		m_SymbolNames.WriteBuffer( name, strlen( name ) + 1 );
+		++numSymbols;
+	}
+
+	return ARCHIVE_OK;
+}
+
+// ReadOldArchive
+//------------------------------------------------------------------------------
+bool Archiver::ReadOldArchive( const AString & archiveName )
+{
+	char magic[ 8 ];
+	if ( ( m_OldArchive.Open( archiveName.Get(), FileStream::READ_ONLY ) == false ) ||
+		 ( m_OldArchive.ReadBuffer( magic, sizeof( magic ) ) != sizeof( magic ) ) ||
+		 ( memcmp( magic, "!<arch>\n", sizeof( magic ) ) != 0 ) )
+	{
+		return false;
+	}
+
+	// members
+	const uint64_t fileSize = m_OldArchive.GetFileSize();
+	uint64_t symbolTableSize( 0 );
+	bool symbolTable64( false );
+	AString nameTable;
+	uint64_t pos = sizeof( magic );
+	while ( pos + HEADER_SIZE <= fileSize )
+	{
+		char header[ HEADER_SIZE ];
+		uint64_t size;
+		VERIFY( m_OldArchive.Seek( pos ) );
+		if ( ( m_OldArchive.ReadBuffer( header, HEADER_SIZE ) != HEADER_SIZE ) ||
+			 ( header[ 58 ] != '`' ) || ( header[ 59 ] != '\n' ) ||
+			 ( ParseDecimal( header + 48, 10, size ) == false ) ||
+			 ( pos + HEADER_SIZE + size > fileSize ) )
+		{
+			return false; // corrupt
+		}
+		const uint64_t dataOffset = ( pos + HEADER_SIZE );
+		pos = dataOffset + size + ( size & 1 );
+
+		// symbol table
+		const bool isSymbolTable = ( strncmp( header, "/ ", 2 ) == 0 );
+		const bool isSymbolTable64 = ( strncmp( header, "/SYM64/ ", 8 ) == 0 );
+		if ( isSymbolTable || isSymbolTable64 )
+		{
+			if ( m_OldSymbolTable || m_OldMembers.IsEmpty() == false )
+			{
+				return false; // must be first
+			}
+			m_OldSymbolTable = (char *)ALLOC( (size_t)size + 1 );
+			m_OldSymbolTable[ size ] = 0; // terminate in case of corrupt names
+			symbolTableSize = size;
+			symbolTable64 = isSymbolTable64;
+			if ( m_OldArchive.ReadBuffer( m_OldSymbolTable, size ) != size )
+			{
+				return false;
+			}
+			continue;
+		}
+
+		// long name table
+		if ( strncmp( header, "// ", 3 ) == 0 )
+		{
+			nameTable.SetLength( (uint32_t)size );
+			if ( m_OldArchive.ReadBuffer( nameTable.Get(), size ) != size )
+			{
+				return false;
+			}
+			continue;
+		}
+
+		OldMember member;
+		member.m_HeaderOffset = ( dataOffset - HEADER_SIZE );
+		member.m_DataOffset = dataOffset;
+		member.m_Size = size;
+		member.m_SymbolNames = nullptr;
+		member.m_SymbolNamesSize = 0;
+		member.m_NumSymbols = 0;
+		if ( ( header[ 0 ] == '/' ) && ( header[ 1 ] >= '0' ) && ( header[ 1 ] <= '9' ) )
+		{
+			// name is in long name table, terminated by "/\n"
+			uint64_t nameOffset;
+			if ( ( ParseDecimal( header + 1, 15, nameOffset ) == false ) || ( nameOffset >= nameTable.GetLength() ) )
+			{
+				return false;
+			}
+			const char * name = nameTable.Get() + nameOffset;
+			const char * nameEnd = strstr( name, "/\n" );
+			if ( nameEnd == nullptr )
+			{
+				return false;
+			}
+			member.m_MemberName.Assign( name, nameEnd );
+		}
+		else
+		{
+			// name is in header, terminated by '/' (anything else is BSD style)
+			const char * nameEnd = (const char *)memchr( header, '/', 16 );
+			if ( nameEnd == nullptr )
+			{
+				return false;
+			}
+			member.m_MemberName.Assign( header, nameEnd );
+		}
+		m_OldMembers.Append( member );
+	}
+
+	if ( m_OldSymbolTable == nullptr )
+	{
+		return false; // symbols of members are unknown
+	}
+
+	// assign symbols to members (symbols are grouped by member, in member order)
+	const uint32_t entrySize = symbolTable64 ? 8 : 4;
+	if ( symbolTableSize < entrySize )
+	{
+		return false;
+	}
+	const uint64_t numSymbols = ReadUInt( (const uint8_t *)m_OldSymbolTable, entrySize, true );
+	if ( ( numSymbols + 1 ) * entrySize > symbolTableSize )
+	{
+		return false;
+	}
+	const char * name = m_OldSymbolTable + ( ( numSymbols + 1 ) * entrySize );
+	const char * namesEnd = m_OldSymbolTable + symbolTableSize;
+	size_t memberIndex = 0;
+	for ( uint64_t i = 0; i < numSymbols; ++i )
+	{
+		const uint64_t headerOffset = ReadUInt( (const uint8_t *)m_OldSymbolTable + ( ( i + 1 ) * entrySize ), entrySize, true );
+		while ( ( memberIndex < m_OldMembers.GetSize() ) && ( m_OldMembers[ memberIndex ].m_HeaderOffset < headerOffset ) )
+		{
+			++memberIndex;
+		}
+		if ( ( memberIndex == m_OldMembers.GetSize() ) || ( m_OldMembers[ memberIndex ].m_HeaderOffset != headerOffset ) )
+		{
+			return false; // not in member order
+		}
+		const size_t nameSize = ( strlen( name ) + 1 );
+		if ( name + nameSize > namesEnd )
+		{
+			return false;
+		}
+		OldMember & member = m_OldMembers[ memberIndex ];
+		if ( member.m_NumSymbols == 0 )
+		{
+			member.m_SymbolNames = name;
+		}
+		member.m_SymbolNamesSize += (uint32_t)nameSize;
+		++member.m_NumSymbols;
+		name += nameSize;
+	}
+
+	return true;
+}
+
+// WriteArchive
+//------------------------------------------------------------------------------
+bool Archiver::WriteArchive( const AString & fileName )
+{
+	// names which don't fit in the header are stored in a table
+	AString nameTable;
+	for ( Member & member : m_Members )
+	{
+		if ( member.m_MemberName.GetLength() > MAX_INLINE_NAME_LENGTH )
+		{
+			member.m_NameTableOffset = nameTable.GetLength();
+			nameTable += member.m_MemberName;
+			nameTable += "/\n";
+		}
+	}
+	if ( nameTable.GetLength() & 1 )
+	{
+		nameTable += '\n';
+	}
+
+	// layout archive, switching to 64-bit offsets if it's larger than 4GiB
+	bool use64 = false;
+	uint64_t symbolTableSize = 0;
+	for ( ;; )
+	{
+		const uint32_t entrySize = use64 ? 8 : 4;
+		symbolTableSize = ( ( 1 + m_NumSymbols ) * entrySize ) + m_SymbolNames.GetSize();
+		symbolTableSize += ( symbolTableSize & 1 );
+
+		uint64_t pos = 8 + HEADER_SIZE + symbolTableSize;
+		if ( nameTable.IsEmpty() == false )
+		{
+			pos += HEADER_SIZE + nameTable.GetLength();
+		}
+		uint64_t maxHeaderOffset = 0;
+		for ( Member & member : m_Members )
+		{
+			member.m_HeaderOffset = pos;
+			maxHeaderOffset = pos;
+			pos += HEADER_SIZE + member.m_Size + ( member.m_Size & 1 );
+		}
+
+		if ( use64 || ( maxHeaderOffset <= 0xFFFFFFFF ) )
+		{
+			break;
+		}
+		use64 = true;
+	}
+
+	// symbol table
+	const uint32_t entrySize = use64 ? 8 : 4;
+	MemoryStream symbolTable( (size_t)symbolTableSize );
+	{
+		uint8_t entry[ 8 ];
+		#define WRITE_ENTRY( value ) \
+			for ( uint32_t i = 0; i < entrySize; ++i ) \
+			{ \
+				entry[ i ] = (uint8_t)( (uint64_t)( value ) >> ( 8 * ( entrySize - 1 - i ) ) ); \
+			} \
+			symbolTable.WriteBuffer( entry, entrySize );
+		WRITE_ENTRY( m_NumSymbols )
+		for ( const Member & member : m_Members )
+		{
+			for ( uint32_t i = 0; i < member.m_NumSymbols; ++i )
+			{
+				WRITE_ENTRY( member.m_HeaderOffset )
+			}
+		}
+		#undef WRITE_ENTRY
+		symbolTable.WriteBuffer( m_SymbolNames.GetData(), m_SymbolNames.GetSize() );
+		if ( symbolTable.GetSize() < symbolTableSize )
+		{
+			symbolTable.WriteBuffer( "", 1 );
+		}
+		ASSERT( symbolTable.GetSize() == symbolTableSize );
+	}
+
+	FileStream f;
+	if ( f.Open( fileName.Get(), FileStream::WRITE_ONLY ) == false )
+	{
+		FLOG_ERROR( "Failed to open '%s' for write", fileName.Get() );
+		return false;
+	}
+
+	bool ok = ( f.WriteBuffer( "!<arch>\n", 8 ) == 8 );
+	ok = ok && WriteHeader( f, use64 ? "/SYM64/" : "/", "0", symbolTableSize );
+	ok = ok && ( f.WriteBuffer( symbolTable.GetData(), symbolTableSize ) == symbolTableSize );
+	if ( nameTable.IsEmpty() == false )
+	{
+		ok = ok && WriteHeader( f, "//", nullptr, nameTable.GetLength() );
+		ok = ok && ( f.WriteBuffer( nameTable.Get(), nameTable.GetLength() ) == nameTable.GetLength() );
+	}
+
+	for ( const Member & member : m_Members )
+	{
+		if ( ok == false )
+		{
+			break;
+		}
+		ASSERT( f.Tell() == member.m_HeaderOffset );
+
+		AStackString<> name;
+		if ( member.m_NameTableOffset == NO_NAME_TABLE_OFFSET )
+		{
+			name.Format( "%s/", member.m_MemberName.Get() );
+		}
+		else
+		{
+			name.Format( "/%u", member.m_NameTableOffset );
+		}
+		ok = WriteHeader( f, name.Get(), "644", member.m_Size );
+
+		// copy data from the object, or from the previous archive
+		uint64_t bytesCopied( 0 );
+		if ( member.m_FileName.IsEmpty() )
+		{
+			bytesCopied = f.WriteFromFile( m_OldArchive, member.m_OldDataOffset, member.m_Size );
+		}
+		else
+		{
+			FileStream input;
+			if ( input.Open( member.m_FileName.Get(), FileStream::READ_ONLY ) )
+			{
+				bytesCopied = f.WriteFromFile( input, 0, member.m_Size );
+			}
+		}
+		if ( bytesCopied != member.m_Size )
+		{
+			FLOG_ERROR( "Failed to copy '%s' into archive '%s'", member.m_FileName.IsEmpty() ? member.m_MemberName.Get() : member.m_FileName.Get(), fileName.Get() );
+			return false;
+		}
+		if ( member.m_Size & 1 )
+		{
+			ok = ok && ( f.WriteBuffer( "\n", 1 ) == 1 );
+		}
+	}
+
+	if ( ok == false )
+	{
+		FLOG_ERROR( "Failed to write archive '%s'", fileName.Get() );
+		return false;
+	}
+	return true;
+}
+
+// WriteHeader
+//------------------------------------------------------------------------------
+/*static*/ bool Archiver::WriteHeader( FileStream & f, const char * name, const char * mode, uint64_t size )
+{
+	// name[16] date[12] uid[6] gid[6] mode[8] size[10] "`\n" - fields are
+	// padded with spaces (and the name table has no date/uid/gid/mode)
+	char header[ HEADER_SIZE ];
+	memset( header, ' ', HEADER_SIZE );
+	memcpy( header, name, strlen( name ) );
+	if ( mode )
+	{
+		header[ 16 ] = '0'; // date
+		header[ 28 ] = '0'; // uid
+		header[ 34 ] = '0'; // gid
+		memcpy( header + 40, mode, strlen( mode ) );
+	}
+	AStackString<> sizeString;
+	sizeString.Format( "%llu", (unsigned long long)size );
+	ASSERT( sizeString.GetLength() <= 10 );
+	memcpy( header + 48, sizeString.Get(), sizeString.GetLength() );
+	header[ 58 ] = '`';
+	header[ 59 ] = '\n';
+	return ( f.WriteBuffer( header, HEADER_SIZE ) == HEADER_SIZE );
+}
+
+// GetSection
+//------------------------------------------------------------------------------
+/*static*/ void Archiver::GetSection( const uint8_t * sectionHeader, bool is64, bool bigEndian, Section & section )
+{
+	const uint32_t addrSize = is64 ? 8 : 4;
+	section.m_Name = (uint32_t)ReadUInt( sectionHeader, 4, bigEndian );
+	section.m_Type = (uint32_t)ReadUInt( sectionHeader + 4, 4, bigEndian );
+	section.m_Offset = ReadUInt( sectionHeader + 8 + ( 2 * addrSize ), addrSize, bigEndian );	// after sh_flags, sh_addr
+	section.m_Size = ReadUInt( sectionHeader + 8 + ( 3 * addrSize ), addrSize, bigEndian );
+	section.m_Link = (uint32_t)ReadUInt( sectionHeader + 8 + ( 4 * addrSize ), 4, bigEndian );
+}
+
+// ReadSection
+//------------------------------------------------------------------------------
+/*static*/ char * Archiver::ReadSection( FileStream & f, uint64_t fileSize, const Section & section )
+{
+	if ( section.m_Offset + section.m_Size > fileSize )
+	{
+		return nullptr; // corrupt
+	}
+
+	// terminate, so strings in corrupt string tables can't overrun
+	AutoPtr< char > data( (char *)ALLOC( (size_t)section.m_Size + 1 ) );
+	data.Get()[ section.m_Size ] = 0;
+	VERIFY( f.Seek( section.m_Offset ) );
+	if ( f.ReadBuffer( data.Get(), section.m_Size ) != section.m_Size )
+	{
+		return nullptr;
+	}
+	return data.Release();
+}
+
+// ReadUInt
+//------------------------------------------------------------------------------
+/*static*/ uint64_t Archiver::ReadUInt( const uint8_t * data, uint32_t size, bool bigEndian )
+{
+	uint64_t value = 0;
+	for ( uint32_t i = 0; i < size; ++i )
+	{
+		const uint32_t byteIndex = bigEndian ? i : ( size - 1 - i );
+		value = ( value << 8 ) | data[ byteIndex ];
+	}
+	return value;
+}
+
+// ParseDecimal
+//------------------------------------------------------------------------------
+/*static*/ bool Archiver::ParseDecimal( const char * field, uint32_t fieldSize, uint64_t & value )
+{
+	value = 0;
+	uint32_t i = 0;
+	for ( ; ( i < fieldSize ) && ( field[ i ] >= '0' ) && ( field[ i ] <= '9' ); ++i )
+	{
+		value = ( value * 10 ) + (uint64_t)( field[ i ] - '0' );
+	}
+	if ( i == 0 )
+	{
+		return false;
+	}
+	// remainder must be padding
+	for ( ; i < fieldSize; ++i )
+	{
+		if ( field[ i ] != ' ' )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------------
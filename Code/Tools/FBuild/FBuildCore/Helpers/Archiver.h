@@ -0,0 +1,100 @@
+// Archiver - create static libraries (GNU ar format) in-process
+//------------------------------------------------------------------------------
+#pragma once
+#ifndef FBUILD_HELPERS_ARCHIVER_H
+#define FBUILD_HELPERS_ARCHIVER_H
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/Containers/Array.h"
+#include "Core/FileIO/FileStream.h"
+#include "Core/FileIO/MemoryStream.h"
+#include "Core/Strings/AString.h"
+
+// Archiver
+//------------------------------------------------------------------------------
+// Writes the same output as a deterministic "ar rcs" (GNU format, with a symbol
+// table) for ELF relocatable objects. Other inputs (such as LTO or Mach-O
+// objects) are reported as unsupported, so the caller can use the librarian.
+//
+// Members of the previous archive are re-used (without re-reading the object
+// or its symbols) when the input at the same position is unchanged since the
+// archive was written.
+class Archiver
+{
+public:
+	explicit Archiver();
+	~Archiver();
+
+	enum Result
+	{
+		ARCHIVE_OK,
+		ARCHIVE_FAILED,			// error has been emitted
+		ARCHIVE_UNSUPPORTED,	// an input can't be archived natively
+	};
+
+	// previousStamp is the time the existing archive was written (0 if none)
+	Result Create( const AString & archiveName, const Array< AString > & inputFiles, uint64_t previousStamp );
+
+	inline uint32_t GetNumMembersReused() const { return m_NumMembersReused; }
+
+private:
+	struct Member
+	{
+		AString		m_FileName;			// empty when re-used from the previous archive
+		AString		m_MemberName;
+		uint64_t	m_Size;
+		uint64_t	m_OldDataOffset;	// when re-used from the previous archive
+		uint64_t	m_HeaderOffset;
+		uint32_t	m_NameTableOffset;	// for names too long to be stored in the header
+		uint32_t	m_NumSymbols;
+	};
+	struct OldMember
+	{
+		AString		m_MemberName;
+		uint64_t	m_HeaderOffset;
+		uint64_t	m_DataOffset;
+		uint64_t	m_Size;
+		const char *m_SymbolNames;		// within m_OldSymbolTable
+		uint32_t	m_SymbolNamesSize;
+		uint32_t	m_NumSymbols;
+	};
+
+	struct Section
+	{
+		uint32_t	m_Name;				// offset in section name table
+		uint32_t	m_Type;
+		uint32_t	m_Link;
+		uint64_t	m_Offset;
+		uint64_t	m_Size;
+	};
+
+	Result AddMember( const AString & fileName, const OldMember * oldMember, uint64_t previousStamp );
+	Result ReadSymbols( FileStream & f, const AString & fileName, uint32_t & numSymbols );
+	bool ReadOldArchive( const AString & archiveName );
+	bool WriteArchive( const AString & fileName );
+	static bool WriteHeader( FileStream & f, const char * name, const char * mode, uint64_t size );
+
+	// helpers
+	static void GetSection( const uint8_t * sectionHeader, bool is64, bool bigEndian, Section & section );
+	static char * ReadSection( FileStream & f, uint64_t fileSize, const Section & section ); // returns terminated buffer (or nullptr)
+	static uint64_t ReadUInt( const uint8_t * data, uint32_t size, bool bigEndian );
+	static bool ParseDecimal( const char * field, uint32_t fieldSize, uint64_t & value );
+
+	enum : uint32_t { HEADER_SIZE = 60 };
+	enum : uint32_t { MAX_INLINE_NAME_LENGTH = 15 };
+	enum : uint32_t { NO_NAME_TABLE_OFFSET = 0xFFFFFFFF };
+
+	Array< Member >		m_Members;
+	MemoryStream		m_SymbolNames;		// null terminated, in member order
+	uint32_t			m_NumSymbols;
+	uint32_t			m_NumMembersReused;
+
+	// previous archive
+	FileStream			m_OldArchive;
+	Array< OldMember >	m_OldMembers;
+	char *				m_OldSymbolTable;
+};
+
+//------------------------------------------------------------------------------
+#endif // FBUILD_HELPERS_ARCHIVER_H
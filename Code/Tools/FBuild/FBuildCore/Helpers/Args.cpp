@@ -10,9 +10,13 @@
 #include "Tools/FBuild/FBuildCore/FLog.h"
 
 // Core
+#include "Core/Math/Conversions.h"
+#include "Core/Mem/ScratchArena.h"
 #include "Core/Profile/Profile.h"
 #include "Core/Strings/AString.h"
 
+#include <string.h>
+
 // system
 #if defined( __OSX__ )
 	#include <limits.h>
@@ -21,9 +25,12 @@
 // CONSTRUCTOR
 //------------------------------------------------------------------------------
 Args::Args()
-	: m_Args()
+	: m_Arena( ScratchArena::GetThreadArena() )
+	, m_Args( m_Arena )
 	, m_ResponseFileArgs()
-	, m_DelimiterIndices( 64, true )
+	, m_DelimiterIndices( nullptr )
+	, m_NumDelimiters( 0 )
+	, m_MaxDelimiters( 0 )
 	#if defined( ASSERTS_ENABLED )
 		, m_Finalized( false )
 	#endif
@@ -41,7 +48,9 @@ Args::~Args()
 void Args::operator += ( const char * argPart )
 {
 	ASSERT( !m_Finalized );
-	m_Args += argPart;
+	const size_t len = strlen( argPart );
+	m_Args.Reserve( m_Args.GetLength() + (uint32_t)len );
+	m_Args.Append( argPart, len );
 }
 
 // operator += (AString&)
@@ -49,14 +58,16 @@ void Args::operator += ( const char * argPart )
 void Args::operator += ( const AString & argPart )
 {
 	ASSERT( !m_Finalized );
+	m_Args.Reserve( m_Args.GetLength() + argPart.GetLength() );
 	m_Args += argPart;
 }
 
-// Append
+// operator += (char)
 //------------------------------------------------------------------------------
 void Args::operator += ( char argPart )
 {
 	ASSERT( !m_Finalized );
+	m_Args.Reserve( m_Args.GetLength() + 1 );
 	m_Args += argPart;
 }
 
@@ -65,6 +76,7 @@ void Args::operator += ( char argPart )
 void Args::Append( const char * begin, size_t count )
 {
 	ASSERT( !m_Finalized );
+	m_Args.Reserve( m_Args.GetLength() + (uint32_t)count );
 	m_Args.Append( begin, count );
 }
 
@@ -75,8 +87,13 @@ void Args::AddDelimiter()
 	ASSERT( !m_Finalized );
 
 	// Take note of delimiter position in case we need to replace it later
-	m_DelimiterIndices.Append( (uint32_t)m_Args.GetLength() );
+	if ( m_NumDelimiters == m_MaxDelimiters )
+	{
+		GrowDelimiterIndices();
+	}
+	m_DelimiterIndices[ m_NumDelimiters++ ] = m_Args.GetLength();
 
+	m_Args.Reserve( m_Args.GetLength() + 1 );
 	m_Args += ' '; // Construct with spaces by default
 }
 
@@ -86,7 +103,7 @@ void Args::Clear()
 {
 	ASSERT( !m_Finalized ); // NOTE: Can only reset args before we finalize
 	m_Args.Clear();
-	m_DelimiterIndices.Clear();
+	m_NumDelimiters = 0;
 }
 
 // Finalize
@@ -130,8 +147,9 @@ bool Args::Finalize( const AString & exe, const AString & nodeNameForError, bool
 				if ( argLen >= 131071 ) // From LNK1170
 				{
 					// Change spaces to carriage returns
-					for ( uint32_t i : m_DelimiterIndices )
+					for ( const uint32_t * it = m_DelimiterIndices; it != ( m_DelimiterIndices + m_NumDelimiters ); ++it )
 					{
+						const uint32_t i = *it;
 						ASSERT( m_Args[ i ] == ' ' );
 						m_Args[ i ] = '\n';
 					}
@@ -168,7 +186,69 @@ bool Args::Finalize( const AString & exe, const AString & nodeNameForError, bool
 	#endif
 }
 
-// Generate
+// GrowDelimiterIndices
+//------------------------------------------------------------------------------
+void Args::GrowDelimiterIndices()
+{
+	const uint32_t newMax = Math::Max< uint32_t >( m_MaxDelimiters * 2, 64 );
+	if ( ( m_DelimiterIndices == nullptr ) ||
+		 ( m_Arena.TryExtend( m_DelimiterIndices, m_MaxDelimiters * sizeof( uint32_t ), newMax * sizeof( uint32_t ) ) == false ) )
+	{
+		uint32_t * newIndices = (uint32_t *)m_Arena.Alloc( newMax * sizeof( uint32_t ), sizeof( uint32_t ) );
+		if ( m_NumDelimiters )
+		{
+			memcpy( newIndices, m_DelimiterIndices, m_NumDelimiters * sizeof( uint32_t ) );
+		}
+		m_DelimiterIndices = newIndices;
+	}
+	m_MaxDelimiters = newMax;
+}
+
+// ArenaString CONSTRUCTOR
+//------------------------------------------------------------------------------
+Args::ArenaString::ArenaString( ScratchArena & arena )
+	: AString()
+	, m_Arena( arena )
+{
+	GrowInArena( 4096 );
+}
+
+// ArenaString DESTRUCTOR
+//------------------------------------------------------------------------------
+Args::ArenaString::~ArenaString()
+{
+	// appends which bypass Reserve() grow through AString onto the heap
+	ASSERT( MemoryMustBeFreed() == false );
+	if ( MemoryMustBeFreed() )
+	{
+		return; // ~AString will free it
+	}
+
+	// memory is released with the arena
+	m_Contents = const_cast< char * >( s_EmptyString );
+	m_Length = 0;
+	SetReserved( 0, false );
+}
+
+// ArenaString::GrowInArena
+//------------------------------------------------------------------------------
+void Args::ArenaString::GrowInArena( uint32_t length )
+{
+	const uint32_t oldReserved = GetReserved();
+	const uint32_t newReserved = Math::RoundUp( Math::Max( oldReserved * 2, length ), (uint32_t)2 );
+
+	// extend in-place if nothing else has been allocated since
+	if ( ( oldReserved == 0 ) ||
+		 ( m_Arena.TryExtend( m_Contents, oldReserved + 1, newReserved + 1 ) == false ) )
+	{
+		char * newMem = (char *)m_Arena.Alloc( newReserved + 1, 1 ); // also allocate for \0 terminator
+		memcpy( newMem, m_Contents, m_Length + 1 );
+		m_Contents = newMem;
+	}
+	SetReserved( newReserved, false );
+}
+
+// StripQuotes
 //------------------------------------------------------------------------------
 /*static*/ void Args::StripQuotes( const char * start, const char * end, AString & out )
 {
@@ -16,9 +16,12 @@
 // Forward Declarations
 //------------------------------------------------------------------------------
 class AString;
+class ScratchArena;
 
 // Args
 //------------------------------------------------------------------------------
+// Args are built in the calling thread's ScratchArena, so they must not outlive
+// the Job (or other ScratchArena::Scope) in which they are constructed.
 class Args
 {
 public:
@@ -48,9 +51,30 @@ public:
 	static void StripQuotes( const char * start, const char * end, AString & out );
 
 protected:
-	AStackString< 4096 >	m_Args;
+	// AString with storage in a ScratchArena
+	class ArenaString : public AString
+	{
+	public:
+		explicit ArenaString( ScratchArena & arena );
+		~ArenaString();
+
+		// ensure appends up to the given length won't need to re-allocate
+		inline void Reserve( uint32_t length ) { if ( length > GetReserved() ) { GrowInArena( length ); } }
+
+	private:
+		void GrowInArena( uint32_t length );
+
+		ScratchArena & m_Arena;
+	};
+
+	void GrowDelimiterIndices();
+
+	ScratchArena &			m_Arena;
+	ArenaString				m_Args;
 	AString					m_ResponseFileArgs;
-	Array< uint32_t >		m_DelimiterIndices;
+	uint32_t *				m_DelimiterIndices;	// in arena
+	uint32_t				m_NumDelimiters;
+	uint32_t				m_MaxDelimiters;
 	ResponseFile			m_ResponseFile;
 	#if defined( ASSERTS_ENABLED )
 		bool				m_Finalized;
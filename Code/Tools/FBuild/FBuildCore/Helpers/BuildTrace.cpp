@@ -0,0 +1,331 @@
+// BuildTrace
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Tools/FBuild/FBuildCore/PrecompiledHeader.h"
+
+#include "BuildTrace.h"
+
+// FBuildCore
+#include "Tools/FBuild/FBuildCore/FLog.h"
+#include "Tools/FBuild/FBuildCore/Graph/Node.h"
+#include "Tools/FBuild/FBuildCore/WorkerPool/WorkerThread.h"
+
+// Core
+#include "Core/Containers/Array.h"
+#include "Core/FileIO/FileStream.h"
+#include "Core/Mem/Mem.h"
+#include "Core/Process/Mutex.h"
+#include "Core/Process/Thread.h"
+#include "Core/Strings/AStackString.h"
+
+// BuildTraceEvent
+//------------------------------------------------------------------------------
+struct BuildTraceEvent
+{
+	const Node *		m_Node;
+	uint64_t			m_StartTime;
+	uint64_t			m_EndTime;
+	uint64_t			m_QueueWaitTime;
+	uint64_t			m_Bytes;
+	uint32_t			m_HostIndex; // into thread's host list, or INVALID_HOST
+	BuildTrace::Phase	m_Phase;
+
+	enum { INVALID_HOST = 0xFFFFFFFF };
+};
+
+// Per-Thread structure
+//------------------------------------------------------------------------------
+struct BuildTraceThreadBuffer
+{
+	explicit BuildTraceThreadBuffer()
+		: m_ThreadIndex( WorkerThread::GetThreadIndex() )
+		, m_IsMainThread( Thread::IsMainThread() )
+		, m_Blocks( 16, true )
+		, m_Current( nullptr )
+		, m_End( nullptr )
+		, m_Hosts( 0, true )
+	{}
+	~BuildTraceThreadBuffer()
+	{
+		for ( BuildTraceEvent * block : m_Blocks )
+		{
+			FDELETE_ARRAY block;
+		}
+	}
+
+	inline BuildTraceEvent * AllocateEvent()
+	{
+		if ( m_Current == m_End )
+		{
+			AllocateBlock();
+		}
+		return m_Current++;
+	}
+	NO_INLINE void AllocateBlock()
+	{
+		m_Current = FNEW_ARRAY( BuildTraceEvent[ NUM_EVENTS_PER_BLOCK ] );
+		m_End = m_Current + NUM_EVENTS_PER_BLOCK;
+		m_Blocks.Append( m_Current );
+	}
+	inline size_t GetNumEventsInBlock( size_t blockIndex ) const
+	{
+		return ( blockIndex == ( m_Blocks.GetSize() - 1 ) ) ? (size_t)( m_Current - m_Blocks[ blockIndex ] )
+															: (size_t)NUM_EVENTS_PER_BLOCK;
+	}
+
+	uint32_t					m_ThreadIndex;
+	bool						m_IsMainThread;
+	Array< BuildTraceEvent * >	m_Blocks;
+	BuildTraceEvent *			m_Current;
+	BuildTraceEvent *			m_End;
+	Array< AString >			m_Hosts; // remote hosts referred to by events
+
+	enum { NUM_EVENTS_PER_BLOCK = 1024 };
+};
+
+// Static Data
+//------------------------------------------------------------------------------
+/*static*/ volatile bool BuildTrace::s_Enabled( false );
+/*static*/ uint64_t BuildTrace::s_StartTime( 0 );
+
+// Global Data
+//------------------------------------------------------------------------------
+static Mutex g_BuildTraceMutex;
+static Array< BuildTraceThreadBuffer * > g_BuildTraceBuffers( 0, true );
+static uint32_t g_BuildTraceGeneration( 0 ); // invalidates buffers from previous builds
+static THREAD_LOCAL BuildTraceThreadBuffer * tls_BuildTraceBuffer( nullptr );
+static THREAD_LOCAL uint32_t tls_BuildTraceGeneration( 0 );
+
+static const char * const g_BuildTracePhaseNames[] =
+{
+	"Build",
+	"Preprocess",
+	"Compile",
+	"CacheRetrieve",
+	"CacheStore",
+	"Link",
+	"Remote",
+};
+
+// Start
+//------------------------------------------------------------------------------
+/*static*/ void BuildTrace::Start()
+{
+	static_assert( sizeof( g_BuildTracePhaseNames ) / sizeof( const char * ) == NUM_PHASES, "g_BuildTracePhaseNames item count doesn't match NUM_PHASES" );
+	ASSERT( s_Enabled == false );
+
+	MutexHolder mh( g_BuildTraceMutex );
+	++g_BuildTraceGeneration;
+	s_StartTime = (uint64_t)Timer::GetNow();
+	s_Enabled = true;
+}
+
+// AddEvent
+//------------------------------------------------------------------------------
+/*static*/ void BuildTrace::AddEvent( const Node * node,
+									  Phase phase,
+									  uint64_t startTime,
+									  uint64_t endTime,
+									  uint64_t queueWaitTime,
+									  uint64_t bytes,
+									  const AString * remoteHost )
+{
+	if ( s_Enabled == false )
+	{
+		return;
+	}
+
+	// first event on this thread for this build?
+	BuildTraceThreadBuffer * buffer = tls_BuildTraceBuffer;
+	if ( tls_BuildTraceGeneration != g_BuildTraceGeneration )
+	{
+		buffer = FNEW( BuildTraceThreadBuffer );
+		{
+			MutexHolder mh( g_BuildTraceMutex );
+			g_BuildTraceBuffers.Append( buffer );
+		}
+		tls_BuildTraceBuffer = buffer;
+		tls_BuildTraceGeneration = g_BuildTraceGeneration;
+	}
+
+	BuildTraceEvent * e = buffer->AllocateEvent();
+	e->m_Node = node;
+	e->m_StartTime = startTime;
+	e->m_EndTime = endTime;
+	e->m_QueueWaitTime = queueWaitTime;
+	e->m_Bytes = bytes;
+	e->m_Phase = phase;
+	e->m_HostIndex = BuildTraceEvent::INVALID_HOST;
+	if ( remoteHost )
+	{
+		const AString * host = buffer->m_Hosts.Find( *remoteHost );
+		if ( host == nullptr )
+		{
+			buffer->m_Hosts.Append( *remoteHost );
+			host = &buffer->m_Hosts.Top();
+		}
+		e->m_HostIndex = (uint32_t)( host - buffer->m_Hosts.Begin() );
+	}
+}
+
+// Stop
+//------------------------------------------------------------------------------
+/*static*/ bool BuildTrace::Stop( const AString & fileName )
+{
+	ASSERT( s_Enabled );
+
+	// take ownership of all buffers (all threads which record events
+	// have finished with the build by now)
+	Array< BuildTraceThreadBuffer * > buffers( 0, true );
+	{
+		MutexHolder mh( g_BuildTraceMutex );
+		s_Enabled = false;
+		buffers.Swap( g_BuildTraceBuffers );
+	}
+
+	FileStream f;
+	bool ok = f.Open( fileName.Get(), FileStream::WRITE_ONLY );
+	if ( ok == false )
+	{
+		FLOG_ERROR( "Failed to open trace file '%s'", fileName.Get() );
+	}
+
+	const double ticksToUS = ( (double)Timer::GetFrequencyInvFloatMS() * 1000.0 );
+	const double ticksToMS = ( (double)Timer::GetFrequencyInvFloatMS() );
+
+	Array< AString > remoteHosts( 0, true ); // each remote host gets its own lane
+	uint32_t numOtherThreads = 0;
+	size_t numEvents = 0;
+
+	AStackString< 4096 > buffer( "{\"traceEvents\":[\n" );
+	AStackString< 32 > threadName;
+	for ( const BuildTraceThreadBuffer * threadBuffer : buffers )
+	{
+		// name the lane for this thread
+		uint32_t tid;
+		if ( threadBuffer->m_IsMainThread )
+		{
+			tid = 0;
+			threadName = "Main Thread";
+		}
+		else if ( threadBuffer->m_ThreadIndex > 0 )
+		{
+			tid = threadBuffer->m_ThreadIndex;
+			threadName.Format( "Worker %u", tid );
+		}
+		else
+		{
+			tid = 1000 + numOtherThreads++;
+			threadName.Format( "Thread %u", numOtherThreads );
+		}
+		buffer.AppendFormat( "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s\"}},\n", tid, threadName.Get() );
+
+		// map hosts of this thread to lanes
+		Array< uint32_t > hostTids( threadBuffer->m_Hosts.GetSize(), false );
+		for ( const AString & host : threadBuffer->m_Hosts )
+		{
+			const AString * existing = remoteHosts.Find( host );
+			if ( existing == nullptr )
+			{
+				remoteHosts.Append( host );
+				existing = &remoteHosts.Top();
+
+				buffer.AppendFormat( "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"Remote: ",
+									 (uint32_t)( 2000 + ( existing - remoteHosts.Begin() ) ) );
+				WriteEscaped( buffer, host );
+				buffer += "\"}},\n";
+			}
+			hostTids.Append( (uint32_t)( 2000 + ( existing - remoteHosts.Begin() ) ) );
+		}
+
+		for ( size_t blockIndex = 0; blockIndex < threadBuffer->m_Blocks.GetSize(); ++blockIndex )
+		{
+			const BuildTraceEvent * it = threadBuffer->m_Blocks[ blockIndex ];
+			const BuildTraceEvent * const end = it + threadBuffer->GetNumEventsInBlock( blockIndex );
+			for ( ; it != end; ++it )
+			{
+				const BuildTraceEvent & e = *it;
+				const uint32_t eventTid = ( e.m_HostIndex != BuildTraceEvent::INVALID_HOST ) ? hostTids[ e.m_HostIndex ] : tid;
+
+				// {"name":"file.obj","cat":"Compile","ph":"X","pid":0,"tid":1,"ts":1000,"dur":200,"args":{...}}
+				buffer += "{\"name\":\"";
+				WriteEscaped( buffer, e.m_Node->GetName() );
+				buffer.AppendFormat( "\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%llu,\"dur\":%llu,\"args\":{\"type\":\"%s\"",
+									 g_BuildTracePhaseNames[ e.m_Phase ],
+									 eventTid,
+									 (unsigned long long)( (double)( e.m_StartTime - s_StartTime ) * ticksToUS ),
+									 (unsigned long long)( (double)( e.m_EndTime - e.m_StartTime ) * ticksToUS ),
+									 e.m_Node->GetTypeName() );
+				if ( e.m_QueueWaitTime )
+				{
+					buffer.AppendFormat( ",\"queue_ms\":%.3f", (double)e.m_QueueWaitTime * ticksToMS );
+				}
+				if ( e.m_Bytes )
+				{
+					buffer.AppendFormat( ",\"bytes\":%llu", (unsigned long long)e.m_Bytes );
+				}
+				if ( e.m_HostIndex != BuildTraceEvent::INVALID_HOST )
+				{
+					buffer += ",\"host\":\"";
+					WriteEscaped( buffer, threadBuffer->m_Hosts[ e.m_HostIndex ] );
+					buffer += '"';
+				}
+				buffer += "}},\n";
+				++numEvents;
+
+				// flush periodically
+				if ( buffer.GetLength() > 3072 )
+				{
+					if ( ok && ( f.WriteBuffer( buffer.Get(), buffer.GetLength() ) != buffer.GetLength() ) )
+					{
+						ok = false;
+					}
+					buffer.Clear();
+				}
+			}
+		}
+
+		FDELETE threadBuffer;
+	}
+
+	// close array (ending with the process name avoids a trailing comma)
+	buffer += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"FASTBuild\"}}\n]}\n";
+	if ( ok && ( f.WriteBuffer( buffer.Get(), buffer.GetLength() ) != buffer.GetLength() ) )
+	{
+		ok = false;
+	}
+
+	if ( ok )
+	{
+		FLOG_INFO( "Build trace: %u events written to '%s'", (uint32_t)numEvents, fileName.Get() );
+	}
+	else if ( f.IsOpen() )
+	{
+		FLOG_ERROR( "Failed to write trace file '%s'", fileName.Get() );
+	}
+	return ok;
+}
+
+// WriteEscaped
+//------------------------------------------------------------------------------
+/*static*/ void BuildTrace::WriteEscaped( AString & buffer, const AString & string )
+{
+	for ( const char * c = string.Get(); *c; ++c )
+	{
+		if ( ( *c == '"' ) || ( *c == '\\' ) )
+		{
+			buffer += '\\';
+		}
+		else if ( (unsigned char)*c < 0x20 )
+		{
+			// control characters (legal in some file names) must be escaped
+			buffer.AppendFormat( "\\u%04x", (uint32_t)(unsigned char)*c );
+			continue;
+		}
+		buffer += *c;
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,93 @@
+// BuildTrace - timeline of build activity, in Chrome trace format
+//------------------------------------------------------------------------------
+#pragma once
+#ifndef FBUILD_HELPERS_BUILDTRACE_H
+#define FBUILD_HELPERS_BUILDTRACE_H
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/Env/Types.h"
+#include "Core/Time/Timer.h"
+
+// Forward Declarations
+//------------------------------------------------------------------------------
+class AString;
+class Node;
+
+// BuildTrace
+//------------------------------------------------------------------------------
+// Records what each thread (and each remote worker) was doing during a build,
+// for viewing in chrome://tracing. Unlike the profiler, this is available in
+// all configurations and records build semantics rather than code sections.
+//
+// Events are appended to per-thread buffers without locking, and are only
+// gathered when the build is complete.
+class BuildTrace
+{
+public:
+	enum Phase
+	{
+		PHASE_BUILD				= 0, // overall processing of a job
+		PHASE_PREPROCESS		= 1,
+		PHASE_COMPILE			= 2,
+		PHASE_CACHE_RETRIEVE	= 3,
+		PHASE_CACHE_STORE		= 4,
+		PHASE_LINK				= 5,
+		PHASE_REMOTE			= 6, // job built by a remote worker
+		NUM_PHASES
+	};
+
+	// enable recording (at the start of a build)
+	static void Start();
+
+	// write recorded events to a file and disable recording
+	static bool Stop( const AString & fileName );
+
+	inline static bool IsEnabled() { return s_Enabled; }
+
+	// record an event (times are from Timer::GetNow())
+	static void AddEvent( const Node * node,
+						  Phase phase,
+						  uint64_t startTime,
+						  uint64_t endTime,
+						  uint64_t queueWaitTime = 0,
+						  uint64_t bytes = 0,
+						  const AString * remoteHost = nullptr );
+
+	// helper to record an event for a scope
+	class Section
+	{
+	public:
+		inline Section( const Node * node, Phase phase, uint64_t queueWaitTime = 0 )
+			: m_Node( node )
+			, m_Phase( phase )
+			, m_StartTime( s_Enabled ? Timer::GetNow() : 0 )
+			, m_QueueWaitTime( queueWaitTime )
+			, m_Bytes( 0 )
+		{}
+		inline ~Section()
+		{
+			if ( m_StartTime ) { AddEvent( m_Node, m_Phase, m_StartTime, Timer::GetNow(), m_QueueWaitTime, m_Bytes ); }
+		}
+
+		inline void SetBytes( uint64_t bytes ) { m_Bytes = bytes; }
+
+	private:
+		Section & operator = ( const Section & ) = delete;
+
+		const Node *	m_Node;
+		const Phase		m_Phase;
+		const uint64_t	m_StartTime;
+		const uint64_t	m_QueueWaitTime;
+		uint64_t		m_Bytes;
+	};
+
+private:
+	static void WriteEscaped( AString & buffer, const AString & string );
+
+	static volatile bool s_Enabled;	// read by worker threads
+	static uint64_t	s_StartTime;
+};
+
+//------------------------------------------------------------------------------
+#endif // FBUILD_HELPERS_BUILDTRACE_H
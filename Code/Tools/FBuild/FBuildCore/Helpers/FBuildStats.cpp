@@ -32,6 +32,17 @@ public:
 	}
 };
 
+// NodeStartTimeSorter
+//------------------------------------------------------------------------------
+class NodeStartTimeSorter
+{
+public:
+	inline bool operator () ( const Node * a, const Node * b ) const
+	{
+		return ( a->GetBuildStartTime() < b->GetBuildStartTime() );
+	}
+};
+
 // CONSTRUCTOR - FBuildStats
 //------------------------------------------------------------------------------
 FBuildStats::FBuildStats()
@@ -40,8 +51,10 @@ FBuildStats::FBuildStats()
 	, m_TotalBuildTime( 0.0f )
 	, m_TotalLocalCPUTimeMS( 0 )
 	, m_TotalRemoteCPUTimeMS( 0 )
+	, m_BuildStartTime( 0 )
 	, m_RootNode( nullptr )
 	, m_NodesByTime( 100 * 1000, true )
+	, m_NodesByStartTime( 100 * 1000, true )
 {}
 
 // CONSTRUCTOR - FBuildStats::Stats
@@ -52,6 +65,8 @@ FBuildStats::Stats::Stats()
 	, m_NumCacheHits( 0 )
 	, m_NumCacheMisses( 0 )
 	, m_NumCacheStores( 0 )
+	, m_NumEarlyCutoffs( 0 )
+	, m_NumDeduplicated( 0 )
 	, m_ProcessingTimeMS( 0 )
 	, m_NumFailed( 0 )
 {}
@@ -99,6 +114,8 @@ void FBuildStats::GatherPostBuildStatistics( Node * node )
 
 	NodeCostSorter ncs;
 	m_NodesByTime.Sort( ncs );
+	NodeStartTimeSorter nsts;
+	m_NodesByStartTime.Sort( nsts );
 
 	// Total the stats
 	for ( uint32_t i=0; i< Node::NUM_NODE_TYPES; ++i )
@@ -108,6 +125,8 @@ void FBuildStats::GatherPostBuildStatistics( Node * node )
 		m_Totals.m_NumCacheHits		+= m_PerTypeStats[ i ].m_NumCacheHits;
 		m_Totals.m_NumCacheMisses	+= m_PerTypeStats[ i ].m_NumCacheMisses;
 		m_Totals.m_NumCacheStores	+= m_PerTypeStats[ i ].m_NumCacheStores;
+		m_Totals.m_NumEarlyCutoffs	+= m_PerTypeStats[ i ].m_NumEarlyCutoffs;
+		m_Totals.m_NumDeduplicated	+= m_PerTypeStats[ i ].m_NumDeduplicated;
 	}
 }
 
@@ -185,6 +204,46 @@ void FBuildStats::OutputSummary() const
 		output.AppendFormat( " - Hits       : %u (%2.1f %%)\n", hits, hitPerc );
 		output.AppendFormat( " - Misses     : %u\n", misses );
 		output.AppendFormat( " - Stores     : %u\n", stores );
+		if ( m_Totals.m_NumDeduplicated > 0 )
+		{
+			output.AppendFormat( " - Dedup      : %u (identical compilations shared in-flight)\n", m_Totals.m_NumDeduplicated );
+		}
+	}
+	if ( m_Totals.m_NumEarlyCutoffs > 0 )
+	{
+		output += "Content Hashing:\n";
+		output.AppendFormat( " - Avoided    : %u (outputs rebuilt with unchanged contents)\n", m_Totals.m_NumEarlyCutoffs );
+	}
+	bool poolHeaderWritten = false;
+	for ( const ResourcePool & pool : FBuild::Get().GetResourcePools() )
+	{
+		// only show pools used by this build
+		if ( pool.GetNumJobs() == 0 )
+		{
+			continue;
+		}
+		if ( poolHeaderWritten == false )
+		{
+			output += "Resource Pools:\n";
+			poolHeaderWritten = true;
+		}
+
+		AStackString<> limits;
+		limits.Format( "peak %u", pool.GetPeakJobs() );
+		if ( pool.GetMaxJobs() > 0 )
+		{
+			limits.AppendFormat( "/%u", pool.GetMaxJobs() );
+		}
+		limits += " jobs";
+		if ( pool.GetMemoryMiB() > 0 )
+		{
+			limits.AppendFormat( ", peak %u/%u MB", pool.GetPeakMemoryMiB(), pool.GetMemoryMiB() );
+		}
+		output.AppendFormat( " - %-10s : %u (%s, %u held back)\n",
+							 pool.GetName().Get(),
+							 pool.GetNumJobs(),
+							 limits.Get(),
+							 pool.GetNumJobsHeldBack() );
 	}
 
 	AStackString<> buffer;
@@ -238,6 +297,15 @@ void FBuildStats::GatherPostBuildStatisticsRecurse( Node * node )
 			}
 		}
 
+		// was this node processed during this build? (timestamps of nodes
+		// not processed are left over from earlier builds)
+		if ( ( node->GetBuildStartTime() >= m_BuildStartTime ) &&
+			 ( node->GetBuildStartTime() != 0 ) &&
+			 ( node->GetBuildEndTime() >= node->GetBuildStartTime() ) )
+		{
+			m_NodesByStartTime.Append( node );
+		}
+
 		if ( node->GetStatFlag( Node::STATS_BUILT ) )
 		{
 			stats.m_NumBuilt++;
@@ -258,6 +326,14 @@ void FBuildStats::GatherPostBuildStatisticsRecurse( Node * node )
 		{
 			stats.m_NumCacheStores++;
 		}
+		if ( node->GetStatFlag( Node::STATS_EARLY_CUTOFF ) )
+		{
+			stats.m_NumEarlyCutoffs++;
+		}
+		if ( node->GetStatFlag( Node::STATS_DEDUPLICATED ) )
+		{
+			stats.m_NumDeduplicated++;
+		}
 	}
 
 	// mark this node as processed to prevent multiple recursion
@@ -33,6 +33,7 @@ public:
 	float		m_TotalBuildTime;		// Total time taken
 	uint32_t	m_TotalLocalCPUTimeMS;	// Total CPU time on local host
 	uint32_t	m_TotalRemoteCPUTimeMS;	// Total CPU time on remote workers
+	uint64_t	m_BuildStartTime;		// Timer::GetNow() when the build began
 
 	// after the build it complete, accumulate all the stats
 	void GatherPostBuildStatistics( Node * node );
@@ -45,6 +46,8 @@ public:
 	uint32_t GetCacheHits() const		{ return m_Totals.m_NumCacheHits; }
 	uint32_t GetCacheMisses() const		{ return m_Totals.m_NumCacheMisses; }
 	uint32_t GetCacheStores() const		{ return m_Totals.m_NumCacheStores; }
+	uint32_t GetEarlyCutoffs() const	{ return m_Totals.m_NumEarlyCutoffs; }
+	uint32_t GetDeduplicated() const	{ return m_Totals.m_NumDeduplicated; }
 
 	// get stats per node type
 	struct Stats;
@@ -60,6 +63,8 @@ public:
 		uint32_t m_NumCacheHits;
 		uint32_t m_NumCacheMisses;
 		uint32_t m_NumCacheStores;
+		uint32_t m_NumEarlyCutoffs;	// rebuilds avoided because deps had unchanged contents
+		uint32_t m_NumDeduplicated;	// outputs copied from an identical job in the same build
 
 		uint32_t m_ProcessingTimeMS;
 		uint32_t m_NumFailed;
@@ -69,6 +74,7 @@ public:
 
 	const Node * GetRootNode() const { return m_RootNode; }
 	const Array< const Node * > & GetNodesByTime() const { return m_NodesByTime; }
+	const Array< const Node * > & GetNodesByStartTime() const { return m_NodesByStartTime; } // processed during this build
 
 	static inline void SetIgnoreCompilerNodeDeps( bool b ) { s_IgnoreCompilerNodeDeps = b; }
 private:
@@ -77,6 +83,7 @@ private:
 
 	Node * m_RootNode;
 	Array< const Node * > m_NodesByTime;
+	Array< const Node * > m_NodesByStartTime;
 
 	Stats m_PerTypeStats[ Node::NUM_NODE_TYPES ];
 	Stats m_Totals;
@@ -9,6 +9,7 @@
 
 // Core
 #include "Core/FileIO/ConstMemoryStream.h"
+#include "Core/FileIO/FileIO.h"
 #include "Core/FileIO/FileStream.h"
 #include "Core/FileIO/MemoryStream.h"
 
@@ -38,7 +39,7 @@ MultiBuffer::~MultiBuffer()
 
 // SerializeFromFiles
 //------------------------------------------------------------------------------
-bool MultiBuffer::CreateFromFiles( const Array< AString > & fileNames )
+bool MultiBuffer::CreateFromFiles( const Array< AString > & fileNames, bool allowMissingFiles )
 {
 	ASSERT( fileNames.GetSize() <= MAX_FILES );
 	ASSERT( ( m_ReadStream == nullptr ) && ( m_WriteStream == nullptr ) )
@@ -54,6 +55,12 @@ bool MultiBuffer::CreateFromFiles( const Array< AString > & fileNames )
 		FileStream& fs = fileStreams[ i ];
 		if ( fs.Open( fileNames[ i ].Get(), FileStream::READ_ONLY ) == false )
 		{
+			if ( allowMissingFiles && ( FileIO::FileExists( fileNames[ i ].Get() ) == false ) )
+			{
+				memSize += sizeof( uint64_t );
+				fileSizes[ i ] = MISSING_FILE_SIZE;
+				continue;
+			}
 			return false;
 		}
 		const uint64_t fileSize = fs.GetFileSize();
@@ -76,6 +83,10 @@ bool MultiBuffer::CreateFromFiles( const Array< AString > & fileNames )
 	// Read data for each file
 	for ( size_t i = 0; i <numFiles; ++i )
 	{
+		if ( fileSizes[ i ] == MISSING_FILE_SIZE )
+		{
+			continue;
+		}
 		FileStream & fs = fileStreams[ i ];
 		if ( m_WriteStream->WriteBuffer( fs, fileSizes[ i ] ) != fileSizes[ i ] )
 		{
@@ -98,7 +109,7 @@ bool MultiBuffer::ExtractFile( size_t index, const AString& fileName ) const
 	uint32_t numFiles;
 	m_ReadStream->Read( numFiles );
 
-	ASSERT( index <= numFiles );
+	ASSERT( index < numFiles );
 
 	// work out data offset from file sizes
 	uint64_t offset = sizeof( uint32_t ) + ( sizeof( uint64_t ) * numFiles );
@@ -106,13 +117,23 @@ bool MultiBuffer::ExtractFile( size_t index, const AString& fileName ) const
 	{
 		uint64_t fileSize;
 		m_ReadStream->Read( fileSize );
-		offset += fileSize;
+		if ( fileSize != MISSING_FILE_SIZE )
+		{
+			offset += fileSize;
+		}
 	}
 
 	// size of the file we want to write
 	uint64_t fileSize = 0;
 	m_ReadStream->Read( fileSize );
 
+	// file didn't exist when stored, so make sure no stale version remains
+	if ( fileSize == MISSING_FILE_SIZE )
+	{
+		FileIO::FileDelete( fileName.Get() );
+		return true;
+	}
+
 	// Jump to data
 	m_ReadStream->Seek( offset );
 	const void * fileData = (void *)( (size_t)m_ReadStream->GetData() + offset );
@@ -130,6 +151,18 @@ bool MultiBuffer::ExtractFile( size_t index, const AString& fileName ) const
 	return true;
 }
 
+// GetNumFiles
+//------------------------------------------------------------------------------
+uint32_t MultiBuffer::GetNumFiles() const
+{
+	ASSERT( m_ReadStream );
+
+	m_ReadStream->Seek( 0 );
+	uint32_t numFiles = 0;
+	m_ReadStream->Read( numFiles );
+	return numFiles;
+}
+
 // GetData
 //------------------------------------------------------------------------------
 const void * MultiBuffer::GetData() const
@@ -23,14 +23,18 @@ public:
 	explicit MultiBuffer( const void * data, size_t dataSize );
 	~MultiBuffer();
 
-	bool CreateFromFiles( const Array< AString > & fileNames );
+	// missing files can optionally be recorded (and are deleted on extraction)
+	bool CreateFromFiles( const Array< AString > & fileNames, bool allowMissingFiles = false );
 	bool ExtractFile( size_t index, const AString& fileName ) const;
 
+	uint32_t		GetNumFiles() const;
+
 	const void *	GetData() const;
 	uint64_t		GetDataSize() const;
 
 private:
-	enum : uint32_t { MAX_FILES = 2 };
+	enum : uint32_t { MAX_FILES = 4 };
+	enum : uint64_t { MISSING_FILE_SIZE = 0xFFFFFFFFFFFFFFFFULL };
 
 	ConstMemoryStream *	m_ReadStream;
 	MemoryStream *		m_WriteStream;
@@ -10,6 +10,7 @@
 // FBuild
 #include "Tools/FBuild/FBuildCore/FBuild.h"
 #include "Tools/FBuild/FBuildCore/FBuildVersion.h"
+#include "Tools/FBuild/FBuildCore/Graph/NodeGraph.h"
 #include "Tools/FBuild/FBuildCore/Graph/ObjectNode.h"
 #include "Tools/FBuild/FBuildCore/Helpers/FBuildStats.h"
 
@@ -52,6 +53,8 @@ uint32_t g_ReportNodeColors[Node::NUM_NODE_TYPES] = {
 //------------------------------------------------------------------------------
 Report::Report()
 	: m_LibraryStats( 512, true )
+	, m_CriticalPathInfo( 0, true )
+	, m_BuildStartTime( 0 )
 	, m_NumPieCharts( 0 )
 {
 	// Compile time check to ensure color vector is in sync
@@ -80,6 +83,7 @@ void Report::Generate( const FBuildStats & stats )
 	m_Output.SetLength( 0 );
 
 	// generate some common data used in reporting
+	m_BuildStartTime = stats.m_BuildStartTime;
 	GetLibraryStats( stats );
 
 	// build the report
@@ -89,6 +93,9 @@ void Report::Generate( const FBuildStats & stats )
 
 	CreateOverview( stats );
 
+	DoCriticalPath( stats );
+	DoParallelism( stats );
+
 	DoCPUTimeByType( stats );
 	DoCacheStats( stats );
 	DoCPUTimeByLibrary();
@@ -248,6 +255,57 @@ void Report::CreateHeader()
 		" table.style.display = (table.style.display == \"table\") ? \"none\" : \"table\";\n"
 		"}\n"
 
+		// plotTimeline - local work, idle workers and remote work over time
+		"function plotTimeline(canvasName,local,remote,numWorkers,duration)\n"
+		"{\n"
+		" var canvas = document.getElementById(canvasName);\n"
+		" var ctx = canvas.getContext(\"2d\");\n"
+		" var x0 = 40, y0 = 10, w = canvas.width - 50, h = canvas.height - 60;\n"
+		" var maxY = numWorkers;\n"
+		" for (var i = 0; i < local.length; i++)\n"
+		" {\n"
+		"  maxY = Math.max(maxY, Math.max(local[i], numWorkers) + remote[i]);\n"
+		" }\n"
+		" var barW = w / local.length;\n"
+		" for (var i = 0; i < local.length; i++)\n"
+		" {\n"
+		"  var x = x0 + i * barW;\n"
+		"  var hl = h * local[i] / maxY;\n"
+		"  var hi = h * Math.max(0, numWorkers - local[i]) / maxY;\n"
+		"  var hr = h * remote[i] / maxY;\n"
+		"  ctx.fillStyle = \"#88FF88\";\n"
+		"  ctx.fillRect(x, y0 + h - hl, barW, hl);\n"
+		"  ctx.fillStyle = \"#E0E0E0\";\n"
+		"  ctx.fillRect(x, y0 + h - hl - hi, barW, hi);\n"
+		"  ctx.fillStyle = \"#88AAFF\";\n"
+		"  ctx.fillRect(x, y0 + h - hl - hi - hr, barW, hr);\n"
+		" }\n"
+
+		// axes
+		" ctx.fillStyle = \"black\";\n"
+		" ctx.font = \"12px Arial\";\n"
+		" ctx.fillRect(x0 - 1, y0, 1, h + 1);\n"
+		" ctx.fillRect(x0 - 1, y0 + h, w + 1, 1);\n"
+		" ctx.fillText(maxY.toFixed(0), 5, y0 + 10);\n"
+		" ctx.fillText(\"0\", 5, y0 + h);\n"
+		" for (var i = 0; i <= 4; i++)\n"
+		" {\n"
+		"  ctx.fillText((duration * i / 4).toFixed(1) + \"s\", x0 + (w * i / 4) - ((i == 4) ? 30 : 0), y0 + h + 15);\n"
+		" }\n"
+
+		// legend
+		" var legend = [ [ \"#88FF88\", \"Local\" ], [ \"#E0E0E0\", \"Idle\" ], [ \"#88AAFF\", \"Remote\" ] ];\n"
+		" for (var i = 0; i < legend.length; i++)\n"
+		" {\n"
+		"  ctx.fillStyle = \"#888888\";\n"
+		"  ctx.fillRect(x0 + i * 100 - 1, y0 + h + 27, 14, 14);\n"
+		"  ctx.fillStyle = legend[i][0];\n"
+		"  ctx.fillRect(x0 + i * 100, y0 + h + 28, 12, 12);\n"
+		"  ctx.fillStyle = \"black\";\n"
+		"  ctx.fillText(legend[i][1], x0 + i * 100 + 18, y0 + h + 39);\n"
+		" }\n"
+		"}\n"
+
 		"</script>\n";
 	m_Output += header;
 }
@@ -340,6 +398,273 @@ void Report::CreateOverview( const FBuildStats & stats )
 	DoTableStop();
 }
 
+// DoCriticalPath
+//------------------------------------------------------------------------------
+void Report::DoCriticalPath( const FBuildStats & stats )
+{
+	DoSectionTitle( "Critical Path", "criticalPath" );
+
+	if ( stats.GetNodesByStartTime().IsEmpty() )
+	{
+		Write( "No nodes were built.\n" );
+		return;
+	}
+
+	// reconstruct the executed graph from the build timestamps, working back
+	// from the target to find the chain of nodes which finished last
+	const size_t numNodes = FBuild::Get().GetDependencyGraph().GetNodeCount();
+	m_CriticalPathInfo.SetCapacity( numNodes );
+	m_CriticalPathInfo.SetSize( numNodes );
+	memset( m_CriticalPathInfo.Begin(), 0, numNodes * sizeof( CriticalPathInfo ) );
+	CriticalPathInfo rootInfo;
+	GetCriticalPathRecurse( stats.GetRootNode(), rootInfo );
+
+	// path is discovered in reverse
+	Array< const Node * > path( 256, true );
+	for ( const Node * node = rootInfo.m_LastNode; node; )
+	{
+		path.Append( node );
+		const uint32_t index = node->GetIndex();
+		node = ( index != INVALID_NODE_INDEX ) ? m_CriticalPathInfo[ index ].m_PrevNode : nullptr;
+	}
+	if ( path.IsEmpty() )
+	{
+		Write( "No nodes were built.\n" );
+		return;
+	}
+
+	const float ticksToS = Timer::GetFrequencyInvFloat();
+	const float pathTime = (float)( rootInfo.m_EndTime - m_BuildStartTime ) * ticksToS;
+	const float totalBuildTime = Math::Max( stats.m_TotalBuildTime, pathTime );
+	Write( "<p>%u nodes, completing after %2.3fs (%2.1f%% of build time).</p>\n",
+		   (uint32_t)path.GetSize(),
+		   pathTime,
+		   ( totalBuildTime > 0.0f ) ? ( pathTime / totalBuildTime * 100.0f ) : 0.0f );
+
+	// time contributed by each type of node
+	float typeTimes[ Node::NUM_NODE_TYPES ];
+	memset( typeTimes, 0, sizeof( typeTimes ) );
+	uint64_t prevEnd = m_BuildStartTime;
+	for ( size_t i = path.GetSize(); i > 0; --i )
+	{
+		const Node * node = path[ i - 1 ];
+		const uint64_t end = Math::Max( node->GetBuildEndTime(), prevEnd );
+		typeTimes[ node->GetType() ] += (float)( end - prevEnd ) * ticksToS;
+		prevEnd = end;
+	}
+	Array< PieItem > items( Node::NUM_NODE_TYPES, false );
+	for ( size_t i = 0; i < (size_t)Node::NUM_NODE_TYPES; ++i )
+	{
+		if ( typeTimes[ i ] > 0.0f )
+		{
+			items.Append( PieItem( Node::GetTypeName( (Node::Type)i ), typeTimes[ i ], g_ReportNodeColors[ i ] ) );
+		}
+	}
+	items.Sort();
+	DoPieChart( items, " s" );
+
+	// nodes, in the order they were built
+	DoTableStart();
+	Write( "<tr><th style=\"width:80px;\">Start</th><th style=\"width:80px;\">Waited</th><th style=\"width:80px;\">Duration</th><th style=\"width:80px;\">Contribution</th><th style=\"width:80px;\">Type</th><th>Name</th></tr>\n" );
+
+	size_t numOutput( 0 );
+	prevEnd = m_BuildStartTime;
+	for ( size_t i = path.GetSize(); i > 0; --i )
+	{
+		const Node * node = path[ i - 1 ];
+		const uint64_t start = node->GetBuildStartTime();
+		const uint64_t end = Math::Max( node->GetBuildEndTime(), prevEnd );
+		const float startTime = (float)( start - m_BuildStartTime ) * ticksToS;
+		const float waitTime = ( start > prevEnd ) ? (float)( start - prevEnd ) * ticksToS : 0.0f; // ready, but not yet started
+		const float duration = (float)( node->GetBuildEndTime() - start ) * ticksToS;
+		const float contribution = (float)( end - prevEnd ) * ticksToS;
+		prevEnd = end;
+
+		// start collapsable section
+		if ( numOutput == 10 )
+		{
+			DoToggleSection( path.GetSize() - 10 );
+		}
+
+		Write( ( numOutput == 10 ) ? "<tr></tr><tr><td style=\"width:80px;\">%2.3fs</td><td style=\"width:80px;\">%2.3fs</td><td style=\"width:80px;\">%2.3fs</td><td style=\"width:80px;\">%2.3fs</td><td style=\"width:80px;\">%s</td><td>%s</td></tr>\n"
+								   : "<tr><td>%2.3fs</td><td>%2.3fs</td><td>%2.3fs</td><td>%2.3fs</td><td>%s</td><td>%s</td></tr>\n",
+			   startTime, waitTime, duration, contribution, GetTimelineTypeName( node ), node->GetName().Get() );
+		numOutput++;
+	}
+
+	DoTableStop();
+
+	if ( numOutput > 10 )
+	{
+		Write( "</details>\n" );
+	}
+}
+
+// DoParallelism
+//------------------------------------------------------------------------------
+void Report::DoParallelism( const FBuildStats & stats )
+{
+	DoSectionTitle( "Parallelism", "parallelism" );
+
+	const Array< const Node * > & nodes = stats.GetNodesByStartTime();
+	if ( nodes.IsEmpty() )
+	{
+		Write( "No nodes were built.\n" );
+		return;
+	}
+
+	uint64_t buildEnd = m_BuildStartTime + 1;
+	for ( const Node * node : nodes )
+	{
+		buildEnd = Math::Max( buildEnd, node->GetBuildEndTime() );
+	}
+
+	// average number of active jobs for each slice of the build
+	float local[ NUM_TIMELINE_BUCKETS ];
+	float remote[ NUM_TIMELINE_BUCKETS ];
+	memset( local, 0, sizeof( local ) );
+	memset( remote, 0, sizeof( remote ) );
+	const uint64_t bucketTime = ( ( buildEnd - m_BuildStartTime ) + NUM_TIMELINE_BUCKETS - 1 ) / NUM_TIMELINE_BUCKETS;
+	const double ticksPerMS = ( (double)Timer::GetFrequency() / 1000.0 );
+	for ( const Node * node : nodes )
+	{
+		const uint64_t start = ( node->GetBuildStartTime() - m_BuildStartTime );
+		const uint64_t end = ( node->GetBuildEndTime() - m_BuildStartTime );
+
+		// the remote part of a distributed job is at the end
+		uint64_t localEnd = end;
+		if ( node->GetStatFlag( Node::STATS_BUILT_REMOTE ) )
+		{
+			const uint64_t remoteTime = Math::Min( (uint64_t)( (double)node->GetLastBuildTime() * ticksPerMS ), end - start );
+			localEnd = ( end - remoteTime );
+			AddToTimeline( remote, bucketTime, localEnd, end, 1.0f );
+		}
+
+		// nodes can be in flight longer than they are processed for (i.e. waiting
+		// for a second build pass) so the work is spread over that time
+		if ( localEnd > start )
+		{
+			const double localTime = Math::Min( (double)node->GetProcessingTime() * ticksPerMS, (double)( localEnd - start ) );
+			AddToTimeline( local, bucketTime, start, localEnd, (float)( localTime / (double)( localEnd - start ) ) );
+		}
+	}
+
+	const uint32_t numWorkers = Math::Max< uint32_t >( FBuild::Get().GetOptions().m_NumWorkerThreads, 1 );
+	const float duration = (float)( buildEnd - m_BuildStartTime ) * Timer::GetFrequencyInvFloat();
+	DoTimelineChart( local, remote, numWorkers, duration );
+
+	float localTotal = 0.0f;
+	float remoteTotal = 0.0f;
+	float localPeak = 0.0f;
+	for ( size_t i = 0; i < NUM_TIMELINE_BUCKETS; ++i )
+	{
+		localTotal += local[ i ];
+		remoteTotal += remote[ i ];
+		localPeak = Math::Max( localPeak, local[ i ] );
+	}
+	const float localAverage = ( localTotal / NUM_TIMELINE_BUCKETS );
+	const float remoteAverage = ( remoteTotal / NUM_TIMELINE_BUCKETS );
+
+	DoTableStart();
+	Write( "<tr><th width=150>Item</th><th>Details</th></tr>\n" );
+	Write( "<tr><td>Local Workers</td><td>%u</td></tr>\n", numWorkers );
+	Write( "<tr><td>Local Jobs</td><td>%2.1f average, %2.1f peak</td></tr>\n", localAverage, localPeak );
+	Write( "<tr><td>Local Utilization</td><td>%2.1f%%</td></tr>\n", Math::Min( localAverage / (float)numWorkers * 100.0f, 100.0f ) );
+	Write( "<tr><td>Remote Jobs</td><td>%2.1f average</td></tr>\n", remoteAverage );
+	DoTableStop();
+
+	// find the nodes which serialized the build (nothing else was in flight)
+	Array< TimelineEvent > events( nodes.GetSize() * 2, false );
+	for ( size_t i = 0; i < nodes.GetSize(); ++i )
+	{
+		const Node * node = nodes[ i ];
+		if ( node->GetType() == Node::FILE_NODE )
+		{
+			continue; // input files are only checked, and checking them doesn't block other work
+		}
+		TimelineEvent e;
+		e.m_NodeIndex = (uint32_t)i;
+		e.m_Time = node->GetBuildStartTime();
+		e.m_IsStart = true;
+		events.Append( e );
+		e.m_Time = node->GetBuildEndTime();
+		e.m_IsStart = false;
+		events.Append( e );
+	}
+	events.Sort();
+
+	Array< uint64_t > serialTimes( nodes.GetSize(), false );
+	serialTimes.SetSize( nodes.GetSize() );
+	memset( serialTimes.Begin(), 0, nodes.GetSize() * sizeof( uint64_t ) );
+	uint32_t numActive = 0;
+	uint64_t activeSum = 0; // when only one node is active, this is its index
+	uint64_t lastTime = m_BuildStartTime;
+	uint64_t totalSerialTime = 0;
+	for ( const TimelineEvent & e : events )
+	{
+		if ( numActive == 1 )
+		{
+			serialTimes[ (size_t)activeSum ] += ( e.m_Time - lastTime );
+			totalSerialTime += ( e.m_Time - lastTime );
+		}
+		lastTime = e.m_Time;
+		numActive = e.m_IsStart ? ( numActive + 1 ) : ( numActive - 1 );
+		activeSum = e.m_IsStart ? ( activeSum + e.m_NodeIndex ) : ( activeSum - e.m_NodeIndex );
+	}
+
+	Array< SerialStats > serialStats( 32, true );
+	const uint64_t minSerialTime = (uint64_t)( ticksPerMS + 0.5 ); // ignore noise
+	for ( size_t i = 0; i < nodes.GetSize(); ++i )
+	{
+		if ( serialTimes[ i ] >= minSerialTime )
+		{
+			SerialStats ss;
+			ss.node = nodes[ i ];
+			ss.serialTime = serialTimes[ i ];
+			serialStats.Append( ss );
+		}
+	}
+	serialStats.Sort();
+
+	const float ticksToS = Timer::GetFrequencyInvFloat();
+	Write( "<h3>Serializing Nodes</h3>\n" );
+	Write( "<p>Nodes which were the only work in progress for %2.3fs (%2.1f%% of build time).</p>\n",
+		   (float)totalSerialTime * ticksToS,
+		   (float)totalSerialTime * ticksToS / duration * 100.0f );
+	if ( serialStats.IsEmpty() )
+	{
+		return;
+	}
+
+	DoTableStart();
+	Write( "<tr><th style=\"width:80px;\">Time</th><th style=\"width:50px;\">%%</th><th style=\"width:80px;\">Type</th><th>Name</th></tr>\n" );
+
+	size_t numOutput( 0 );
+	for ( const SerialStats & ss : serialStats )
+	{
+		const float time = (float)ss.serialTime * ticksToS;
+		const float perc = ( time / duration * 100.0f );
+
+		// start collapsable section
+		if ( numOutput == 10 )
+		{
+			DoToggleSection( serialStats.GetSize() - 10 );
+		}
+
+		Write( ( numOutput == 10 ) ? "<tr></tr><tr><td style=\"width:80px;\">%2.3fs</td><td style=\"width:50px;\">%2.1f</td><td style=\"width:80px;\">%s</td><td>%s</td></tr>\n"
+								   : "<tr><td>%2.3fs</td><td>%2.1f</td><td>%s</td><td>%s</td></tr>\n",
+			   time, perc, GetTimelineTypeName( ss.node ), ss.node->GetName().Get() );
+		numOutput++;
+	}
+
+	DoTableStop();
+
+	if ( numOutput > 10 )
+	{
+		Write( "</details>\n" );
+	}
+}
+
 // DoCacheStats
 //------------------------------------------------------------------------------
 void Report::DoCacheStats( const FBuildStats & stats )
@@ -766,6 +1091,39 @@ void Report::DoPieChart( const Array< PieItem > & items, const char * units )
 	Write( "</section>\n" );
 }
 
+// DoTimelineChart
+//------------------------------------------------------------------------------
+void Report::DoTimelineChart( const float * local, const float * remote, uint32_t numWorkers, float duration )
+{
+	AStackString<> buffer;
+
+	m_NumPieCharts++;
+
+	Write( "<section>\n" );
+	Write( "<div>\n" );
+	Write( "<canvas id=\"canvas%u\" width=\"%u\" height=\"240\">\n", m_NumPieCharts, (uint32_t)DEFAULT_TABLE_WIDTH );
+	Write( "HTML5 Canvas support required.\n" );
+	Write( "</canvas>\n" );
+	Write( "</div>\n" );
+
+	Write( "<script type=\"text/javascript\">\n" );
+	const float * const series[ 2 ] = { local, remote };
+	const char * const seriesNames[ 2 ] = { "local", "remote" };
+	for ( size_t s = 0; s < 2; ++s )
+	{
+		Write( "	var %s = [", seriesNames[ s ] );
+		for ( size_t i = 0; i < NUM_TIMELINE_BUCKETS; ++i )
+		{
+			buffer.Format( ( i > 0 ) ? ",%2.2f" : "%2.2f", series[ s ][ i ] );
+			Write( buffer.Get() );
+		}
+		Write( "];\n" );
+	}
+	Write( "	plotTimeline(\"canvas%u\",local,remote,%u,%2.3f);\n", m_NumPieCharts, numWorkers, duration );
+	Write( "</script>\n" );
+	Write( "</section>\n" );
+}
+
 // CreateFooter
 //------------------------------------------------------------------------------
 void Report::CreateFooter()
@@ -1018,6 +1376,103 @@ void Report::AddInclude( IncludeStatsMap & incStats, const Node * node, const No
 	stats->inPCH |= isHeaderInPCH;
 }
 
+// GetCriticalPathRecurse
+//------------------------------------------------------------------------------
+void Report::GetCriticalPathRecurse( const Node * node, CriticalPathInfo & info )
+{
+	// already visited through another path?
+	const uint32_t index = node->GetIndex();
+	if ( ( index != INVALID_NODE_INDEX ) && m_CriticalPathInfo[ index ].m_Visited )
+	{
+		info = m_CriticalPathInfo[ index ];
+		return;
+	}
+
+	// find the dependency which completed last
+	CriticalPathInfo latest;
+	memset( &latest, 0, sizeof( latest ) );
+	GetCriticalPathRecurse( node->GetPreBuildDependencies(), latest );
+	GetCriticalPathRecurse( node->GetStaticDependencies(), latest );
+	GetCriticalPathRecurse( node->GetDynamicDependencies(), latest );
+
+	info.m_Visited = true;
+	if ( WasProcessed( node ) )
+	{
+		// this node completes the path
+		info.m_EndTime = Math::Max( node->GetBuildEndTime(), latest.m_EndTime );
+		info.m_LastNode = node;
+		info.m_PrevNode = latest.m_LastNode;
+	}
+	else
+	{
+		// nodes with no work (i.e. aliases) pass through their dependencies
+		info.m_EndTime = latest.m_EndTime;
+		info.m_LastNode = latest.m_LastNode;
+		info.m_PrevNode = nullptr;
+	}
+
+	if ( index != INVALID_NODE_INDEX )
+	{
+		m_CriticalPathInfo[ index ] = info;
+	}
+}
+
+// GetCriticalPathRecurse
+//------------------------------------------------------------------------------
+void Report::GetCriticalPathRecurse( const Dependencies & dependencies, CriticalPathInfo & latest )
+{
+	const Dependencies::Iter end = dependencies.End();
+	for ( Dependencies::Iter it = dependencies.Begin(); it != end; ++it )
+	{
+		CriticalPathInfo info;
+		GetCriticalPathRecurse( it->GetNode(), info );
+		if ( info.m_LastNode && ( ( latest.m_LastNode == nullptr ) || ( info.m_EndTime > latest.m_EndTime ) ) )
+		{
+			latest = info;
+		}
+	}
+}
+
+// WasProcessed
+//------------------------------------------------------------------------------
+bool Report::WasProcessed( const Node * node ) const
+{
+	// timestamps can be left over from earlier builds in the same process
+	return ( node->GetBuildStartTime() >= m_BuildStartTime ) &&
+		   ( node->GetBuildStartTime() != 0 ) &&
+		   ( node->GetBuildEndTime() >= node->GetBuildStartTime() );
+}
+
+// GetTimelineTypeName
+//------------------------------------------------------------------------------
+/*static*/ const char * Report::GetTimelineTypeName( const Node * node )
+{
+	// PCH creation is called out, since it blocks all objects using it
+	if ( ( node->GetType() == Node::OBJECT_NODE ) && node->CastTo< ObjectNode >()->IsCreatingPCH() )
+	{
+		return "Obj (PCH)";
+	}
+	return node->GetTypeName();
+}
+
+// AddToTimeline
+//------------------------------------------------------------------------------
+/*static*/ void Report::AddToTimeline( float * buckets, uint64_t bucketTime, uint64_t start, uint64_t end, float density )
+{
+	// times are relative to the start of the first bucket
+	for ( uint64_t bucket = ( start / bucketTime ); bucket < NUM_TIMELINE_BUCKETS; ++bucket )
+	{
+		const uint64_t bucketStart = ( bucket * bucketTime );
+		const uint64_t bucketEnd = ( bucketStart + bucketTime );
+		if ( bucketStart >= end )
+		{
+			break;
+		}
+		const uint64_t overlap = ( Math::Min( end, bucketEnd ) - Math::Max( start, bucketStart ) );
+		buckets[ bucket ] += density * (float)( (double)overlap / (double)bucketTime );
+	}
+}
+
 // IncludeStatsMap (CONSTRUCTOR)
 //------------------------------------------------------------------------------
 Report::IncludeStatsMap::IncludeStatsMap()
@@ -32,6 +32,8 @@ private:
 	void CreateHeader();
 	void CreateTitle();
 	void CreateOverview( const FBuildStats & stats );
+	void DoCriticalPath( const FBuildStats & stats );
+	void DoParallelism( const FBuildStats & stats );
 	void DoCacheStats( const FBuildStats & stats );
 	void DoCPUTimeByType( const FBuildStats & stats );
 	void DoCPUTimeByItem( const FBuildStats & stats );
@@ -97,7 +99,34 @@ private:
 		MemPoolBlock m_Pool;
 	};
 
+	struct CriticalPathInfo
+	{
+		uint64_t		m_EndTime;	// when the last processed node (this or a dependency) completed
+		const Node *	m_LastNode; // the node which completed at m_EndTime
+		const Node *	m_PrevNode; // for processed nodes, the last node this one waited on
+		bool			m_Visited;
+	};
+
+	struct TimelineEvent
+	{
+		uint64_t	m_Time;
+		uint32_t	m_NodeIndex;
+		bool		m_IsStart;
+
+		// ends are sorted before starts at the same time
+		bool operator < ( const TimelineEvent & other ) const { return ( m_Time < other.m_Time ) || ( ( m_Time == other.m_Time ) && ( m_IsStart < other.m_IsStart ) ); }
+	};
+
+	struct SerialStats
+	{
+		const Node *	node;
+		uint64_t		serialTime;
+
+		bool operator < ( const SerialStats & other ) const { return serialTime > other.serialTime; }
+	};
+
 	enum { DEFAULT_TABLE_WIDTH = 990 };
+	enum { NUM_TIMELINE_BUCKETS = 200 };
 
 	// Helpers
 	void DoTableStart( int width = DEFAULT_TABLE_WIDTH, const char * id = nullptr, bool hidden = false );
@@ -105,6 +134,7 @@ private:
 	void DoToggleSection( size_t numMore = 0 );
 	void DoSectionTitle( const char * sectionName, const char * sectionId );
 	void DoPieChart( const Array< PieItem > & items, const char * units );
+	void DoTimelineChart( const float * local, const float * remote, uint32_t numWorkers, float duration );
 
 	// Helper to format some text
 	void Write( const char * fmtString, ... );
@@ -115,9 +145,16 @@ private:
 	void GetLibraryStatsRecurse( Array< LibraryStats * > & libStats, const Dependencies & dependencies, LibraryStats * currentLib ) const;
 	void GetIncludeFilesRecurse( IncludeStatsMap & incStats, const Node * node) const;
 	void AddInclude( IncludeStatsMap & incStats, const Node * node, const Node * parentNode) const;
+	void GetCriticalPathRecurse( const Node * node, CriticalPathInfo & info );
+	void GetCriticalPathRecurse( const Dependencies & dependencies, CriticalPathInfo & latest );
+	bool WasProcessed( const Node * node ) const;
+	static const char * GetTimelineTypeName( const Node * node );
+	static void AddToTimeline( float * buckets, uint64_t bucketTime, uint64_t start, uint64_t end, float density );
 
 	// intermediate collected data
 	Array< LibraryStats * > m_LibraryStats;
+	Array< CriticalPathInfo > m_CriticalPathInfo; // indexed by node index
+	uint64_t m_BuildStartTime;
 	uint32_t m_NumPieCharts;
 
 	// final output
@@ -15,6 +15,7 @@
 // Core
 #include "Core/FileIO/FileIO.h"
 #include "Core/FileIO/PathUtils.h"
+#include "Core/Mem/ScratchArena.h"
 
 // CONSTRUCTOR
 //------------------------------------------------------------------------------
@@ -46,14 +47,14 @@ bool ResponseFile::Create( const AString & contents )
 {
 	if ( m_EscapeSlashes )
 	{
-		AStackString< 1024 > fixed;
-		if ( contents.GetLength() > 512 )
-		{
-			fixed.SetReserved( contents.GetLength() * 2 );
-		}
+		// build the escaped copy in scratch memory
+		ScratchArena & arena = ScratchArena::GetThreadArena();
+		ScratchArena::Scope scratchScope( arena );
+		char * fixed = (char *)arena.Alloc( (size_t)contents.GetLength() * 2, 1 );
+
 		const char * it = contents.Get();
 		const char * end = contents.GetEnd();
-		char * dst = fixed.Get();
+		char * dst = fixed;
 		while ( it != end )
 		{
 			char c = *it;
@@ -65,20 +66,19 @@ bool ResponseFile::Create( const AString & contents )
 			else
 			{
 				*dst = c; dst++;
-			}			
+			}
 			it++;
 		}
-		fixed.SetLength( (uint32_t)( dst - fixed.Get() ) );
 
-		return CreateInternal( fixed );
+		return CreateInternal( fixed, (size_t)( dst - fixed ) );
 	}
 
-	return CreateInternal( contents );
+	return CreateInternal( contents.Get(), contents.GetLength() );
 }
 
 // CreateInternal
 //------------------------------------------------------------------------------
-bool ResponseFile::CreateInternal( const AString & contents )
+bool ResponseFile::CreateInternal( const char * contents, size_t size )
 {
 	// store in tmp folder, and give back to user
 	WorkerThread::CreateTempFilePath( "args.rsp", m_ResponseFilePath );
@@ -92,7 +92,7 @@ bool ResponseFile::CreateInternal( const AString & contents )
 		return false; // user must handle error
 	}
 
-	bool ok = ( m_File.Write( contents.Get(), contents.GetLength() ) == contents.GetLength() );
+	bool ok = ( m_File.Write( contents, size ) == size );
 	if ( !ok )
 	{
 		FLOG_ERROR( "Failed to write response file '%s'", m_ResponseFilePath.Get() );
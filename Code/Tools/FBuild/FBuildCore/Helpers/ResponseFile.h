@@ -28,7 +28,7 @@ public:
 
 	void SetEscapeSlashes() { m_EscapeSlashes = true; }
 private:
-	bool CreateInternal( const AString & contents );
+	bool CreateInternal( const char * contents, size_t size );
 
 	FileStream m_File;
 	AStackString<> m_ResponseFilePath;
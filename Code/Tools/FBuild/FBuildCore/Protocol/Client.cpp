@@ -14,6 +14,7 @@
 #include "Tools/FBuild/FBuildCore/Graph/FileNode.h"
 #include "Tools/FBuild/FBuildCore/Graph/Node.h"
 #include "Tools/FBuild/FBuildCore/Graph/ObjectNode.h"
+#include "Tools/FBuild/FBuildCore/Helpers/BuildTrace.h"
 #include "Tools/FBuild/FBuildCore/WorkerPool/Job.h"
 #include "Tools/FBuild/FBuildCore/WorkerPool/JobQueue.h"
 
@@ -437,6 +438,7 @@ void Client::Process( const ConnectionInfo * connection, const Protocol::MsgRequ
 	MutexHolder mh( ss->m_Mutex );
 
 	ss->m_Jobs.Append( job ); // Track in-flight job
+	job->SetDispatchTime( (uint64_t)Timer::GetNow() );
 
 	// if tool is explicity specified, get the id of the tool manifest
 	Node * n = job->GetNode()->CastTo< ObjectNode >()->GetCompiler();
@@ -509,6 +511,18 @@ void Client::Process( const ConnectionInfo * connection, const Protocol::MsgJobR
 		return;
 	}
 
+	if ( BuildTrace::IsEnabled() )
+	{
+		const size_t workerIndex = ( ss - m_ServerList.Begin() );
+		BuildTrace::AddEvent( job->GetNode(),
+							  BuildTrace::PHASE_REMOTE,
+							  job->GetDispatchTime(),
+							  (uint64_t)Timer::GetNow(),
+							  job->GetDispatchTime() - job->GetQueuedTime(),
+							  job->GetDataSize() + payloadSize, // sent + received
+							  &m_WorkerList[ workerIndex ] );
+	}
+
 	if ( result == true )
 	{
 		// built ok - serialize to disc
@@ -563,9 +577,11 @@ void Client::Process( const ConnectionInfo * connection, const Protocol::MsgJobR
 				fs.Close();
 				FileNode * f = (FileNode *)job->GetNode();
 				f->m_Stamp = FileIO::GetFileLastWriteTime( nodeName );
+				f->UpdateContentHash();
 
 				// record time taken to build
-				f->SetLastBuildTime( buildTime );
+				f->RecordBuildTime( BuildTimeHistory::REMOTE, buildTime );
+				f->RecordBuildEnd( (uint64_t)Timer::GetNow() );
 				f->SetStatFlag(Node::STATS_BUILT);
 				f->SetStatFlag(Node::STATS_BUILT_REMOTE);
 
@@ -16,6 +16,7 @@
 #include "Core/Process/Atomic.h"
 #include "Core/Profile/Profile.h"
 #include "Core/Strings/AStackString.h"
+#include "Core/Time/Timer.h"
 
 
 // Static
@@ -32,7 +33,14 @@ Job::Job( Node * node )
 	, m_DataIsCompressed( false )
 	, m_IsLocal( true )
 	, m_SystemErrorCount( 0 )
+	, m_ResourcePoolMemoryMiB( 0 )
+	, m_HeldBack( false )
+	, m_InFlightOwner( false )
+	, m_WasDeferred( false )
 	, m_ToolManifest( nullptr )
+	, m_QueuedTime( (uint64_t)Timer::GetNow() )
+	, m_DispatchTime( 0 )
+	, m_CompletedNext( nullptr )
 {
 	m_JobId = AtomicIncU32( &s_LastJobId );
 }
@@ -46,7 +54,14 @@ Job::Job( IOStream & stream )
 	, m_UserData( nullptr )
 	, m_IsLocal( false )
 	, m_SystemErrorCount( 0 )
+	, m_ResourcePoolMemoryMiB( 0 )
+	, m_HeldBack( false )
+	, m_InFlightOwner( false )
+	, m_WasDeferred( false )
 	, m_ToolManifest( nullptr )
+	, m_QueuedTime( (uint64_t)Timer::GetNow() )
+	, m_DispatchTime( 0 )
+	, m_CompletedNext( nullptr )
 {
 	Deserialize( stream );
 }
@@ -33,6 +33,9 @@ public:
 	inline void SetCacheName( const AString & cacheName ) { m_CacheName = cacheName; }
 	inline const AString & GetCacheName() const { return m_CacheName; }
 
+	// job waited for an identical compilation (preprocessing etc. already done)
+	inline bool		WasDeferred() const { return m_WasDeferred; }
+
 	// associate some data with this object, and destroy it when freed
 	void	OwnData( void * data, size_t size, bool compressed = false );
 
@@ -48,6 +51,12 @@ public:
 	inline bool		IsDataCompressed() const { return m_DataIsCompressed; }
 	inline bool		IsLocal() const		{ return m_IsLocal; }
 
+	// timing (for build trace)
+	inline void		SetQueuedTime( uint64_t time )		{ m_QueuedTime = time; }
+	inline uint64_t	GetQueuedTime() const				{ return m_QueuedTime; }
+	inline void		SetDispatchTime( uint64_t time )	{ m_DispatchTime = time; }
+	inline uint64_t	GetDispatchTime() const				{ return m_DispatchTime; }
+
 	inline const Array< AString > & GetMessages() const { return m_Messages; }
 
 	// logging interface
@@ -62,6 +71,9 @@ public:
 	void Deserialize( IOStream & stream );
 
 private:
+	friend class JobQueue; // for m_CompletedNext
+	friend class JobSubQueue; // for resource pool state
+
 	uint32_t m_JobId;
 	Node * m_Node;
 	void * m_Data;
@@ -70,12 +82,20 @@ private:
 	bool m_DataIsCompressed;
 	bool m_IsLocal;
 	uint8_t m_SystemErrorCount; // On client, the total error count, on the worker a flag for the current attempt
+	uint32_t m_ResourcePoolMemoryMiB; // memory reserved in the node's pool while the job is active
+	bool m_HeldBack;			// job has waited for capacity in its resource pool
+	bool m_InFlightOwner;		// job is building output that identical jobs may wait for
+	bool m_WasDeferred;			// job was deferred until an identical job completed
 	AString m_RemoteName;
 	AString m_CacheName;
 
 	ToolManifest * m_ToolManifest;
+	uint64_t m_QueuedTime;		// when job was (last) made available
+	uint64_t m_DispatchTime;	// when job was sent to a remote worker
 
 	Array< AString > m_Messages;
+
+	Job * m_CompletedNext;		// intrusive link for JobQueue completion queues
 };
 
 //------------------------------------------------------------------------------
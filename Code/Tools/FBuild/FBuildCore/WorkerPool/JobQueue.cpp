@@ -13,9 +13,12 @@
 #include "Tools/FBuild/FBuildCore/FLog.h"
 #include "Tools/FBuild/FBuildCore/Graph/Node.h"
 #include "Tools/FBuild/FBuildCore/Graph/ObjectNode.h"
+#include "Tools/FBuild/FBuildCore/Helpers/BuildTrace.h"
 
 #include "Core/Time/Timer.h"
 #include "Core/FileIO/FileIO.h"
+#include "Core/Math/xxHash.h"
+#include "Core/Mem/ScratchArena.h"
 #include "Core/Process/Atomic.h"
 #include "Core/Profile/Profile.h"
 
@@ -58,29 +61,28 @@ void JobSubQueue::QueueJobs( Array< Node * > & nodes )
         jobs.Append( job );
     }
 
+	QueueJobs( jobs );
+}
+
+// JobSubQueue:QueueJobs
+//------------------------------------------------------------------------------
+void JobSubQueue::QueueJobs( Array< Job * > & jobs )
+{
     // Sort Jobs by cost
 	JobCostSorter sorter;
 	jobs.Sort( sorter );
 
 	// lock to add job
 	MutexHolder mh( m_Mutex );
-    const bool wasEmpty = m_Jobs.IsEmpty();
 
-	m_Jobs.Append( jobs );
+	// merge with already sorted jobs
+	m_Jobs.MergeSorted( jobs, sorter );
     m_Count += (uint32_t)jobs.GetSize();
-
-    if ( wasEmpty )
-    {
-        return; // skip re-sorting
-    }
-
-    // sort merged lists
-	m_Jobs.Sort( sorter );
 }
 
 // RemoveJob
 //------------------------------------------------------------------------------
-Job * JobSubQueue::RemoveJob()
+Job * JobSubQueue::RemoveJob( bool honorResourcePools )
 {
 	// lock-free early out if there are no jobs
 	if ( m_Count == 0 )
@@ -97,13 +99,55 @@ Job * JobSubQueue::RemoveJob()
 		return nullptr;
 	}
 
-	ASSERT( m_Count );
-	--m_Count;
+	// take the most expensive job which can start, leaving jobs waiting
+	// for capacity in their resource pool queued
+	for ( size_t i = m_Jobs.GetSize(); i > 0; --i )
+	{
+		Job ** it = ( m_Jobs.Begin() + ( i - 1 ) );
+		Job * job = *it;
+
+		const uint32_t poolIndex = job->GetNode()->GetResourcePool();
+		if ( honorResourcePools && ( poolIndex != 0 ) )
+		{
+			ResourcePool & pool = FBuild::Get().GetResourcePool( poolIndex - 1 );
+			const uint32_t nodeMemoryMiB = job->GetNode()->GetResourcePoolJobMemoryMiB();
+			const uint32_t jobMemoryMiB = nodeMemoryMiB ? nodeMemoryMiB : pool.GetJobMemoryMiB();
+			if ( pool.CanStartJob( jobMemoryMiB ) == false )
+			{
+				if ( job->m_HeldBack == false )
+				{
+					job->m_HeldBack = true;
+					pool.OnJobHeldBack();
+				}
+				continue;
+			}
+			pool.OnJobStarted( jobMemoryMiB );
+			job->m_ResourcePoolMemoryMiB = jobMemoryMiB;
+		}
+
+		ASSERT( m_Count );
+		--m_Count;
+
+		m_Jobs.Erase( it );
+		return job;
+	}
+
+	return nullptr; // all jobs are held back
+}
 
-	Job * job = m_Jobs.Top();
-	m_Jobs.Pop();
+// ReleaseResourcePool
+//------------------------------------------------------------------------------
+bool JobSubQueue::ReleaseResourcePool( Job * job )
+{
+	const uint32_t poolIndex = job->GetNode()->GetResourcePool();
+	if ( poolIndex == 0 )
+	{
+		return false;
+	}
 
-	return job;
+	MutexHolder mh( m_Mutex );
+	FBuild::Get().GetResourcePool( poolIndex - 1 ).OnJobFinished( job->m_ResourcePoolMemoryMiB );
+	return true;
 }
 
 // CONSTRUCTOR
@@ -115,16 +159,15 @@ JobQueue::JobQueue( uint32_t numWorkerThreads ) :
 	m_DistributedJobsRemote( 1204, true ),
 	m_DistributedJobsLocal( 128, true ),
 	m_DistributedJobsCancelled( 128, true ),
-	m_CompletedJobs( 1024, true ),
-	m_CompletedJobsFailed( 1024, true ),
-	m_CompletedJobs2( 1024, true ),
-	m_CompletedJobsFailed2( 1024, true ),
+	m_MainThreadWaiting( 0 ),
 	m_Workers( numWorkerThreads, false )
 {
     PROFILE_FUNCTION
 
 	WorkerThread::InitTmpDir();
 
+	memset( m_InFlightMap, 0, sizeof( m_InFlightMap ) );
+
 	for ( uint32_t i=0; i<numWorkerThreads; ++i )
 	{
 		// identify each worker with an id starting from 1
@@ -146,7 +189,7 @@ JobQueue::~JobQueue()
 	// delete incomplete jobs
 	while( m_LocalJobs_Available.GetCount() > 0 )
 	{
-		Job * job = m_LocalJobs_Available.RemoveJob();
+		Job * job = m_LocalJobs_Available.RemoveJob( false ); // ignore resource pools
 		FDELETE job;
 	}
 
@@ -158,6 +201,22 @@ JobQueue::~JobQueue()
 		FDELETE m_Workers[ i ];
 	}
 
+	// delete jobs still waiting on identical jobs (if build was aborted)
+	for ( size_t i=0; i<IN_FLIGHT_TABLE_SIZE; ++i )
+	{
+		InFlightCompilation * ifc = m_InFlightMap[ i ];
+		while ( ifc )
+		{
+			InFlightCompilation * next = ifc->m_Next;
+			for ( Job * job : ifc->m_DeferredJobs )
+			{
+				FDELETE job;
+			}
+			FDELETE ifc;
+			ifc = next;
+		}
+	}
+
     ASSERT( m_CompletedJobs.IsEmpty() );
     ASSERT( m_CompletedJobsFailed.IsEmpty() );
 }
@@ -228,6 +287,7 @@ void JobQueue::AddJobToBatch( Node * node )
 
 	// mark as building
 	node->SetState( Node::BUILDING );
+	node->ResetBuildTimestamps();
 
 	// trivial build tasks are processed immediately and returned
 	if ( node->GetControlFlags() & Node::FLAG_TRIVIAL_BUILD )
@@ -266,6 +326,7 @@ void JobQueue::QueueJob2( Job * job )
 {
 	ASSERT( job->GetNode()->GetState() == Node::BUILDING );
 
+	job->SetQueuedTime( (uint64_t)Timer::GetNow() );
 	{
 		MutexHolder m( m_DistributableAvailableJobsMutex );
 		m_DistributableAvailableJobs.Append( job );
@@ -274,12 +335,120 @@ void JobQueue::QueueJob2( Job * job )
 		m_DistributableJobsMemoryUsage += job->GetDataSize();
 	}
 
+	ASSERT( job->GetNode()->GetResourcePool() == 0 ); // distributable jobs aren't pooled
 	ASSERT( m_NumLocalJobsActive > 0 );
 	AtomicDecU32( &m_NumLocalJobsActive ); // job converts from active to pending remote
 
     m_WorkerThreadSemaphore.Signal();
 }
 
+// DeferJob
+//------------------------------------------------------------------------------
+void JobQueue::DeferJob( Job * job )
+{
+	ASSERT( job->GetNode()->GetState() == Node::BUILDING );
+
+	ASSERT( m_NumLocalJobsActive > 0 );
+	AtomicDecU32( &m_NumLocalJobsActive ); // job converts from active to waiting
+
+	// don't hold resource pool capacity while waiting
+	if ( m_LocalJobs_Available.ReleaseResourcePool( job ) )
+	{
+		m_WorkerThreadSemaphore.Signal();
+	}
+
+	job->m_WasDeferred = true;
+
+	{
+		MutexHolder m( m_InFlightMutex );
+		uint32_t bucket;
+		InFlightCompilation * ifc = FindInFlightCompilation( job->GetCacheName(), bucket );
+		ASSERT( ifc );
+		if ( ifc->m_State == IN_FLIGHT_BUILDING )
+		{
+			// wait for identical job to complete
+			ifc->m_DeferredJobs.Append( job );
+			return;
+		}
+	}
+
+	// identical job completed since the caller checked, so run again right away
+	Array< Job * > jobs( 1, false );
+	jobs.Append( job );
+	m_LocalJobs_Available.QueueJobs( jobs );
+	m_WorkerThreadSemaphore.Signal();
+}
+
+// RegisterInFlightCompilation (Worker Thread)
+//------------------------------------------------------------------------------
+JobQueue::InFlightState JobQueue::RegisterInFlightCompilation( Job * job, const AString & cacheName, const Node * & builtBy )
+{
+	ASSERT( cacheName.IsEmpty() == false );
+
+	MutexHolder m( m_InFlightMutex );
+
+	uint32_t bucket;
+	InFlightCompilation * ifc = FindInFlightCompilation( cacheName, bucket );
+	if ( ifc == nullptr )
+	{
+		ifc = FNEW( InFlightCompilation );
+		ifc->m_CacheName = cacheName;
+		ifc->m_Next = m_InFlightMap[ bucket ];
+		m_InFlightMap[ bucket ] = ifc;
+	}
+	else if ( ifc->m_State != IN_FLIGHT_FAILED )
+	{
+		builtBy = ifc->m_Node;
+		return ifc->m_State;
+	}
+
+	// no identical job, or it failed - this job builds the output
+	ifc->m_Node = job->GetNode();
+	ifc->m_State = IN_FLIGHT_BUILDING;
+	job->m_InFlightOwner = true;
+	return IN_FLIGHT_NONE;
+}
+
+// CompleteInFlightCompilation
+//------------------------------------------------------------------------------
+void JobQueue::CompleteInFlightCompilation( Job * job, bool success )
+{
+	ASSERT( job->m_InFlightOwner );
+
+	Array< Job * > deferredJobs;
+	{
+		MutexHolder m( m_InFlightMutex );
+		uint32_t bucket;
+		InFlightCompilation * ifc = FindInFlightCompilation( job->GetCacheName(), bucket );
+		ASSERT( ifc && ( ifc->m_Node == job->GetNode() ) );
+		ifc->m_State = success ? IN_FLIGHT_SUCCEEDED : IN_FLIGHT_FAILED;
+		deferredJobs.Swap( ifc->m_DeferredJobs );
+	}
+
+	// jobs waiting for this one can now use the output (or build it themselves on failure)
+	if ( deferredJobs.IsEmpty() == false )
+	{
+		const uint32_t numJobs = (uint32_t)deferredJobs.GetSize();
+		m_LocalJobs_Available.QueueJobs( deferredJobs );
+		m_WorkerThreadSemaphore.Signal( numJobs );
+	}
+}
+
+// FindInFlightCompilation
+//------------------------------------------------------------------------------
+JobQueue::InFlightCompilation * JobQueue::FindInFlightCompilation( const AString & cacheName, uint32_t & bucket ) const
+{
+	bucket = ( xxHash::Calc32( cacheName.Get(), cacheName.GetLength() ) & ( IN_FLIGHT_TABLE_SIZE - 1 ) );
+	for ( InFlightCompilation * ifc = m_InFlightMap[ bucket ]; ifc; ifc = ifc->m_Next )
+	{
+		if ( ifc->m_CacheName == cacheName )
+		{
+			return ifc;
+		}
+	}
+	return nullptr;
+}
+
 // GetDistributableJobToProcess
 //------------------------------------------------------------------------------
 Job * JobQueue::GetDistributableJobToProcess( bool remote )
@@ -292,9 +461,19 @@ Job * JobQueue::GetDistributableJobToProcess( bool remote )
 			return nullptr;
 		}
 
-		// building jobs in the order they are queued
-		job = m_DistributableAvailableJobs[ 0 ];
-		m_DistributableAvailableJobs.PopFront();
+		// take the job with the longest path to completion, so the
+		// critical path is started first (oldest job wins ties)
+		Job ** best = m_DistributableAvailableJobs.Begin();
+		Job * const * const end = m_DistributableAvailableJobs.End();
+		for ( Job ** it = best + 1; it != end; ++it )
+		{
+			if ( ( *it )->GetNode()->GetRecursiveCost() > ( *best )->GetNode()->GetRecursiveCost() )
+			{
+				best = it;
+			}
+		}
+		job = *best;
+		m_DistributableAvailableJobs.Erase( best );
 
 		// track size of distributable jobs
 		m_DistributableJobsMemoryUsage -= job->GetDataSize();
@@ -390,6 +569,7 @@ void JobQueue::ReturnUnfinishedDistributableJob( Job * job, bool systemError )
 	}
 
 	// re-queue job
+	job->SetQueuedTime( (uint64_t)Timer::GetNow() );
 	{
 		MutexHolder m( m_DistributableAvailableJobsMutex );
 		m_DistributableAvailableJobs.Append( job );
@@ -407,23 +587,23 @@ void JobQueue::FinalizeCompletedJobs( NodeGraph & nodeGraph )
 {
     PROFILE_FUNCTION
 
-	{
-		MutexHolder m( m_CompletedJobsMutex );
-		m_CompletedJobs2.Swap( m_CompletedJobs );
-		m_CompletedJobsFailed2.Swap( m_CompletedJobsFailed );
-	}
-
 	// completed jobs
-	const Job * const * end = m_CompletedJobs2.End();
-	for ( Job ** i = m_CompletedJobs2.Begin();
-			i != end;
-			i++ )
+	Job * next = m_CompletedJobs.PopAll();
+	while ( next )
 	{
-		Job * job = ( *i );
+		Job * job = next;
+		next = job->m_CompletedNext;
 		Node * n = job->GetNode();
+		if ( n->GetBuildTimeHistory().GetTotalSamples() == 1 )
+		{
+			// only the first build of a node is sampled here, as nodes with
+			// previous history were sampled when the DB was loaded
+			nodeGraph.UpdateBuildTimeEstimates( n );
+		}
 		if ( n->Finalize( nodeGraph ) )
 		{
 			n->SetState( Node::UP_TO_DATE );
+			nodeGraph.RecordProgressCompleted( n );
 		}
 		else
 		{
@@ -431,19 +611,16 @@ void JobQueue::FinalizeCompletedJobs( NodeGraph & nodeGraph )
 		}
 		FDELETE job;
 	}
-	m_CompletedJobs2.Clear();
 
 	// failed jobs
-	end = m_CompletedJobsFailed2.End();
-	for ( Job ** i = m_CompletedJobsFailed2.Begin();
-			i != end;
-			i++ )
+	next = m_CompletedJobsFailed.PopAll();
+	while ( next )
 	{
-		Job * job = ( *i );
+		Job * job = next;
+		next = job->m_CompletedNext;
 		job->GetNode()->SetState( Node::FAILED );
 		FDELETE job;
 	}
-	m_CompletedJobsFailed2.Clear();
 }
 
 // MainThreadWait
@@ -451,7 +628,16 @@ void JobQueue::FinalizeCompletedJobs( NodeGraph & nodeGraph )
 void JobQueue::MainThreadWait( uint32_t maxWaitMS )
 {
 	PROFILE_SECTION( "MainThreadWait" )
-	m_MainThreadSemaphore.Wait( maxWaitMS );
+
+	// Publish that we're waiting before checking for completed jobs, so that a
+	// worker completing a job concurrently will either be seen here, or will
+	// see the flag and signal us
+	AtomicExchangeU32( &m_MainThreadWaiting, 1 );
+	if ( m_CompletedJobs.IsEmpty() && m_CompletedJobsFailed.IsEmpty() )
+	{
+		m_MainThreadSemaphore.Wait( maxWaitMS );
+	}
+	AtomicExchangeU32( &m_MainThreadWaiting, 0 );
 }
 
 // WorkerThreadWait
@@ -511,22 +697,32 @@ void JobQueue::FinishedProcessingJob( Job * job, bool success, bool wasARemoteJo
 	{
 		ASSERT( m_NumLocalJobsActive > 0 );
 		AtomicDecU32( &m_NumLocalJobsActive );
-	}
 
-	{
-		MutexHolder m( m_CompletedJobsMutex );
-		if ( success )
+		// a job held back by its resource pool may now be able to start
+		if ( m_LocalJobs_Available.ReleaseResourcePool( job ) )
 		{
-			m_CompletedJobs.Append( job );
-		}
-		else
-		{
-			m_CompletedJobsFailed.Append( job );
+			m_WorkerThreadSemaphore.Signal();
 		}
 	}
 
-	// Wake main thread to process completed jobs
-	WakeMainThread();
+	// release jobs waiting for this one
+	if ( job->m_InFlightOwner )
+	{
+		CompleteInFlightCompilation( job, success );
+	}
+
+	if ( success )
+	{
+		m_CompletedJobs.Push( job );
+	}
+	else
+	{
+		m_CompletedJobsFailed.Push( job );
+	}
+
+	// Wake main thread to process completed jobs (only if it's blocked, to
+	// avoid a syscall per job when the main thread is busy)
+	WakeMainThreadIfWaiting();
 }
 
 // DoBuild
@@ -537,6 +733,18 @@ void JobQueue::FinishedProcessingJob( Job * job, bool success, bool wasARemoteJo
 
 	Node * node = job->GetNode();
 
+	node->RecordBuildStart( (uint64_t)Timer::GetNow() );
+	BuildTrace::Section traceSection( node, BuildTrace::PHASE_BUILD, (uint64_t)Timer::GetNow() - job->GetQueuedTime() );
+
+	// scratch allocations made while building are released when the job is done
+	ScratchArena & scratchArena = ScratchArena::GetThreadArena();
+	ScratchArena::Scope scratchScope( scratchArena );
+
+	// track allocations made by the job (reported with -verbose)
+	const uint32_t numAllocsBefore = GetThreadAllocationCount();
+	const uint32_t numScratchAllocsBefore = scratchArena.GetNumAllocs();
+	const size_t scratchBytesBefore = scratchArena.GetUsedBytes();
+
 	// make sure the output path exists for files
 	// (but don't bother for input files)
 	if ( node->IsAFile() && ( node->GetType() != Node::FILE_NODE ) && ( node->GetType() != Node::COMPILER_NODE ) )
@@ -566,11 +774,21 @@ void JobQueue::FinishedProcessingJob( Job * job, bool success, bool wasARemoteJo
 
 	if ( result == Node::NODE_RESULT_OK )
 	{
-		// record new build time only if built (i.e. if cached or failed, the time
+		// record new build time only if built (i.e. if failed, the time
 		// does not represent how long it takes to create this resource)
-		node->SetLastBuildTime( timeTakenMS );
+		node->RecordBuildTime( BuildTimeHistory::LOCAL, timeTakenMS );
 		node->SetStatFlag( Node::STATS_BUILT );
-		FLOG_INFO( "-Build: %u ms\t%s", timeTakenMS, node->GetName().Get() );
+		FLOG_INFO( "-Build: %u ms (allocs: %u heap, %u scratch in %u KiB)\t%s",
+				   timeTakenMS,
+				   GetThreadAllocationCount() - numAllocsBefore,
+				   scratchArena.GetNumAllocs() - numScratchAllocsBefore,
+				   (uint32_t)( ( scratchArena.GetUsedBytes() - scratchBytesBefore ) / 1024 ),
+				   node->GetName().Get() );
+	}
+	else if ( result == Node::NODE_RESULT_OK_CACHE )
+	{
+		// cache retrieval times are tracked separately
+		node->RecordBuildTime( BuildTimeHistory::CACHE, timeTakenMS );
 	}
 
 	if ( result == Node::NODE_RESULT_FAILED )
@@ -578,7 +796,8 @@ void JobQueue::FinishedProcessingJob( Job * job, bool success, bool wasARemoteJo
 		node->SetStatFlag( Node::STATS_FAILED );
 	}
 
-	if ( result == Node::NODE_RESULT_NEED_SECOND_BUILD_PASS )
+	if ( ( result == Node::NODE_RESULT_NEED_SECOND_BUILD_PASS ) ||
+		 ( result == Node::NODE_RESULT_DEFERRED ) )
 	{
 		// nothing to check
 	}
@@ -622,8 +841,15 @@ void JobQueue::FinishedProcessingJob( Job * job, bool success, bool wasARemoteJo
 		}
 	}
 
+	// when content hashing, dependents don't rebuild if contents are unchanged
+	if ( ( result == Node::NODE_RESULT_OK ) || ( result == Node::NODE_RESULT_OK_CACHE ) )
+	{
+		node->UpdateContentHash();
+	}
+
 	// log processing time
 	node->AddProcessingTime( timeTakenMS );
+	node->RecordBuildEnd( (uint64_t)Timer::GetNow() );
 
 	return result;
 }
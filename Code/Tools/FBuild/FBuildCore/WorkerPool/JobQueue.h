@@ -7,16 +7,17 @@
 // Includes
 //------------------------------------------------------------------------------
 #include "Core/Containers/Array.h"
+#include "Core/Containers/MPSCQueue.h"
 #include "Core/Containers/Singleton.h"
 
 #include "Tools/FBuild/FBuildCore/Graph/Node.h"
+#include "Tools/FBuild/FBuildCore/WorkerPool/Job.h"
 #include "Core/Process/Semaphore.h"
 #include "Core/Process/Mutex.h"
 
 // Forward Declarations
 //------------------------------------------------------------------------------
 class Node;
-class Job;
 class WorkerThread;
 
 
@@ -32,9 +33,11 @@ public:
 
 	// jobs pushed by the main thread
 	void QueueJobs( Array< Node * > & nodes );
+	void QueueJobs( Array< Job * > & jobs );
 
 	// jobs consumed by workers
-	Job * RemoveJob();
+	Job * RemoveJob( bool honorResourcePools = true );
+	bool ReleaseResourcePool( Job * job ); // returns true if job was in a pool
 private:
 	uint32_t	m_Count;	// access the current count
 	Mutex		m_Mutex;	// lock to add/remove jobs
@@ -57,6 +60,7 @@ public:
 
 	// main thread can be signalled
 	inline void WakeMainThread() { m_MainThreadSemaphore.Signal(); }
+	inline void WakeMainThreadIfWaiting() { if ( m_MainThreadWaiting && AtomicExchangeU32( &m_MainThreadWaiting, 0 ) ) { WakeMainThread(); } }
 
 	// handle shutting down
 	void SignalStopWorkers();
@@ -69,6 +73,16 @@ public:
 	void GetJobStats( uint32_t & numJobs, uint32_t & numJobsActive, 
 					  uint32_t & numJobsDist, uint32_t & numJobsDistActive ) const;
 
+	// identical compilations (same cache key) in progress
+	enum InFlightState
+	{
+		IN_FLIGHT_NONE,			// no identical job in progress - caller now builds it
+		IN_FLIGHT_BUILDING,		// identical job in progress - caller should be deferred
+		IN_FLIGHT_SUCCEEDED,	// identical job built ok - caller can use its output
+		IN_FLIGHT_FAILED		// (internal only)
+	};
+	InFlightState RegisterInFlightCompilation( Job * job, const AString & cacheName, const Node * & builtBy );
+
 private:
 	// worker threads call these
 	friend class WorkerThread;
@@ -79,6 +93,8 @@ private:
 	void		FinishedProcessingJob( Job * job, bool result, bool wasARemoteJob, bool localRaceOfRemoteJob );
 
 	void	QueueJob2( Job * job );
+	void	DeferJob( Job * job );
+	void	CompleteInFlightCompilation( Job * job, bool success );
 
 	// client side of protocol consumes jobs via this interface
 	friend class Client;
@@ -116,17 +132,28 @@ private:
 	};
 	Array< CancelledJob > m_DistributedJobsCancelled;		// Distirbutable job in progress remotely, which should be discarded upon completion
 
+	// Identical compilations in progress (or done) this build, and the jobs waiting on them
+	struct InFlightCompilation
+	{
+		AString					m_CacheName;
+		const Node *			m_Node;			// node building (or which built) the output
+		InFlightState			m_State;
+		Array< Job * >			m_DeferredJobs;
+		InFlightCompilation *	m_Next;			// next in hash bucket
+	};
+	InFlightCompilation * FindInFlightCompilation( const AString & cacheName, uint32_t & bucket ) const;
+	enum { IN_FLIGHT_TABLE_SIZE = 4096 };
+	Mutex					m_InFlightMutex;
+	InFlightCompilation *	m_InFlightMap[ IN_FLIGHT_TABLE_SIZE ];
+
 	// Semaphore to manage thread idle
 	Semaphore			m_MainThreadSemaphore;
 
-	// completed jobs
-	mutable Mutex		m_CompletedJobsMutex;
-	Array< Job * >		m_CompletedJobs;
-	Array< Job * >		m_CompletedJobsFailed;
-
-	// we have pair of arrays to enable a swap, avoiding locking the mutex too long
-	Array< Job * >		m_CompletedJobs2;
-	Array< Job * >		m_CompletedJobsFailed2;
+	// completed jobs (pushed by workers, consumed by main thread)
+	typedef MPSCQueue< Job, &Job::m_CompletedNext > CompletedJobQueue;
+	CompletedJobQueue	m_CompletedJobs;
+	CompletedJobQueue	m_CompletedJobsFailed;
+	volatile uint32_t	m_MainThreadWaiting;	// main thread is (about to be) blocked in MainThreadWait
 
 	Array< WorkerThread * > m_Workers;
 };
@@ -13,12 +13,14 @@
 #include "Tools/FBuild/FBuildCore/FLog.h"
 #include "Tools/FBuild/FBuildCore/Graph/Node.h"
 #include "Tools/FBuild/FBuildCore/Graph/ObjectNode.h"
+#include "Tools/FBuild/FBuildCore/Helpers/BuildTrace.h"
 
 // Core
 #include "Core/Containers/AutoPtr.h"
 #include "Core/FileIO/FileIO.h"
 #include "Core/FileIO/FileStream.h"
 #include "Core/FileIO/PathUtils.h"
+#include "Core/Mem/ScratchArena.h"
 #include "Core/Profile/Profile.h"
 #include "Core/Time/Timer.h"
 #include "Core/Tracing/Tracing.h"
@@ -281,6 +283,12 @@ void JobQueueRemote::FinishedProcessingJob( Job * job, bool success )
 
 	ObjectNode * node = job->GetNode()->CastTo< ObjectNode >();
 
+	node->RecordBuildStart( (uint64_t)Timer::GetNow() );
+	BuildTrace::Section traceSection( node, BuildTrace::PHASE_BUILD, (uint64_t)Timer::GetNow() - job->GetQueuedTime() );
+
+	// scratch allocations made while building are released when the job is done
+	ScratchArena::Scope scratchScope( ScratchArena::GetThreadArena() );
+
 	// remote tasks must output to a tmp file
 	if ( job->IsLocal() == false )
 	{
@@ -325,7 +333,7 @@ void JobQueueRemote::FinishedProcessingJob( Job * job, bool success )
 	{
 		// record new build time only if built (i.e. if failed, the time
 		// does not represent how long it takes to create this resource)
-		node->SetLastBuildTime( timeTakenMS );
+		node->RecordBuildTime( BuildTimeHistory::LOCAL, timeTakenMS );
 		node->SetStatFlag( Node::STATS_BUILT );
 		//FLOG_INFO( "-Build: %u ms\t%s", timeTakenMS, node->GetName().Get() );
 
@@ -336,6 +344,11 @@ void JobQueueRemote::FinishedProcessingJob( Job * job, bool success )
 				ASSERT( node->m_Stamp == FileIO::GetFileLastWriteTime(node->GetName()) );
 			}
 		#endif
+
+		if ( job->IsLocal() )
+		{
+			node->UpdateContentHash();
+		}
 	}
 
 	if ( result == Node::NODE_RESULT_FAILED )
@@ -386,7 +399,8 @@ void JobQueueRemote::FinishedProcessingJob( Job * job, bool success )
 
 	// log processing time
 	node->AddProcessingTime( timeTakenMS );
-	
+	node->RecordBuildEnd( (uint64_t)Timer::GetNow() );
+
 	return result;
 }
 
@@ -0,0 +1,118 @@
+// ResourcePool - limit concurrency of a class of local jobs
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Tools/FBuild/FBuildCore/PrecompiledHeader.h"
+
+#include "ResourcePool.h"
+
+// Core
+#include "Core/FileIO/IOStream.h"
+#include "Core/Math/Conversions.h"
+
+// CONSTRUCTOR
+//------------------------------------------------------------------------------
+ResourcePool::ResourcePool()
+	: m_MaxJobs( 0 )
+	, m_MemoryMiB( 0 )
+	, m_JobMemoryMiB( 0 )
+	, m_ActiveJobs( 0 )
+	, m_ActiveMemoryMiB( 0 )
+{
+	ResetStats();
+}
+
+// CONSTRUCTOR
+//------------------------------------------------------------------------------
+ResourcePool::ResourcePool( const AString & name, uint32_t maxJobs, uint32_t memoryMiB, uint32_t jobMemoryMiB )
+	: m_Name( name )
+	, m_MaxJobs( maxJobs )
+	, m_MemoryMiB( memoryMiB )
+	, m_JobMemoryMiB( jobMemoryMiB )
+	, m_ActiveJobs( 0 )
+	, m_ActiveMemoryMiB( 0 )
+{
+	ResetStats();
+}
+
+// DESTRUCTOR
+//------------------------------------------------------------------------------
+ResourcePool::~ResourcePool()
+{
+}
+
+// CanStartJob
+//------------------------------------------------------------------------------
+bool ResourcePool::CanStartJob( uint32_t jobMemoryMiB ) const
+{
+	// a job is always allowed to start in an idle pool, so a job
+	// which exceeds the budget on its own can still be built
+	if ( m_ActiveJobs == 0 )
+	{
+		return true;
+	}
+	if ( ( m_MaxJobs > 0 ) && ( m_ActiveJobs >= m_MaxJobs ) )
+	{
+		return false;
+	}
+	if ( ( m_MemoryMiB > 0 ) && ( ( m_ActiveMemoryMiB + jobMemoryMiB ) > m_MemoryMiB ) )
+	{
+		return false;
+	}
+	return true;
+}
+
+// OnJobStarted
+//------------------------------------------------------------------------------
+void ResourcePool::OnJobStarted( uint32_t jobMemoryMiB )
+{
+	++m_ActiveJobs;
+	m_ActiveMemoryMiB += jobMemoryMiB;
+
+	++m_NumJobs;
+	m_PeakJobs = Math::Max< uint32_t >( m_PeakJobs, m_ActiveJobs );
+	m_PeakMemoryMiB = Math::Max< uint32_t >( m_PeakMemoryMiB, m_ActiveMemoryMiB );
+}
+
+// OnJobFinished
+//------------------------------------------------------------------------------
+void ResourcePool::OnJobFinished( uint32_t jobMemoryMiB )
+{
+	ASSERT( m_ActiveJobs > 0 );
+	ASSERT( m_ActiveMemoryMiB >= jobMemoryMiB );
+	--m_ActiveJobs;
+	m_ActiveMemoryMiB -= jobMemoryMiB;
+}
+
+// ResetStats
+//------------------------------------------------------------------------------
+void ResourcePool::ResetStats()
+{
+	m_NumJobs = 0;
+	m_NumJobsHeldBack = 0;
+	m_PeakJobs = 0;
+	m_PeakMemoryMiB = 0;
+}
+
+// Save
+//------------------------------------------------------------------------------
+void ResourcePool::Save( IOStream & stream ) const
+{
+	stream.Write( m_Name );
+	stream.Write( m_MaxJobs );
+	stream.Write( m_MemoryMiB );
+	stream.Write( m_JobMemoryMiB );
+}
+
+// Load
+//------------------------------------------------------------------------------
+bool ResourcePool::Load( IOStream & stream )
+{
+	return ( stream.Read( m_Name ) &&
+			 stream.Read( m_MaxJobs ) &&
+			 stream.Read( m_MemoryMiB ) &&
+			 stream.Read( m_JobMemoryMiB ) );
+}
+
+//------------------------------------------------------------------------------
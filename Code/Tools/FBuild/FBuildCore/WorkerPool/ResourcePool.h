@@ -0,0 +1,71 @@
+// ResourcePool - limit concurrency of a class of local jobs
+//------------------------------------------------------------------------------
+#pragma once
+#ifndef FBUILD_WORKERPOOL_RESOURCEPOOL_H
+#define FBUILD_WORKERPOOL_RESOURCEPOOL_H
+
+// Includes
+//------------------------------------------------------------------------------
+#include "Core/Env/Types.h"
+#include "Core/Strings/AString.h"
+
+// Forward Declarations
+//------------------------------------------------------------------------------
+class IOStream;
+
+// ResourcePool
+//------------------------------------------------------------------------------
+// Jobs assigned to a pool are only started while the pool has capacity (a
+// number of concurrent jobs and/or a memory budget). Jobs which can't start
+// remain queued, and don't prevent other jobs from being processed.
+//
+// Access is serialized by the JobSubQueue lock while building.
+class ResourcePool
+{
+public:
+	explicit ResourcePool();
+	explicit ResourcePool( const AString & name, uint32_t maxJobs, uint32_t memoryMiB, uint32_t jobMemoryMiB );
+	~ResourcePool();
+
+	inline const AString &	GetName() const			{ return m_Name; }
+	inline uint32_t			GetMaxJobs() const		{ return m_MaxJobs; }		// 0 = unlimited
+	inline uint32_t			GetMemoryMiB() const	{ return m_MemoryMiB; }		// 0 = unlimited
+	inline uint32_t			GetJobMemoryMiB() const	{ return m_JobMemoryMiB; }	// default per job
+
+	// scheduling
+	bool CanStartJob( uint32_t jobMemoryMiB ) const;
+	void OnJobStarted( uint32_t jobMemoryMiB );
+	void OnJobFinished( uint32_t jobMemoryMiB );
+	inline void OnJobHeldBack() { ++m_NumJobsHeldBack; }
+
+	// stats
+	void ResetStats();
+	inline uint32_t GetNumJobs() const			{ return m_NumJobs; }
+	inline uint32_t GetNumJobsHeldBack() const	{ return m_NumJobsHeldBack; }
+	inline uint32_t GetPeakJobs() const			{ return m_PeakJobs; }
+	inline uint32_t GetPeakMemoryMiB() const	{ return m_PeakMemoryMiB; }
+
+	// serialization of definition (not stats)
+	void Save( IOStream & stream ) const;
+	bool Load( IOStream & stream );
+
+private:
+	// definition
+	AString		m_Name;
+	uint32_t	m_MaxJobs;
+	uint32_t	m_MemoryMiB;
+	uint32_t	m_JobMemoryMiB;
+
+	// state
+	uint32_t	m_ActiveJobs;
+	uint32_t	m_ActiveMemoryMiB;
+
+	// stats
+	uint32_t	m_NumJobs;
+	uint32_t	m_NumJobsHeldBack;
+	uint32_t	m_PeakJobs;
+	uint32_t	m_PeakMemoryMiB;
+};
+
+//------------------------------------------------------------------------------
+#endif // FBUILD_WORKERPOOL_RESOURCEPOOL_H
@@ -165,6 +165,10 @@ void WorkerThread::WaitForStop()
 		{
 			JobQueue::Get().QueueJob2( job );
 		}
+		else if ( result == Node::NODE_RESULT_DEFERRED )
+		{
+			JobQueue::Get().DeferJob( job );
+		}
 		else
 		{
 			JobQueue::Get().FinishedProcessingJob( job, ( result != Node::NODE_RESULT_FAILED ), false, false );
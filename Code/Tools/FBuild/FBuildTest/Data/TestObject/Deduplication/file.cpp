@@ -0,0 +1,6 @@
+// file.cpp
+//------------------------------------------------------------------------------
+int Function()
+{
+	return 1;
+}
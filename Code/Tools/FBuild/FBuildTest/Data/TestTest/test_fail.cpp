@@ -0,0 +1,8 @@
+//
+// An simple executable to run as a failing test
+//
+
+int main(int, char **)
+{
+	return 1; // test will check this
+}
@@ -0,0 +1,126 @@
+// TestArgs.cpp
+//------------------------------------------------------------------------------
+
+// Includes
+//------------------------------------------------------------------------------
+#include "FBuildTest.h"
+
+#include "Tools/FBuild/FBuildCore/Helpers/Args.h"
+
+#include "Core/Mem/Mem.h"
+#include "Core/Mem/ScratchArena.h"
+#include "Core/Strings/AStackString.h"
+
+// TestArgs
+//------------------------------------------------------------------------------
+class TestArgs : public FBuildTest
+{
+private:
+	DECLARE_TESTS
+
+	// Tests
+	void BuildArgs() const;
+	void ManyArgs() const;
+	void NestedArgs() const;
+	void Clear() const;
+};
+
+// Register Tests
+//------------------------------------------------------------------------------
+REGISTER_TESTS_BEGIN( TestArgs )
+	REGISTER_TEST( BuildArgs )
+	REGISTER_TEST( ManyArgs )
+	REGISTER_TEST( NestedArgs )
+	REGISTER_TEST( Clear )
+REGISTER_TESTS_END
+
+// BuildArgs
+//------------------------------------------------------------------------------
+void TestArgs::BuildArgs() const
+{
+	ScratchArena::Scope scratchScope( ScratchArena::GetThreadArena() );
+
+	Args args;
+	args += "-c";
+	args.AddDelimiter();
+	args += AStackString<>( "-o" );
+	args += ' ';
+	args.Append( "file.o.extra", 6 );
+
+	TEST_ASSERT( args.Finalize( AStackString<>( "compiler" ), AStackString<>( "node" ), false ) );
+	TEST_ASSERT( args.GetRawArgs() == "-c -o file.o" );
+	TEST_ASSERT( args.GetFinalArgs() == "-c -o file.o" );
+}
+
+// ManyArgs
+//------------------------------------------------------------------------------
+void TestArgs::ManyArgs() const
+{
+	ScratchArena::Scope scratchScope( ScratchArena::GetThreadArena() );
+
+	// link-like command line with thousands of inputs
+	const AStackString<> pre( "\"" );
+	const AStackString<> post( "\"" );
+	AStackString<> input( "Some/Relatively/Long/Path/To/An/Object/File.o" );
+
+	Args args;
+	const uint32_t numAllocsBefore = GetThreadAllocationCount();
+	for ( uint32_t i = 0; i < 10000; ++i )
+	{
+		args += pre;
+		args += input;
+		args += post;
+		args.AddDelimiter();
+	}
+
+	// no heap allocations made while building
+	TEST_ASSERT( GetThreadAllocationCount() == numAllocsBefore );
+
+	TEST_ASSERT( args.Finalize( AStackString<>( "linker" ), AStackString<>( "node" ), true ) );
+	const AString & rawArgs = args.GetRawArgs();
+	TEST_ASSERT( rawArgs.GetLength() == ( 10000 * ( input.GetLength() + 3 ) ) );
+	TEST_ASSERT( rawArgs.BeginsWith( "\"Some/Relatively/Long/Path/To/An/Object/File.o\" \"Some" ) );
+	TEST_ASSERT( rawArgs.EndsWith( "File.o\" " ) );
+}
+
+// NestedArgs
+//------------------------------------------------------------------------------
+void TestArgs::NestedArgs() const
+{
+	ScratchArena::Scope scratchScope( ScratchArena::GetThreadArena() );
+
+	// interleaved growth of two args (as with preprocessor and compiler args)
+	Args argsA;
+	Args argsB;
+	for ( uint32_t i = 0; i < 2000; ++i )
+	{
+		argsA += "-DDEFINE_A";
+		argsA.AddDelimiter();
+		argsB += "-IInclude/Path/B";
+		argsB.AddDelimiter();
+	}
+	TEST_ASSERT( argsA.Finalize( AStackString<>( "a" ), AStackString<>( "a" ), false ) );
+	TEST_ASSERT( argsB.Finalize( AStackString<>( "b" ), AStackString<>( "b" ), false ) );
+	TEST_ASSERT( argsA.GetRawArgs().GetLength() == ( 2000 * 11 ) );
+	TEST_ASSERT( argsB.GetRawArgs().GetLength() == ( 2000 * 17 ) );
+	TEST_ASSERT( argsA.GetRawArgs().EndsWith( "-DDEFINE_A -DDEFINE_A " ) );
+	TEST_ASSERT( argsB.GetRawArgs().EndsWith( "-IInclude/Path/B -IInclude/Path/B " ) );
+}
+
+// Clear
+//------------------------------------------------------------------------------
+void TestArgs::Clear() const
+{
+	ScratchArena::Scope scratchScope( ScratchArena::GetThreadArena() );
+
+	Args args;
+	args += "discarded";
+	args.AddDelimiter();
+	args.Clear();
+	args += "kept";
+
+	TEST_ASSERT( args.Finalize( AStackString<>( "exe" ), AStackString<>( "node" ), false ) );
+	TEST_ASSERT( args.GetRawArgs() == "kept" );
+}
+
+//------------------------------------------------------------------------------
@@ -6,11 +6,19 @@
 #include "TestFramework/UnitTest.h"
 
 #include "Tools/FBuild/FBuildCore/FBuild.h"
+#include "Tools/FBuild/FBuildCore/BFF/BFFIncludeCache.h"
 #include "Tools/FBuild/FBuildCore/BFF/BFFParser.h"
+#include "Tools/FBuild/FBuildCore/BFF/BFFStackFrame.h"
+#include "Tools/FBuild/FBuildCore/BFF/BFFVariable.h"
 #include "Tools/FBuild/FBuildCore/Graph/NodeGraph.h"
 
 #include "Core/Containers/AutoPtr.h"
+#include "Core/FileIO/ConstMemoryStream.h"
 #include "Core/FileIO/FileStream.h"
+#include "Core/FileIO/MemoryStream.h"
+#include "Core/Strings/AStackString.h"
+#include "Core/Strings/AString.h"
+#include "Core/Time/Timer.h"
 
 // TestBFFParsing
 //------------------------------------------------------------------------------
@@ -48,8 +56,11 @@ private:
 	void FrozenVariable() const;
 	void DynamicVarNameConstruction() const;
 	void OperatorMinus() const;
+	void WideConfigPerformance() const;
+	void IncludeCache() const;
 
 	void Parse( const char * fileName, bool expectFailure = false ) const;
+	void ParseIncludeCacheRoot( NodeGraph & ng, const char * prefix ) const;
 };
 
 // Register Tests
@@ -84,6 +95,8 @@ REGISTER_TESTS_BEGIN( TestBFFParsing )
 	REGISTER_TEST( FrozenVariable )
 	REGISTER_TEST( DynamicVarNameConstruction )
 	REGISTER_TEST( OperatorMinus )
+	REGISTER_TEST( WideConfigPerformance )
+	REGISTER_TEST( IncludeCache )
 REGISTER_TESTS_END
 
 // Empty
@@ -327,4 +340,115 @@ void TestBFFParsing::OperatorMinus() const
 	Parse( "Data/TestBFFParsing/operator_minus.bff" );
 }
 
+// WideConfigPerformance
+//------------------------------------------------------------------------------
+void TestBFFParsing::WideConfigPerformance() const
+{
+	// generate a config with wide structs, used via a ForEach over many
+	// permutations, which stresses variable lookup in the stack frames
+	const uint32_t NUM_MEMBERS( 400 );
+	const uint32_t NUM_CONFIGS( 200 );
+
+	AString bff( 4 * 1024 * 1024 );
+	for ( uint32_t c = 0; c < NUM_CONFIGS; ++c )
+	{
+		bff.AppendFormat( ".Config%u =\n[\n", c );
+		for ( uint32_t m = 0; m < NUM_MEMBERS; ++m )
+		{
+			bff.AppendFormat( "    .Member%u = 'Config%u-Value%u'\n", m, c, m );
+		}
+		bff += "]\n";
+	}
+	bff += ".Configs = { ";
+	for ( uint32_t c = 0; c < NUM_CONFIGS; ++c )
+	{
+		bff.AppendFormat( "%s.Config%u", ( c > 0 ) ? ", " : "", c );
+	}
+	bff += " }\n";
+	bff += "ForEach( .Config in .Configs )\n"
+		   "{\n"
+		   "    Using( .Config )\n"
+		   "    .Combined = '$Member0$ $Member199$ $Member399$'\n"
+		   "    .Combined + ' $Member1$'\n"
+		   "}\n";
+
+	Timer t;
+	BFFVariable::ResetStats();
+	FBuild fBuild;
+	NodeGraph ng;
+	BFFParser p( ng );
+	TEST_ASSERT( p.Parse( bff.Get(), bff.GetLength(), "wide.bff", 0, 0 ) );
+	const float timeTaken = t.GetElapsed();
+
+	OUTPUT( "Wide Config Parse: %2.3fs (%u configs x %u members, %u KiB)\n", timeTaken, NUM_CONFIGS, NUM_MEMBERS, (uint32_t)( bff.GetLength() / 1024 ) );
+	OUTPUT( " - Variables     : %u created, %u values allocated, %u values shared\n",
+			BFFVariable::GetNumVariablesCreated(),
+			BFFVariable::GetNumValuesCreated(),
+			BFFVariable::GetNumValuesShared() );
+
+	// values should be shared by ForEach and Using, rather than copied
+	TEST_ASSERT( BFFVariable::GetNumValuesShared() >= ( NUM_CONFIGS * NUM_MEMBERS ) );
+}
+
+// IncludeCache
+//------------------------------------------------------------------------------
+void TestBFFParsing::IncludeCache() const
+{
+	FBuild fBuild; // needed for tracking of used files
+
+	// first parse records the variable-only include
+	NodeGraph ng1;
+	ParseIncludeCacheRoot( ng1, "Debug" );
+	TEST_ASSERT( ng1.GetIncludeCache().GetNumRecorded() == 1 ); // include with function call is not recorded
+	TEST_ASSERT( ng1.GetIncludeCache().GetNumReplayed() == 0 );
+
+	// save and reload, as would happen via the DB
+	MemoryStream ms;
+	ng1.GetIncludeCache().Save( ms );
+	ConstMemoryStream cms( ms.GetData(), ms.GetSize() );
+
+	// second parse with the same inputs replays the recorded result
+	NodeGraph ng2;
+	TEST_ASSERT( ng2.GetIncludeCache().Load( cms ) );
+	ParseIncludeCacheRoot( ng2, "Debug" );
+	TEST_ASSERT( ng2.GetIncludeCache().GetNumRecorded() == 0 );
+	TEST_ASSERT( ng2.GetIncludeCache().GetNumReplayed() == 1 );
+
+	// a change to a variable the include uses invalidates the recorded result
+	ParseIncludeCacheRoot( ng2, "Release" );
+	TEST_ASSERT( ng2.GetIncludeCache().GetNumRecorded() == 1 );
+	TEST_ASSERT( ng2.GetIncludeCache().GetNumReplayed() == 1 );
+}
+
+// ParseIncludeCacheRoot
+//------------------------------------------------------------------------------
+void TestBFFParsing::ParseIncludeCacheRoot( NodeGraph & ng, const char * prefix ) const
+{
+	AStackString<> bff;
+	bff.Format( ".Prefix = '%s'\n"
+				"#include \"include_cache_vars.bff\"\n"
+				"#include \"include_cache_func.bff\"\n", prefix );
+
+	// parse into our own frame so we can inspect the results
+	BFFStackFrame frame;
+	BFFParser p( ng );
+	const bool pushStackFrame = false;
+	TEST_ASSERT( p.Parse( bff.Get(), bff.GetLength(), "Data/TestBFFParsing/include_cache.bff", 0, 0, pushStackFrame ) );
+
+	// results should be the same whether the include was parsed or replayed
+	AStackString<> expected;
+	expected.Format( "%s-Output", prefix );
+	const BFFVariable * output = BFFStackFrame::GetVar( ".Output", &frame );
+	TEST_ASSERT( output && output->IsString() && ( output->GetString() == expected ) );
+
+	const BFFVariable * flags = BFFStackFrame::GetVar( ".Flags", &frame );
+	TEST_ASSERT( flags && flags->IsArrayOfStrings() && ( flags->GetArrayOfStrings().GetSize() == 3 ) );
+	expected.Format( "-%s", prefix );
+	TEST_ASSERT( flags->GetArrayOfStrings()[ 2 ] == expected );
+
+	const BFFVariable * config = BFFStackFrame::GetVar( ".Config", &frame );
+	TEST_ASSERT( config && config->IsStruct() && ( config->GetStructMembers().GetSize() == 1 ) );
+	TEST_ASSERT( config->GetStructMembers()[ 0 ]->GetString() == prefix );
+}
+
 //------------------------------------------------------------------------------
@@ -6,10 +6,16 @@
 #include "FBuildTest.h"
 
 #include "Tools/FBuild/FBuildCore/FBuild.h"
+#include "Tools/FBuild/FBuildCore/Graph/LibraryNode.h"
+#include "Tools/FBuild/FBuildCore/Graph/NodeGraph.h"
 
 #include "Core/FileIO/FileIO.h"
+#include "Core/FileIO/FileStream.h"
+#include "Core/Process/Thread.h"
 #include "Core/Strings/AStackString.h"
 
+#include <memory.h>
+
 // TestBuildAndLinkLibrary
 //------------------------------------------------------------------------------
 class TestBuildAndLinkLibrary : public FBuildTest
@@ -22,6 +28,11 @@ private:
 	void TestBuildLib_NoRebuild() const;
 	void TestLibMerge() const;
 	void TestLibMerge_NoRebuild() const;
+	void TestLib_Cache() const;
+	void TestNativeArchiver() const;
+	void TestNativeArchiver_Incremental() const;
+
+	void CheckNativeArchiverOutput() const;
 
 	const char * GetBuildLibDBFileName() const { return "../../../../tmp/Test/BuildAndLinkLibrary/buildlib.fdb"; }
 	const char * GetMergeLibDBFileName() const { return "../../../../tmp/Test/BuildAndLinkLibrary/mergelib.fdb"; }
@@ -35,6 +46,11 @@ REGISTER_TESTS_BEGIN( TestBuildAndLinkLibrary )
 	REGISTER_TEST( TestBuildLib_NoRebuild )
 	REGISTER_TEST( TestLibMerge )
 	REGISTER_TEST( TestLibMerge_NoRebuild )
+	REGISTER_TEST( TestLib_Cache )
+	#if defined( __LINUX__ )
+		REGISTER_TEST( TestNativeArchiver )
+		REGISTER_TEST( TestNativeArchiver_Incremental )
+	#endif
 REGISTER_TESTS_END
 
 // TestStackFramesEmpty
@@ -182,4 +198,167 @@ void TestBuildAndLinkLibrary::TestLibMerge_NoRebuild() const
 	CheckStatsTotal( 14,	6 );
 }
 
+// TestLib_Cache
+//------------------------------------------------------------------------------
+void TestBuildAndLinkLibrary::TestLib_Cache() const
+{
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestBuildAndLinkLibrary/fbuild.bff";
+	options.m_ForceCleanBuild = true;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	options.m_UseCacheWrite = true;
+
+	const AStackString<> lib( "../../../../tmp/Test/BuildAndLinkLibrary/a.lib" );
+
+	// write to cache
+	{
+		EnsureFileDoesNotExist( lib );
+
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "libA" ) ) );
+
+		EnsureFileExists( lib );
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::LIBRARY_NODE ).m_NumCacheStores == 1 );
+	}
+
+	// read from cache
+	{
+		EnsureFileDoesNotExist( lib );
+
+		options.m_UseCacheRead = true;
+		options.m_UseCacheWrite = false;
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "libA" ) ) );
+
+		EnsureFileExists( lib );
+		CheckStatsNode ( 1,		0,		Node::LIBRARY_NODE ); // retrieved from cache, not built
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::LIBRARY_NODE ).m_NumCacheHits == 1 );
+	}
+}
+
+// TestNativeArchiver
+//------------------------------------------------------------------------------
+void TestBuildAndLinkLibrary::TestNativeArchiver() const
+{
+	FBuildOptions options;
+	options.m_ForceCleanBuild = true;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	options.m_ConfigFile = "Data/TestBuildAndLinkLibrary/fbuild.bff";
+
+	FBuild fBuild( options );
+	fBuild.Initialize();
+
+	const AStackString<> librarianLib( "../../../../tmp/Test/BuildAndLinkLibrary/NativeAr/librarian.a" );
+	const AStackString<> nativeLib( "../../../../tmp/Test/BuildAndLinkLibrary/NativeAr/native.a" );
+
+	// clean up anything left over from previous runs
+	EnsureFileDoesNotExist( librarianLib );
+	EnsureFileDoesNotExist( nativeLib );
+
+	// Build
+	TEST_ASSERT( fBuild.Build( AStackString<>( "NativeAr" ) ) );
+
+	// Check stats
+	//				 Seen,	Built,	Type
+	CheckStatsNode ( 3,		3,		Node::OBJECT_NODE );
+	CheckStatsNode ( 2,		2,		Node::LIBRARY_NODE );
+
+	CheckNativeArchiverOutput();
+}
+
+// TestNativeArchiver_Incremental
+//------------------------------------------------------------------------------
+void TestBuildAndLinkLibrary::TestNativeArchiver_Incremental() const
+{
+	FBuildOptions options;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	options.m_ConfigFile = "Data/TestBuildAndLinkLibrary/fbuild.bff";
+
+	const char * dbFile = "../../../../tmp/Test/BuildAndLinkLibrary/NativeAr/nativear.fdb";
+	const AStackString<> nativeLib( "../../../../tmp/Test/BuildAndLinkLibrary/NativeAr/native.a" );
+	const AStackString<> obj( "../../../../tmp/Test/BuildAndLinkLibrary/NativeAr/b.o" );
+
+	// build the objects, then the libraries. Members are only re-used if
+	// the inputs are older than the library, so make sure they are.
+	{
+		options.m_ForceCleanBuild = true;
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "objListNativeAr" ) ) );
+		TEST_ASSERT( fBuild.SaveDependencyGraph( dbFile ) );
+		options.m_ForceCleanBuild = false;
+	}
+	#if defined( __WINDOWS__ )
+		Thread::Sleep( 1 );
+	#else
+		Thread::Sleep( 1000 ); // Work around low time resolution of some file systems
+	#endif
+	{
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize( dbFile ) );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "NativeAr" ) ) );
+		TEST_ASSERT( fBuild.SaveDependencyGraph( dbFile ) );
+
+		CheckStatsNode ( 2,		2,		Node::LIBRARY_NODE );
+		const Node * node = fBuild.GetDependencyGraph().FindNode( nativeLib );
+		TEST_ASSERT( node && ( node->CastTo< LibraryNode >()->GetNumArchiveMembersReused() == 0 ) );
+	}
+	#if defined( __WINDOWS__ )
+		Thread::Sleep( 1 );
+	#else
+		Thread::Sleep( 1000 ); // Work around low time resolution of some file systems
+	#endif
+
+	// touch one object
+	{
+		AString contents;
+		FileStream fs;
+		TEST_ASSERT( fs.Open( obj.Get(), FileStream::READ_ONLY ) );
+		contents.SetLength( (uint32_t)fs.GetFileSize() );
+		TEST_ASSERT( fs.ReadBuffer( contents.Get(), fs.GetFileSize() ) == fs.GetFileSize() );
+		fs.Close();
+		TEST_ASSERT( fs.Open( obj.Get(), FileStream::WRITE_ONLY ) );
+		TEST_ASSERT( fs.WriteBuffer( contents.Get(), contents.GetLength() ) == contents.GetLength() );
+	}
+
+	// rebuild, re-using the unchanged members
+	{
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize( dbFile ) );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "NativeAr" ) ) );
+
+		//				 Seen,	Built,	Type
+		CheckStatsNode ( 3,		1,		Node::OBJECT_NODE ); // touched object
+		CheckStatsNode ( 2,		2,		Node::LIBRARY_NODE );
+		const Node * node = fBuild.GetDependencyGraph().FindNode( nativeLib );
+		TEST_ASSERT( node && ( node->CastTo< LibraryNode >()->GetNumArchiveMembersReused() == 2 ) );
+	}
+
+	CheckNativeArchiverOutput();
+}
+
+// CheckNativeArchiverOutput
+//------------------------------------------------------------------------------
+void TestBuildAndLinkLibrary::CheckNativeArchiverOutput() const
+{
+	const AStackString<> librarianLib( "../../../../tmp/Test/BuildAndLinkLibrary/NativeAr/librarian.a" );
+	const AStackString<> nativeLib( "../../../../tmp/Test/BuildAndLinkLibrary/NativeAr/native.a" );
+
+	// built-in archiver must produce the same library as the librarian
+	AString libs[ 2 ];
+	const AString * libNames[ 2 ] = { &librarianLib, &nativeLib };
+	for ( size_t i = 0; i < 2; ++i )
+	{
+		FileStream fs;
+		TEST_ASSERT( fs.Open( libNames[ i ]->Get(), FileStream::READ_ONLY ) );
+		libs[ i ].SetLength( (uint32_t)fs.GetFileSize() );
+		TEST_ASSERT( fs.ReadBuffer( libs[ i ].Get(), fs.GetFileSize() ) == fs.GetFileSize() );
+	}
+	TEST_ASSERT( libs[ 0 ].BeginsWith( "!<arch>\n" ) );
+	TEST_ASSERT( libs[ 0 ].GetLength() == libs[ 1 ].GetLength() );
+	TEST_ASSERT( memcmp( libs[ 0 ].Get(), libs[ 1 ].Get(), libs[ 0 ].GetLength() ) == 0 );
+}
+
 //------------------------------------------------------------------------------
@@ -115,8 +115,9 @@ void TestBuildFBuild::BuildClean() const
 	// check everything was built and stored to the cache
 	const FBuildStats::Stats & objStats = stats.GetStatsFor( Node::OBJECT_NODE );
 	TEST_ASSERT( objStats.m_NumProcessed > 10 ); // not exact so we don't have to update it
-	TEST_ASSERT( objStats.m_NumBuilt == objStats.m_NumProcessed ); // everything rebuilt
-	TEST_ASSERT( objStats.m_NumCacheStores == objStats.m_NumBuilt ); // everything stored to the cache
+	// (identical compilations are only built once, the rest are deduplicated)
+	TEST_ASSERT( ( objStats.m_NumBuilt + objStats.m_NumDeduplicated ) == objStats.m_NumProcessed ); // everything rebuilt
+	TEST_ASSERT( objStats.m_NumCacheStores == objStats.m_NumBuilt ); // everything built stored to the cache
 }
 
 // Build_NoRebuild
@@ -145,7 +146,7 @@ void TestBuildFBuild::BuildCleanWithCache() const
 	const FBuildStats::Stats & objStats = stats.GetStatsFor( Node::OBJECT_NODE );
 	TEST_ASSERT( objStats.m_NumProcessed > 10 ); // not exact so we don't have to update it
 	TEST_ASSERT( objStats.m_NumBuilt == 0 ); // nothing built
-	TEST_ASSERT( objStats.m_NumCacheHits == objStats.m_NumProcessed ); // everything read from cache
+	TEST_ASSERT( ( objStats.m_NumCacheHits + objStats.m_NumDeduplicated ) == objStats.m_NumProcessed ); // everything read from cache
 }
 
 // DBSavePerformance
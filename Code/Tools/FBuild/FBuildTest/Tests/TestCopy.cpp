@@ -9,6 +9,7 @@
 #include "Tools/FBuild/FBuildCore/Graph/NodeGraph.h"
 
 #include "Core/FileIO/FileIO.h"
+#include "Core/FileIO/FileStream.h"
 #include "Core/Strings/AStackString.h"
 
 // TestCopy
@@ -28,6 +29,7 @@ private:
 	void TestCopyFunction_SourceBasePath_NoRebuild() const;
 	void ChainedCopy() const;
 	void ChainedCopy_NoRebuild() const;
+	void HardLinksDisabled() const;
 };
 
 // Register Tests
@@ -43,6 +45,7 @@ REGISTER_TESTS_BEGIN( TestCopy )
 	REGISTER_TEST( TestCopyFunction_SourceBasePath_NoRebuild )
 	REGISTER_TEST( ChainedCopy )
 	REGISTER_TEST( ChainedCopy_NoRebuild )
+	REGISTER_TEST( HardLinksDisabled )
 REGISTER_TESTS_END
 
 // TestCopyFunction_FileToFile
@@ -303,4 +306,52 @@ void TestCopy::ChainedCopy_NoRebuild() const
 	CheckStatsTotal( 5,		2 );
 }
 
+// HardLinksDisabled
+//------------------------------------------------------------------------------
+void TestCopy::HardLinksDisabled() const
+{
+	// Copying over a hard link left by a previous build must replace the
+	// link, not write through it (which would truncate the source)
+
+	const AStackString<> src( "../../../../tmp/Test/Copy/HardLinks/source.txt" );
+	const AStackString<> dst( "../../../../tmp/Test/Copy/HardLinks/dest.txt" );
+	const char * const contents = "Source file contents";
+	const uint64_t contentsSize = AString::StrLen( contents );
+	{
+		TEST_ASSERT( FileIO::EnsurePathExists( AStackString<>( "../../../../tmp/Test/Copy/HardLinks/" ) ) );
+		FileStream f;
+		TEST_ASSERT( f.Open( src.Get(), FileStream::WRITE_ONLY ) );
+		TEST_ASSERT( f.WriteBuffer( contents, contentsSize ) == contentsSize );
+	}
+	EnsureFileDoesNotExist( dst );
+
+	const char * const configs[] = { "Data/TestCopy/copy_hardlinks_on.bff",	// link
+									 "Data/TestCopy/copy_hardlinks.bff" };	// then copy
+	for ( const char * config : configs )
+	{
+		FBuildOptions options;
+		options.m_ConfigFile = config;
+		options.m_ShowSummary = true; // required to generate stats for node count checks
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "TestCopyHardLinks" ) ) );
+
+		//				 Seen,	Built,	Type
+		CheckStatsNode ( 1,		1,		Node::COPY_FILE_NODE );
+
+		// source and dest must both be intact
+		const AString * files[] = { &src, &dst };
+		for ( const AString * file : files )
+		{
+			AStackString<> buffer;
+			FileStream f;
+			TEST_ASSERT( f.Open( file->Get(), FileStream::READ_ONLY ) );
+			TEST_ASSERT( f.GetFileSize() == contentsSize );
+			buffer.SetLength( (uint32_t)contentsSize );
+			TEST_ASSERT( f.ReadBuffer( buffer.Get(), contentsSize ) == contentsSize );
+			TEST_ASSERT( buffer == contents );
+		}
+	}
+}
+
 //------------------------------------------------------------------------------
@@ -30,6 +30,7 @@ private:
 	void TestValidExeWithDLL() const;
 
 	void TestLinkWithCopy() const;
+	void TestDLLWithImportLib_Cache() const;
 
 	const char * GetSingleDLLDBFileName() const { return "../../../../tmp/Test/DLL/singledll.fdb"; }
 	const char * GetTwoDLLsDBFileName() const	{ return "../../../../tmp/Test/DLL/twodlls.fdb"; }
@@ -51,6 +52,7 @@ REGISTER_TESTS_BEGIN( TestDLL )
 	REGISTER_TEST( TestExeWithDLL_NoRebuild )
     REGISTER_TEST( TestValidExeWithDLL )
 	REGISTER_TEST( TestLinkWithCopy )
+	REGISTER_TEST( TestDLLWithImportLib_Cache )
 REGISTER_TESTS_END
 
 // TestSingleDLL
@@ -428,4 +430,53 @@ void TestDLL::TestLinkWithCopy() const
 	CheckStatsTotal( numF+10,numB+10 );
 }
 
+// TestDLLWithImportLib_Cache
+//------------------------------------------------------------------------------
+void TestDLL::TestDLLWithImportLib_Cache() const
+{
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestDLL/fbuild.bff";
+	options.m_ForceCleanBuild = true;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	options.m_UseCacheWrite = true;
+
+	const AStackString<> dllA( "../../../../tmp/Test/DLL/dllA.dll" );
+	#if defined( __WINDOWS__ )
+		const AStackString<> importLib( "../../../../tmp/Test/DLL/dll_different_implib.lib" );
+	#endif
+
+	// write to cache
+	{
+		EnsureFileDoesNotExist( dllA );
+
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( dllA ) );
+
+		EnsureFileExists( dllA );
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::DLL_NODE ).m_NumCacheStores == 1 );
+	}
+
+	// read from cache (dll and import lib)
+	{
+		EnsureFileDoesNotExist( dllA );
+		#if defined( __WINDOWS__ )
+			EnsureFileDoesNotExist( importLib );
+		#endif
+
+		options.m_UseCacheRead = true;
+		options.m_UseCacheWrite = false;
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( dllA ) );
+
+		EnsureFileExists( dllA );
+		#if defined( __WINDOWS__ )
+			EnsureFileExists( importLib );
+		#endif
+		CheckStatsNode ( 1,		0,		Node::DLL_NODE ); // retrieved from cache, not built
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::DLL_NODE ).m_NumCacheHits == 1 );
+	}
+}
+
 //------------------------------------------------------------------------------
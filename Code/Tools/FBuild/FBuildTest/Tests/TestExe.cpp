@@ -23,6 +23,8 @@ private:
 	void Build() const;
 	void CheckValidExe() const;
 	void Build_NoRebuild() const;
+	void Build_Cache() const;
+	void Build_Cache_MissingImportLib() const;
 };
 
 // Register Tests
@@ -32,6 +34,10 @@ REGISTER_TESTS_BEGIN( TestExe )
 	REGISTER_TEST( Build )
 	REGISTER_TEST( CheckValidExe )
 	REGISTER_TEST( Build_NoRebuild )
+	REGISTER_TEST( Build_Cache )
+	#if defined( __WINDOWS__ )
+		REGISTER_TEST( Build_Cache_MissingImportLib )
+	#endif
 REGISTER_TESTS_END
 
 // CreateNode
@@ -130,4 +136,94 @@ void TestExe::Build_NoRebuild() const
 
 }
 
+// Build_Cache
+//------------------------------------------------------------------------------
+void TestExe::Build_Cache() const
+{
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestExe/exe.bff";
+	options.m_ForceCleanBuild = true;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	options.m_UseCacheWrite = true;
+
+	const AStackString<> exe( "../../../../tmp/Test/Exe/exe.exe" );
+
+	// write to cache
+	{
+		EnsureFileDoesNotExist( exe );
+
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "Exe" ) ) );
+
+		EnsureFileExists( exe );
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::EXE_NODE ).m_NumCacheStores == 1 );
+	}
+
+	// read from cache
+	{
+		EnsureFileDoesNotExist( exe );
+
+		options.m_UseCacheRead = true;
+		options.m_UseCacheWrite = false;
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "Exe" ) ) );
+
+		EnsureFileExists( exe );
+		CheckStatsNode ( 1,		0,		Node::EXE_NODE ); // retrieved from cache, not built
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::EXE_NODE ).m_NumCacheHits == 1 );
+	}
+
+	// retrieved exe must still work
+	CheckValidExe();
+}
+
+// Build_Cache_MissingImportLib
+//------------------------------------------------------------------------------
+void TestExe::Build_Cache_MissingImportLib() const
+{
+	// The exe exports nothing, so the linker doesn't write the requested
+	// import lib. The cache entry must still be usable.
+
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestExe/exe.bff";
+	options.m_ForceCleanBuild = true;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	options.m_UseCacheWrite = true;
+
+	const AStackString<> exe( "../../../../tmp/Test/Exe/exe_implib.exe" );
+	const AStackString<> importLib( "../../../../tmp/Test/Exe/exe_implib.lib" );
+
+	// write to cache
+	{
+		EnsureFileDoesNotExist( exe );
+		EnsureFileDoesNotExist( importLib );
+
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "Exe-ImportLib" ) ) );
+
+		EnsureFileExists( exe );
+		TEST_ASSERT( FileIO::FileExists( importLib.Get() ) == false );
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::EXE_NODE ).m_NumCacheStores == 1 );
+	}
+
+	// read from cache
+	{
+		EnsureFileDoesNotExist( exe );
+
+		options.m_UseCacheRead = true;
+		options.m_UseCacheWrite = false;
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "Exe-ImportLib" ) ) );
+
+		EnsureFileExists( exe );
+		TEST_ASSERT( FileIO::FileExists( importLib.Get() ) == false );
+		CheckStatsNode ( 1,		0,		Node::EXE_NODE ); // retrieved from cache, not built
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::EXE_NODE ).m_NumCacheHits == 1 );
+	}
+}
+
 //------------------------------------------------------------------------------
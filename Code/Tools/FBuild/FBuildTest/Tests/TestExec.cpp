@@ -27,6 +27,10 @@ private:
 	void Build_ExecCommand_MultipleInputChange() const;
 	void Build_ExecCommand_UseStdOut() const;
 	void Build_ExecCommand_ExpectedFailures() const;
+	void Build_ExecCommand_Cacheable() const;
+	void Build_ExecCommand_ContentHash() const;
+	void Build_ExecCommand_ResourcePool() const;
+	void Build_ExecCommand_UndefinedResourcePool() const;
 };
 
 // Register Tests
@@ -39,6 +43,10 @@ REGISTER_TESTS_BEGIN( TestExec )
 	REGISTER_TEST(Build_ExecCommand_MultipleInputChange)
 	REGISTER_TEST(Build_ExecCommand_UseStdOut)
 	REGISTER_TEST(Build_ExecCommand_ExpectedFailures)
+	REGISTER_TEST(Build_ExecCommand_Cacheable)
+	REGISTER_TEST(Build_ExecCommand_ContentHash)
+	REGISTER_TEST(Build_ExecCommand_ResourcePool)
+	REGISTER_TEST(Build_ExecCommand_UndefinedResourcePool)
 REGISTER_TESTS_END
 
 // Helpers
@@ -315,4 +323,166 @@ void TestExec::Build_ExecCommand_ExpectedFailures() const
 	// build
 	TEST_ASSERT(!fBuild.Build(AStackString<>("ExecCommandTest_OneInput_ReturnCode_ExpectFail")));
 	TEST_ASSERT(!fBuild.Build(AStackString<>("ExecCommandTest_OneInput_WrongOutput_ExpectFail")));
-}
\ No newline at end of file
+}
+
+//------------------------------------------------------------------------------
+void TestExec::Build_ExecCommand_ContentHash() const
+{
+	// With content hashing, commands whose inputs were re-written with
+	// the same contents should not run
+
+	const AStackString<> inFile("../../../../tmp/Test/Exec/ContentHash.txt");
+	const AStackString<> outFile("../../../../tmp/Test/Exec/ContentHash.txt.out.out");
+	const AStackString<> dbFile("../../../../tmp/Test/Exec/ContentHash.fdb");
+	const AStackString<> target("ExecCommandTest_ContentHash");
+	CreateInputFile( inFile );
+
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestExec/exec.bff";
+	options.m_ForceCleanBuild = true;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	options.m_UseContentHashing = true;
+
+	// initial build
+	{
+		EnsureFileDoesNotExist( outFile );
+
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( target ) );
+		TEST_ASSERT( fBuild.SaveDependencyGraph( dbFile.Get() ) );
+
+		EnsureFileExists( outFile );
+		CheckStatsNode ( 2,		2,		Node::EXEC_NODE );
+	}
+
+	options.m_ForceCleanBuild = false;
+
+	// input re-written with the same contents - nothing runs
+	{
+		#if defined( __OSX__ )
+			Thread::Sleep( 1000 ); // ensure file is seen as modified
+		#endif
+		CreateInputFile( inFile );
+
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize( dbFile.Get() ) );
+		TEST_ASSERT( fBuild.Build( target ) );
+		TEST_ASSERT( fBuild.SaveDependencyGraph( dbFile.Get() ) );
+
+		CheckStatsNode ( 2,		0,		Node::EXEC_NODE );
+		TEST_ASSERT( fBuild.GetStats().GetEarlyCutoffs() == 1 );
+	}
+
+	// input modified - first command runs, but its output is the same
+	{
+		#if defined( __OSX__ )
+			Thread::Sleep( 1000 ); // ensure file is seen as modified
+		#endif
+		FileStream f;
+		TEST_ASSERT( f.Open( inFile.Get(), FileStream::WRITE_ONLY ) );
+		f.WriteBuffer( "J", 1 );
+		f.Close();
+
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize( dbFile.Get() ) );
+		TEST_ASSERT( fBuild.Build( target ) );
+
+		CheckStatsNode ( 2,		1,		Node::EXEC_NODE );
+		TEST_ASSERT( fBuild.GetStats().GetEarlyCutoffs() == 1 );
+	}
+}
+
+//------------------------------------------------------------------------------
+void TestExec::Build_ExecCommand_Cacheable() const
+{
+	// A cacheable command should be stored on the first build
+	// and retrieved (not run) on a subsequent clean build
+
+	const AStackString<> inFile("../../../../tmp/Test/Exec/Cacheable.txt");
+	const AStackString<> outFile("../../../../tmp/Test/Exec/Cacheable.txt.out");
+	CreateInputFile( inFile );
+
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestExec/exec.bff";
+	options.m_ForceCleanBuild = true;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	options.m_UseCacheWrite = true;
+
+	// write to cache (not reading, as the cache persists between test runs)
+	{
+		EnsureFileDoesNotExist( outFile );
+
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "ExecCommandTest_Cacheable" ) ) );
+
+		EnsureFileExists( outFile );
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::EXEC_NODE ).m_NumCacheStores == 1 );
+	}
+
+	// read from cache
+	{
+		EnsureFileDoesNotExist( outFile );
+
+		options.m_UseCacheRead = true;
+		options.m_UseCacheWrite = false;
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "ExecCommandTest_Cacheable" ) ) );
+
+		EnsureFileExists( outFile );
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::EXEC_NODE ).m_NumCacheHits == 1 );
+	}
+}
+
+// Build_ExecCommand_ResourcePool
+//------------------------------------------------------------------------------
+void TestExec::Build_ExecCommand_ResourcePool() const
+{
+	// Commands in a pool limited to one job must run one at a time, even
+	// when there are enough workers to run them all at once
+
+	const char * const inputs[] = { "PoolA", "PoolB", "PoolC" };
+	for ( const char * input : inputs )
+	{
+		AStackString<> inFile, outFile;
+		inFile.Format( "../../../../tmp/Test/Exec/%s.txt", input );
+		outFile.Format( "../../../../tmp/Test/Exec/%s.txt.out", input );
+		CreateInputFile( inFile );
+		EnsureFileDoesNotExist( outFile );
+	}
+
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestExec/exec.bff";
+	options.m_ForceCleanBuild = true;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	options.m_NumWorkerThreads = 4;
+
+	FBuild fBuild( options );
+	TEST_ASSERT( fBuild.Initialize() );
+	TEST_ASSERT( fBuild.Build( AStackString<>( "ExecCommandTest_ResourcePool" ) ) );
+
+	// Check pool stats
+	const Array< ResourcePool > & pools = fBuild.GetResourcePools();
+	TEST_ASSERT( pools.GetSize() == 1 );
+	TEST_ASSERT( pools[ 0 ].GetName() == "Serial" );
+	TEST_ASSERT( pools[ 0 ].GetNumJobs() == 3 );
+	TEST_ASSERT( pools[ 0 ].GetPeakJobs() == 1 );
+
+	// Check stats
+	//				 Seen,	Built,	Type
+	CheckStatsNode ( 3,		3,		Node::EXEC_NODE );
+}
+
+// Build_ExecCommand_UndefinedResourcePool
+//------------------------------------------------------------------------------
+void TestExec::Build_ExecCommand_UndefinedResourcePool() const
+{
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestExec/undefined_pool.bff";
+
+	// pools must be defined in Settings before they are used
+	FBuild fBuild( options );
+	TEST_ASSERT( fBuild.Initialize() == false );
+}
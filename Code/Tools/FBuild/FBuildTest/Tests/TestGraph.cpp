@@ -21,6 +21,7 @@
 
 #include "Core/Containers/AutoPtr.h"
 #include "Core/FileIO/FileIO.h"
+#include "Core/FileIO/ConstMemoryStream.h"
 #include "Core/FileIO/FileStream.h"
 #include "Core/FileIO/MemoryStream.h"
 #include "Core/FileIO/PathUtils.h"
@@ -52,6 +53,14 @@ private:
 	void DBLocationChanged() const;
 	void BFFDirtied() const;
 	void DBVersionChanged() const;
+	void BFFChangedMigration() const;
+	void TestBuildTimeHistory() const;
+
+	void TestBuildTrace() const;
+	void TestBuildReport() const;
+	void TestBuildProgress() const;
+
+	void WriteCopyBFF( const char * bffFile, const char * destB ) const;
 };
 
 // Register Tests
@@ -69,6 +78,11 @@ REGISTER_TESTS_BEGIN( TestGraph )
 	REGISTER_TEST( DBLocationChanged )
 	REGISTER_TEST( BFFDirtied )
 	REGISTER_TEST( DBVersionChanged )
+	REGISTER_TEST( BFFChangedMigration )
+	REGISTER_TEST( TestBuildTimeHistory )
+	REGISTER_TEST( TestBuildTrace )
+	REGISTER_TEST( TestBuildReport )
+	REGISTER_TEST( TestBuildProgress )
 REGISTER_TESTS_END
 
 // EmptyGraph
@@ -135,7 +149,7 @@ void TestGraph::TestNodeTypes() const
 		Dependencies empty;
 		Dependencies inputs;
 		inputs.Append( Dependency( fn ) );
-		Node * n = ng.CreateExecNode( AStackString<>( "dst" ), inputs, fn, AStackString<>( "args" ), AStackString<>( "workingDir" ), 0, empty, false );
+		Node * n = ng.CreateExecNode( AStackString<>( "dst" ), inputs, fn, AStackString<>( "args" ), AStackString<>( "workingDir" ), 0, empty, false, false );
 		TEST_ASSERT( n->GetType() == Node::EXEC_NODE );
 		TEST_ASSERT( ExecNode::GetTypeS() == Node::EXEC_NODE);
 		TEST_ASSERT( AStackString<>( "Exec" ) == n->GetTypeName() );
@@ -685,4 +699,267 @@ void TestGraph::DBVersionChanged() const
 	TEST_ASSERT( GetRecordedOutput().Find( "Database version has changed" ) );
 }
 
+// BFFChangedMigration
+//------------------------------------------------------------------------------
+void TestGraph::BFFChangedMigration() const
+{
+	const char* bffFile	= "../../../../tmp/Test/Graph/BFFChangedMigration/fbuild.bff";
+	const char* dbFile	= "../../../../tmp/Test/Graph/BFFChangedMigration/fbuild.fdb";
+
+	EnsureFileDoesNotExist( bffFile );
+	EnsureFileDoesNotExist( dbFile );
+	EnsureFileDoesNotExist( "../../../../tmp/Test/Graph/BFFChangedMigration/a.copy" );
+	EnsureFileDoesNotExist( "../../../../tmp/Test/Graph/BFFChangedMigration/b.copy" );
+	EnsureFileDoesNotExist( "../../../../tmp/Test/Graph/BFFChangedMigration/b2.copy" );
+
+	// Ensure test output dir exists
+	{
+		AStackString<> bffPath( bffFile );
+		bffPath.SetLength( (uint32_t)( bffPath.FindLast( FORWARD_SLASH ) - bffPath.Get() ) );
+		TEST_ASSERT( FileIO::EnsurePathExists( bffPath ) );
+	}
+
+	FBuildOptions options;
+	options.m_ConfigFile = bffFile;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+
+	// Build both copies
+	WriteCopyBFF( bffFile, "b.copy" );
+	{
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize( dbFile ) );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "all" ) ) );
+		TEST_ASSERT( fBuild.SaveDependencyGraph( dbFile ) );
+
+		CheckStatsNode ( 2,		2,		Node::COPY_FILE_NODE );
+	}
+
+	#if defined( __OSX__ )
+		Thread::Sleep( 1000 ); // Work around low time resolution of HFS+
+	#endif
+
+	// Change the definition of one copy
+	WriteCopyBFF( bffFile, "b2.copy" );
+	{
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize( dbFile ) );
+		TEST_ASSERT( GetRecordedOutput().Find( "has changed (reparsing will occur)" ) );
+
+		// The new copy has no history, but is estimated from the copies in the DB
+		const NodeGraph & ng = fBuild.GetDependencyGraph();
+		const Node * copyB2 = ng.FindNode( AStackString<>( "../../../../tmp/Test/Graph/BFFChangedMigration/b2.copy" ) );
+		TEST_ASSERT( copyB2 && ( copyB2->GetBuildTimeHistory().GetEstimate() == 0 ) );
+		TEST_ASSERT( ng.GetBuildTimeEstimator().Estimate( copyB2 ) > 0 );
+
+		// Only the modified copy should be built
+		TEST_ASSERT( fBuild.Build( AStackString<>( "all" ) ) );
+		CheckStatsNode ( 2,		1,		Node::COPY_FILE_NODE );
+	}
+}
+
+// TestBuildTimeHistory
+//------------------------------------------------------------------------------
+void TestGraph::TestBuildTimeHistory() const
+{
+	BuildTimeHistory history;
+
+	// no history
+	TEST_ASSERT( history.GetEstimate() == 0 );
+
+	// cache retrievals are only used when nothing else is known
+	history.Record( BuildTimeHistory::CACHE, 10 );
+	TEST_ASSERT( history.GetEstimate() == 10 );
+
+	// first sample defines the average
+	history.Record( BuildTimeHistory::LOCAL, 1000 );
+	TEST_ASSERT( history.GetMean( BuildTimeHistory::LOCAL ) == 1000 );
+	TEST_ASSERT( history.GetStdDev( BuildTimeHistory::LOCAL ) == 0 );
+	TEST_ASSERT( history.GetEstimate() == 1000 );
+
+	// average moves towards new samples, and variance accumulates
+	history.Record( BuildTimeHistory::LOCAL, 2000 );
+	const uint32_t mean = history.GetMean( BuildTimeHistory::LOCAL );
+	TEST_ASSERT( ( mean > 1000 ) && ( mean < 2000 ) );
+	TEST_ASSERT( history.GetStdDev( BuildTimeHistory::LOCAL ) > 0 );
+	TEST_ASSERT( history.GetEstimate() > mean );
+	TEST_ASSERT( history.GetNumSamples( BuildTimeHistory::LOCAL ) == 2 );
+	TEST_ASSERT( history.GetNumSamples( BuildTimeHistory::REMOTE ) == 0 );
+
+	// repeated identical samples converge
+	for ( size_t i = 0; i < 100; ++i )
+	{
+		history.Record( BuildTimeHistory::LOCAL, 500 );
+	}
+	TEST_ASSERT( history.GetMean( BuildTimeHistory::LOCAL ) == 500 );
+	TEST_ASSERT( history.GetStdDev( BuildTimeHistory::LOCAL ) == 0 );
+
+	// serialization
+	MemoryStream ms;
+	history.Save( ms );
+	ConstMemoryStream cms( ms.GetData(), ms.GetSize() );
+	BuildTimeHistory loaded;
+	TEST_ASSERT( loaded.Load( cms ) );
+	TEST_ASSERT( loaded.GetEstimate() == history.GetEstimate() );
+	TEST_ASSERT( loaded.GetNumSamples( BuildTimeHistory::LOCAL ) == 102 );
+	TEST_ASSERT( loaded.GetMean( BuildTimeHistory::CACHE ) == 10 );
+}
+
+// TestBuildTrace
+//------------------------------------------------------------------------------
+void TestGraph::TestBuildTrace() const
+{
+	const char* bffFile		= "../../../../tmp/Test/Graph/BuildTrace/fbuild.bff";
+	const char* traceFile	= "../../../../tmp/Test/Graph/BuildTrace/trace.json";
+
+	EnsureFileDoesNotExist( bffFile );
+	EnsureFileDoesNotExist( traceFile );
+	EnsureFileDoesNotExist( "../../../../tmp/Test/Graph/BuildTrace/fbuild.fdb" );
+	EnsureFileDoesNotExist( "../../../../tmp/Test/Graph/BuildTrace/a.copy" );
+	EnsureFileDoesNotExist( "../../../../tmp/Test/Graph/BuildTrace/b.copy" );
+	TEST_ASSERT( FileIO::EnsurePathExists( AStackString<>( "../../../../tmp/Test/Graph/BuildTrace" ) ) );
+
+	WriteCopyBFF( bffFile, "b.copy" );
+
+	FBuildOptions options;
+	options.m_ConfigFile = bffFile;
+	options.m_TraceFile = traceFile;
+	{
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "all" ) ) );
+	}
+
+	// check trace contains an event for each copy
+	FileStream fs;
+	TEST_ASSERT( fs.Open( traceFile, FileStream::READ_ONLY ) );
+	AString trace;
+	trace.SetLength( (uint32_t)fs.GetFileSize() );
+	TEST_ASSERT( fs.ReadBuffer( trace.Get(), fs.GetFileSize() ) == fs.GetFileSize() );
+
+	TEST_ASSERT( trace.BeginsWith( "{\"traceEvents\":[" ) );
+	TEST_ASSERT( trace.EndsWith( "]}\n" ) );
+	TEST_ASSERT( trace.Find( "a.copy\",\"cat\":\"Build\",\"ph\":\"X\"" ) );
+	TEST_ASSERT( trace.Find( "b.copy\",\"cat\":\"Build\",\"ph\":\"X\"" ) );
+	TEST_ASSERT( trace.Find( "\"type\":\"Copy\"" ) );
+}
+
+// TestBuildReport
+//------------------------------------------------------------------------------
+void TestGraph::TestBuildReport() const
+{
+	const char* bffFile		= "../../../../tmp/Test/Graph/BuildReport/fbuild.bff";
+	const char* reportFile	= "report.html"; // always written to the working dir
+
+	EnsureFileDoesNotExist( bffFile );
+	EnsureFileDoesNotExist( reportFile );
+	EnsureFileDoesNotExist( "../../../../tmp/Test/Graph/BuildReport/a.copy" );
+	EnsureFileDoesNotExist( "../../../../tmp/Test/Graph/BuildReport/b.copy" );
+	TEST_ASSERT( FileIO::EnsurePathExists( AStackString<>( "../../../../tmp/Test/Graph/BuildReport" ) ) );
+
+	WriteCopyBFF( bffFile, "b.copy" );
+
+	FBuildOptions options;
+	options.m_ConfigFile = bffFile;
+	options.m_GenerateReport = true;
+	options.m_SaveDBOnCompletion = false;
+	{
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "all" ) ) );
+	}
+
+	AString report;
+	{
+		FileStream fs;
+		TEST_ASSERT( fs.Open( reportFile, FileStream::READ_ONLY ) );
+		report.SetLength( (uint32_t)fs.GetFileSize() );
+		TEST_ASSERT( fs.ReadBuffer( report.Get(), fs.GetFileSize() ) == fs.GetFileSize() );
+	}
+	EnsureFileDoesNotExist( reportFile );
+
+	// the path ends with one of the copies (whichever finished last)
+	const char * criticalPath = report.Find( "<h2 id=\"criticalPath\">" );
+	const char * parallelism = report.Find( "<h2 id=\"parallelism\">" );
+	TEST_ASSERT( criticalPath && parallelism && ( criticalPath < parallelism ) );
+	AStackString<> criticalPathSection( criticalPath, parallelism );
+	TEST_ASSERT( criticalPathSection.Find( "<td>Copy</td>" ) );
+	TEST_ASSERT( criticalPathSection.Find( ".copy</td>" ) );
+
+	// timeline of work and the serialization analysis
+	TEST_ASSERT( report.Find( "plotTimeline(\"canvas" ) );
+	TEST_ASSERT( report.Find( "<h3>Serializing Nodes</h3>" ) );
+}
+
+// TestBuildProgress
+//------------------------------------------------------------------------------
+void TestGraph::TestBuildProgress() const
+{
+	const char* bffFile	= "../../../../tmp/Test/Graph/BuildProgress/fbuild.bff";
+	const char* dbFile	= "../../../../tmp/Test/Graph/BuildProgress/fbuild.fdb";
+
+	EnsureFileDoesNotExist( bffFile );
+	EnsureFileDoesNotExist( dbFile );
+	EnsureFileDoesNotExist( "../../../../tmp/Test/Graph/BuildProgress/a.copy" );
+	EnsureFileDoesNotExist( "../../../../tmp/Test/Graph/BuildProgress/b.copy" );
+	TEST_ASSERT( FileIO::EnsurePathExists( AStackString<>( "../../../../tmp/Test/Graph/BuildProgress" ) ) );
+
+	WriteCopyBFF( bffFile, "b.copy" );
+
+	FBuildOptions options;
+	options.m_ConfigFile = bffFile;
+	options.m_ShowProgress = true;
+
+	// build, and then again when everything is up-to-date
+	for ( size_t i = 0; i < 2; ++i )
+	{
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize( dbFile ) );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "all" ) ) );
+		TEST_ASSERT( fBuild.SaveDependencyGraph( dbFile ) );
+
+		// everything which was discovered was also completed
+		const NodeGraph & ng = fBuild.GetDependencyGraph();
+		TEST_ASSERT( ng.GetProgressBuiltTime() == ng.GetProgressTotalTime() );
+
+		// and each node was only counted once
+		const Node * copyA = ng.FindNode( AStackString<>( "../../../../tmp/Test/Graph/BuildProgress/a.copy" ) );
+		const Node * copyB = ng.FindNode( AStackString<>( "../../../../tmp/Test/Graph/BuildProgress/b.copy" ) );
+		TEST_ASSERT( copyA && copyA->GetStatFlag( Node::STATS_PROGRESS_COUNTED ) );
+		TEST_ASSERT( copyB && copyB->GetStatFlag( Node::STATS_PROGRESS_COUNTED ) );
+
+		// another build in the same process starts counting afresh
+		TEST_ASSERT( fBuild.Build( AStackString<>( "all" ) ) );
+		TEST_ASSERT( ng.GetProgressTotalTime() == 0 ); // already up-to-date
+		TEST_ASSERT( copyA->GetStatFlag( Node::STATS_PROGRESS_COUNTED ) == false );
+		TEST_ASSERT( copyB->GetStatFlag( Node::STATS_PROGRESS_COUNTED ) == false );
+	}
+}
+
+// WriteCopyBFF
+//------------------------------------------------------------------------------
+void TestGraph::WriteCopyBFF( const char * bffFile, const char * destB ) const
+{
+	// output next to the bff
+	AStackString<> outDir( bffFile );
+	outDir.SetLength( (uint32_t)( outDir.FindLast( FORWARD_SLASH ) - outDir.Get() ) );
+
+	AStackString< 1024 > bff;
+	bff.Format( ".Out = '%s'\n"
+				"Copy( 'CopyA' )\n"
+				"{\n"
+				"    .Source = 'Data/TestGraph/BFFDirtied/fbuild.bff'\n"
+				"    .Dest = '$Out$/a.copy'\n"
+				"}\n"
+				"Copy( 'CopyB' )\n"
+				"{\n"
+				"    .Source = 'Data/TestGraph/BFFDirtied/fbuild.bff'\n"
+				"    .Dest = '$Out$/%s'\n"
+				"}\n"
+				"Alias( 'all' ) { .Targets = { 'CopyA', 'CopyB' } }\n", outDir.Get(), destB );
+
+	FileStream fs;
+	TEST_ASSERT( fs.Open( bffFile, FileStream::WRITE_ONLY ) );
+	TEST_ASSERT( fs.WriteBuffer( bff.Get(), bff.GetLength() ) == bff.GetLength() );
+}
+
 //------------------------------------------------------------------------------
@@ -26,12 +26,14 @@ private:
 
 	// Tests
 	void TestStaleDynamicDeps() const;
+	void Deduplication() const;
 };
 
 // Register Tests
 //------------------------------------------------------------------------------
 REGISTER_TESTS_BEGIN( TestObject )
 	REGISTER_TEST( TestStaleDynamicDeps )		// Test dynamic deps are cleared when necessary
+	REGISTER_TEST( Deduplication )				// Test identical compilations are only done once
 REGISTER_TESTS_END
 
 // TestStaleDynamicDeps
@@ -129,4 +131,33 @@ void TestObject::TestStaleDynamicDeps() const
 	}
 }
 
+// Deduplication
+//------------------------------------------------------------------------------
+void TestObject::Deduplication() const
+{
+	const char* objA = "../../../../tmp/Test/Object/Deduplication/A/file.o";
+	const char* objB = "../../../../tmp/Test/Object/Deduplication/B/file.o";
+
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestObject/Deduplication/fbuild.bff";
+	options.m_ForceCleanBuild = true;
+	options.m_UseCacheWrite = true; // identical compilations are found by cache key
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	FBuild fBuild( options );
+	TEST_ASSERT( fBuild.Initialize() );
+
+	EnsureFileDoesNotExist( objA );
+	EnsureFileDoesNotExist( objB );
+
+	TEST_ASSERT( fBuild.Build( AStackString<>( "Deduplication" ) ) );
+
+	// Both objects exist, but only one was compiled (and stored)
+	EnsureFileExists( objA );
+	EnsureFileExists( objB );
+	TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::OBJECT_NODE ).m_NumProcessed == 2 );
+	TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::OBJECT_NODE ).m_NumBuilt == 1 );
+	TEST_ASSERT( fBuild.GetStats().GetCacheStores() == 1 );
+	TEST_ASSERT( fBuild.GetStats().GetDeduplicated() == 1 );
+}
+
 //------------------------------------------------------------------------------
@@ -22,6 +22,8 @@ private:
 	void Build() const;
 	void Build_NoRebuild() const;
 	void TimeOut() const;
+	void Cacheable() const;
+	void Cacheable_Fail() const;
 };
 
 // Register Tests
@@ -31,6 +33,8 @@ REGISTER_TESTS_BEGIN( TestTest )
 	REGISTER_TEST( Build )
 	REGISTER_TEST( Build_NoRebuild )
 	REGISTER_TEST( TimeOut )
+	REGISTER_TEST( Cacheable )
+	REGISTER_TEST( Cacheable_Fail )
 REGISTER_TESTS_END
 
 // CreateNode
@@ -123,4 +127,72 @@ void TestTest::TimeOut() const
 	TEST_ASSERT( fBuild.Build( AStackString<>( "Test" ) ) == false );
 }
 
+// Cacheable
+//------------------------------------------------------------------------------
+void TestTest::Cacheable() const
+{
+	// A passing test should be stored on the first build
+	// and retrieved (not run) on a subsequent clean build
+
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestTest/test_cacheable.bff";
+	options.m_ForceCleanBuild = true;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	options.m_UseCacheWrite = true;
+
+	const AStackString<> testOutput( "../../../../tmp/Test/Test/Cacheable/testoutput.txt" );
+
+	// write to cache
+	{
+		EnsureFileDoesNotExist( testOutput );
+
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "Test" ) ) );
+
+		EnsureFileExists( testOutput );
+		CheckStatsNode ( 1,		1,		Node::TEST_NODE );
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::TEST_NODE ).m_NumCacheStores == 1 );
+	}
+
+	// read from cache
+	{
+		EnsureFileDoesNotExist( testOutput );
+
+		options.m_UseCacheRead = true;
+		options.m_UseCacheWrite = false;
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "Test" ) ) );
+
+		EnsureFileExists( testOutput );
+		CheckStatsNode ( 1,		0,		Node::TEST_NODE ); // retrieved from cache, not run
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::TEST_NODE ).m_NumCacheHits == 1 );
+	}
+}
+
+// Cacheable_Fail
+//------------------------------------------------------------------------------
+void TestTest::Cacheable_Fail() const
+{
+	// A failing test must never be stored, so it is run again every time
+
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestTest/test_cacheable.bff";
+	options.m_ForceCleanBuild = true;
+	options.m_ShowSummary = true; // required to generate stats for node count checks
+	options.m_UseCacheRead = true;
+	options.m_UseCacheWrite = true;
+
+	for ( size_t i = 0; i < 2; ++i )
+	{
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "TestFail" ) ) == false );
+
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::TEST_NODE ).m_NumCacheStores == 0 );
+		TEST_ASSERT( fBuild.GetStats().GetStatsFor( Node::TEST_NODE ).m_NumCacheHits == 0 );
+	}
+}
+
 //------------------------------------------------------------------------------
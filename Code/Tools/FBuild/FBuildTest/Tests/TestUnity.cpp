@@ -26,6 +26,11 @@ private:
 	const char * GetTestGenerateDBFileName() const { return "../../../../tmp/Test/Unity/generate.fdb"; } 
 	FBuildStats BuildCompile( FBuildOptions options = FBuildOptions(), bool useDB = true ) const;
 	const char * GetTestCompileDBFileName() const { return "../../../../tmp/Test/Unity/compile.fdb"; } 
+	void WriteBalanceInputFile( const char * fileName, uint32_t size ) const;
+	void BuildBalance( AString & unity1, AString & unity2 ) const;
+	void WriteIsolateChangedInputFile( const char * fileName, const char * contents ) const;
+	void BuildIsolateChanged( AString & unity ) const;
+	bool IsIsolated( const AString & unity, const char * fileName ) const;
 
 	// Tests
 	void TestGenerate() const;
@@ -35,6 +40,8 @@ private:
 	void TestGenerateFromExplicitList() const;
 	void TestExcludedFiles() const;
 	void IsolateFromUnity_Regression() const;
+	void CostBalancedPartitioning() const;
+	void IsolateChangedFiles() const;
 };
 
 // Register Tests
@@ -47,6 +54,8 @@ REGISTER_TESTS_BEGIN( TestUnity )
 	REGISTER_TEST( TestGenerateFromExplicitList ) // create a unity with manually provided files
 	REGISTER_TEST( TestExcludedFiles )		// Ensure files are correctly excluded
 	REGISTER_TEST( IsolateFromUnity_Regression )
+	REGISTER_TEST( CostBalancedPartitioning )
+	REGISTER_TEST( IsolateChangedFiles )
 REGISTER_TESTS_END
 
 // BuildGenerate
@@ -254,4 +263,211 @@ void TestUnity::IsolateFromUnity_Regression() const
 	TEST_ASSERT( fBuild.Build( AStackString<>( "Compile" ) ) );
 }
 
+// CostBalancedPartitioning
+//------------------------------------------------------------------------------
+void TestUnity::CostBalancedPartitioning() const
+{
+	const char * inputPath = "../../../../tmp/Test/Unity/Balance/Input/";
+	const char * inputFiles[] = { "a_large.cpp", "b.cpp", "c.cpp", "d.cpp", "e.cpp", "f.cpp" };
+	for ( const char * inputFile : inputFiles )
+	{
+		AStackString<> path( inputPath );
+		path += inputFile;
+		EnsureFileDoesNotExist( path );
+	}
+	TEST_ASSERT( FileIO::EnsurePathExists( AStackString<>( inputPath ) ) );
+
+	// one large file and several small ones
+	WriteBalanceInputFile( "a_large.cpp", 64 * 1024 );
+	WriteBalanceInputFile( "b.cpp", 200 );
+	WriteBalanceInputFile( "c.cpp", 200 );
+	WriteBalanceInputFile( "d.cpp", 200 );
+	WriteBalanceInputFile( "e.cpp", 200 );
+	WriteBalanceInputFile( "f.cpp", 200 );
+
+	AString unity1, unity2;
+	BuildBalance( unity1, unity2 );
+
+	// the large file is balanced against all the small files
+	TEST_ASSERT( unity1.Find( "a_large.cpp" ) );
+	TEST_ASSERT( unity1.Find( "b.cpp" ) == nullptr );
+	TEST_ASSERT( unity2.Find( "a_large.cpp" ) == nullptr );
+	TEST_ASSERT( unity2.Find( "b.cpp" ) && unity2.Find( "c.cpp" ) && unity2.Find( "d.cpp" ) &&
+				 unity2.Find( "e.cpp" ) && unity2.Find( "f.cpp" ) );
+
+	// partitioning doesn't depend on the order files are discovered in
+	for ( const char * inputFile : inputFiles )
+	{
+		AStackString<> path( inputPath );
+		path += inputFile;
+		EnsureFileDoesNotExist( path );
+	}
+	WriteBalanceInputFile( "f.cpp", 200 );
+	WriteBalanceInputFile( "e.cpp", 200 );
+	WriteBalanceInputFile( "d.cpp", 200 );
+	WriteBalanceInputFile( "c.cpp", 200 );
+	WriteBalanceInputFile( "b.cpp", 200 );
+	WriteBalanceInputFile( "a_large.cpp", 64 * 1024 );
+	{
+		AString unity1B, unity2B;
+		BuildBalance( unity1B, unity2B );
+		TEST_ASSERT( unity1 == unity1B );
+		TEST_ASSERT( unity2 == unity2B );
+	}
+
+	// small edits don't move files between unities
+	WriteBalanceInputFile( "a_large.cpp", ( 64 * 1024 ) + 300 );
+	WriteBalanceInputFile( "c.cpp", 900 );
+	{
+		AString unity1B, unity2B;
+		BuildBalance( unity1B, unity2B );
+		TEST_ASSERT( unity1 == unity1B );
+		TEST_ASSERT( unity2 == unity2B );
+	}
+}
+
+// WriteBalanceInputFile
+//------------------------------------------------------------------------------
+void TestUnity::WriteBalanceInputFile( const char * fileName, uint32_t size ) const
+{
+	AStackString<> path( "../../../../tmp/Test/Unity/Balance/Input/" );
+	path += fileName;
+
+	AString contents;
+	contents.SetReserved( size );
+	while ( contents.GetLength() < size )
+	{
+		contents += "// padding\n";
+	}
+
+	FileStream f;
+	TEST_ASSERT( f.Open( path.Get(), FileStream::WRITE_ONLY ) );
+	TEST_ASSERT( f.Write( contents.Get(), contents.GetLength() ) == contents.GetLength() );
+}
+
+// BuildBalance
+//------------------------------------------------------------------------------
+void TestUnity::BuildBalance( AString & unity1, AString & unity2 ) const
+{
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestUnity/Balance/fbuild.bff";
+	options.m_ForceCleanBuild = true;
+	{
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize() );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "Unity-Balance" ) ) );
+	}
+
+	AString * outputs[ 2 ] = { &unity1, &unity2 };
+	const char * fileNames[ 2 ] = { "../../../../tmp/Test/Unity/Balance/Output/Unity1.cpp",
+									"../../../../tmp/Test/Unity/Balance/Output/Unity2.cpp" };
+	for ( size_t i = 0; i < 2; ++i )
+	{
+		FileStream f;
+		TEST_ASSERT( f.Open( fileNames[ i ], FileStream::READ_ONLY ) );
+		const uint32_t fileSize = (uint32_t)f.GetFileSize();
+		outputs[ i ]->SetLength( fileSize );
+		TEST_ASSERT( f.Read( outputs[ i ]->Get(), fileSize ) == fileSize );
+	}
+}
+
+// IsolateChangedFiles
+//------------------------------------------------------------------------------
+void TestUnity::IsolateChangedFiles() const
+{
+	EnsureFileDoesNotExist( "../../../../tmp/Test/Unity/IsolateChanged/fbuild.fdb" );
+	const char * inputFiles[] = { "a.cpp", "b.cpp", "c.cpp" };
+	for ( const char * inputFile : inputFiles )
+	{
+		AStackString<> path( "../../../../tmp/Test/Unity/IsolateChanged/Input/" );
+		path += inputFile;
+		EnsureFileDoesNotExist( path );
+	}
+	TEST_ASSERT( FileIO::EnsurePathExists( AStackString<>( "../../../../tmp/Test/Unity/IsolateChanged/Input/" ) ) );
+	WriteIsolateChangedInputFile( "a.cpp", "// a" );
+	WriteIsolateChangedInputFile( "b.cpp", "// b" );
+	WriteIsolateChangedInputFile( "c.cpp", "// c" );
+
+	// nothing is isolated the first time, as there is no history
+	AString unity;
+	BuildIsolateChanged( unity );
+	TEST_ASSERT( !IsIsolated( unity, "a.cpp" ) && !IsIsolated( unity, "b.cpp" ) && !IsIsolated( unity, "c.cpp" ) );
+
+	// edit one file, and re-write another without changing it
+	// (sleep long enough for the time stamps to change, as HFS resolution is 1 second)
+	#if defined( __WINDOWS__ )
+		Thread::Sleep( 1 ); // 1ms
+	#else
+		Thread::Sleep( 1000 ); // 1 second
+	#endif
+	WriteIsolateChangedInputFile( "b.cpp", "// b - modified" );
+	WriteIsolateChangedInputFile( "c.cpp", "// c" );
+
+	// only the modified file is isolated: in the build which sees the change, and the 2 builds after it
+	const size_t numIsolatedBuilds = 3;
+	for ( size_t i = 0; i < numIsolatedBuilds; ++i )
+	{
+		BuildIsolateChanged( unity );
+		TEST_ASSERT( !IsIsolated( unity, "a.cpp" ) && IsIsolated( unity, "b.cpp" ) && !IsIsolated( unity, "c.cpp" ) );
+	}
+
+	// and then goes back into the unity
+	BuildIsolateChanged( unity );
+	TEST_ASSERT( !IsIsolated( unity, "a.cpp" ) && !IsIsolated( unity, "b.cpp" ) && !IsIsolated( unity, "c.cpp" ) );
+}
+
+// WriteIsolateChangedInputFile
+//------------------------------------------------------------------------------
+void TestUnity::WriteIsolateChangedInputFile( const char * fileName, const char * contents ) const
+{
+	AStackString<> path( "../../../../tmp/Test/Unity/IsolateChanged/Input/" );
+	path += fileName;
+
+	FileStream f;
+	TEST_ASSERT( f.Open( path.Get(), FileStream::WRITE_ONLY ) );
+	const size_t len = AString::StrLen( contents );
+	TEST_ASSERT( f.Write( contents, len ) == len );
+}
+
+// BuildIsolateChanged
+//------------------------------------------------------------------------------
+void TestUnity::BuildIsolateChanged( AString & unity ) const
+{
+	const char * dbFile = "../../../../tmp/Test/Unity/IsolateChanged/fbuild.fdb";
+
+	FBuildOptions options;
+	options.m_ConfigFile = "Data/TestUnity/IsolateChanged/fbuild.bff";
+	{
+		FBuild fBuild( options );
+		TEST_ASSERT( fBuild.Initialize( dbFile ) );
+		TEST_ASSERT( fBuild.Build( AStackString<>( "Unity-IsolateChanged" ) ) );
+		TEST_ASSERT( fBuild.SaveDependencyGraph( dbFile ) );
+	}
+
+	FileStream f;
+	TEST_ASSERT( f.Open( "../../../../tmp/Test/Unity/IsolateChanged/Output/Unity1.cpp", FileStream::READ_ONLY ) );
+	const uint32_t fileSize = (uint32_t)f.GetFileSize();
+	unity.SetLength( fileSize );
+	TEST_ASSERT( f.Read( unity.Get(), fileSize ) == fileSize );
+}
+
+// IsIsolated
+//------------------------------------------------------------------------------
+bool TestUnity::IsIsolated( const AString & unity, const char * fileName ) const
+{
+	AStackString<> include( "Input/" );
+	include += fileName;
+	include += "\"\r\n";
+	const char * pos = unity.Find( include.Get() );
+	TEST_ASSERT( pos );
+
+	// isolated files have their include commented out
+	const char * lineStart = pos;
+	while ( ( lineStart > unity.Get() ) && ( lineStart[ -1 ] != '\n' ) )
+	{
+		--lineStart;
+	}
+	return ( AString::StrNCmp( lineStart, "//#include", 10 ) == 0 );
+}
+
 //------------------------------------------------------------------------------
@@ -0,0 +1,150 @@
+// Auto-generated Unity file - do not modify
+
+//#pragma message( "/root/repo/Code/Core/Env/Assert.cpp" )
+#include "/root/repo/Code/Core/Env/Assert.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Env/Env.cpp" )
+#include "/root/repo/Code/Core/Env/Env.cpp"
+
+//#pragma message( "/root/repo/Code/Core/FileIO/ConstMemoryStream.cpp" )
+#include "/root/repo/Code/Core/FileIO/ConstMemoryStream.cpp"
+
+//#pragma message( "/root/repo/Code/Core/FileIO/DirectoryWalker.cpp" )
+#include "/root/repo/Code/Core/FileIO/DirectoryWalker.cpp"
+
+//#pragma message( "/root/repo/Code/Core/FileIO/FileIO.cpp" )
+#include "/root/repo/Code/Core/FileIO/FileIO.cpp"
+
+//#pragma message( "/root/repo/Code/Core/FileIO/FileStream.cpp" )
+#include "/root/repo/Code/Core/FileIO/FileStream.cpp"
+
+//#pragma message( "/root/repo/Code/Core/FileIO/IOStream.cpp" )
+#include "/root/repo/Code/Core/FileIO/IOStream.cpp"
+
+//#pragma message( "/root/repo/Code/Core/FileIO/MemoryStream.cpp" )
+#include "/root/repo/Code/Core/FileIO/MemoryStream.cpp"
+
+//#pragma message( "/root/repo/Code/Core/FileIO/PathUtils.cpp" )
+#include "/root/repo/Code/Core/FileIO/PathUtils.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Math/AABB3.cpp" )
+#include "/root/repo/Code/Core/Math/AABB3.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Math/CRC32.cpp" )
+#include "/root/repo/Code/Core/Math/CRC32.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Math/Mat44.cpp" )
+#include "/root/repo/Code/Core/Math/Mat44.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Math/Random.cpp" )
+#include "/root/repo/Code/Core/Math/Random.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Math/Vec3.cpp" )
+#include "/root/repo/Code/Core/Math/Vec3.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Mem/Mem.cpp" )
+#include "/root/repo/Code/Core/Mem/Mem.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Mem/MemPoolBlock.cpp" )
+#include "/root/repo/Code/Core/Mem/MemPoolBlock.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Mem/MemTracker.cpp" )
+#include "/root/repo/Code/Core/Mem/MemTracker.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Mem/ScratchArena.cpp" )
+#include "/root/repo/Code/Core/Mem/ScratchArena.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Mem/SmallBlockAllocator.cpp" )
+#include "/root/repo/Code/Core/Mem/SmallBlockAllocator.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Network/Network.cpp" )
+#include "/root/repo/Code/Core/Network/Network.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Network/NetworkStartupHelper.cpp" )
+#include "/root/repo/Code/Core/Network/NetworkStartupHelper.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Network/TCPConnectionPool.cpp" )
+#include "/root/repo/Code/Core/Network/TCPConnectionPool.cpp"
+
+//#pragma message( "/root/repo/Code/Core/PrecompiledHeader.cpp" )
+#include "/root/repo/Code/Core/PrecompiledHeader.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Process/Mutex.cpp" )
+#include "/root/repo/Code/Core/Process/Mutex.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Process/Process.cpp" )
+#include "/root/repo/Code/Core/Process/Process.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Process/Semaphore.cpp" )
+#include "/root/repo/Code/Core/Process/Semaphore.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Process/SharedMemory.cpp" )
+#include "/root/repo/Code/Core/Process/SharedMemory.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Process/SystemMutex.cpp" )
+#include "/root/repo/Code/Core/Process/SystemMutex.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Process/Thread.cpp" )
+#include "/root/repo/Code/Core/Process/Thread.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Profile/ProfileManager.cpp" )
+#include "/root/repo/Code/Core/Profile/ProfileManager.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/BindReflection.cpp" )
+#include "/root/repo/Code/Core/Reflection/BindReflection.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/Container.cpp" )
+#include "/root/repo/Code/Core/Reflection/Container.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/MetaData/Meta_File.cpp" )
+#include "/root/repo/Code/Core/Reflection/MetaData/Meta_File.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/MetaData/Meta_Optional.cpp" )
+#include "/root/repo/Code/Core/Reflection/MetaData/Meta_Optional.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/MetaData/Meta_Path.cpp" )
+#include "/root/repo/Code/Core/Reflection/MetaData/Meta_Path.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/MetaData/Meta_Range.cpp" )
+#include "/root/repo/Code/Core/Reflection/MetaData/Meta_Range.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/MetaData/MetaData.cpp" )
+#include "/root/repo/Code/Core/Reflection/MetaData/MetaData.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/Object.cpp" )
+#include "/root/repo/Code/Core/Reflection/Object.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/PropertyType.cpp" )
+#include "/root/repo/Code/Core/Reflection/PropertyType.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/ReflectedProperty.cpp" )
+#include "/root/repo/Code/Core/Reflection/ReflectedProperty.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/ReflectionInfo.cpp" )
+#include "/root/repo/Code/Core/Reflection/ReflectionInfo.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/ReflectionIter.cpp" )
+#include "/root/repo/Code/Core/Reflection/ReflectionIter.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/RefObject.cpp" )
+#include "/root/repo/Code/Core/Reflection/RefObject.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/Serialization/TextReader.cpp" )
+#include "/root/repo/Code/Core/Reflection/Serialization/TextReader.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Reflection/Serialization/TextWriter.cpp" )
+#include "/root/repo/Code/Core/Reflection/Serialization/TextWriter.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Strings/AString.cpp" )
+#include "/root/repo/Code/Core/Strings/AString.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Strings/LevenshteinDistance.cpp" )
+#include "/root/repo/Code/Core/Strings/LevenshteinDistance.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Time/Timer.cpp" )
+#include "/root/repo/Code/Core/Time/Timer.cpp"
+
+//#pragma message( "/root/repo/Code/Core/Tracing/Tracing.cpp" )
+#include "/root/repo/Code/Core/Tracing/Tracing.cpp"
+
+
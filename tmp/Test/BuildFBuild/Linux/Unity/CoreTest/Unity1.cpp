@@ -0,0 +1,57 @@
+// Auto-generated Unity file - do not modify
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/TestMain.cpp" )
+#include "/root/repo/Code/Core/CoreTest/TestMain.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestAString.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestAString.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestAtomic.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestAtomic.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestEnv.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestEnv.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestFileIO.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestFileIO.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestHash.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestHash.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestLevenshteinDistance.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestLevenshteinDistance.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestMemPoolBlock.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestMemPoolBlock.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestMPSCQueue.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestMPSCQueue.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestMutex.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestMutex.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestPathUtils.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestPathUtils.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestReflection.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestReflection.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestSemaphore.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestSemaphore.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestSharedMemory.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestSharedMemory.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestSort.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestSort.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestSystemMutex.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestSystemMutex.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestTCPConnectionPool.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestTCPConnectionPool.cpp"
+
+//#pragma message( "/root/repo/Code/Core/CoreTest/Tests/TestTimer.cpp" )
+#include "/root/repo/Code/Core/CoreTest/Tests/TestTimer.cpp"
+
+
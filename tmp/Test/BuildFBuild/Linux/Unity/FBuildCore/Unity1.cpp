@@ -0,0 +1,258 @@
+// Auto-generated Unity file - do not modify
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFIncludeCache.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFIncludeCache.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFIterator.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFIterator.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFMacros.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFMacros.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFParser.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFParser.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFStackFrame.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFStackFrame.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFVariable.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/BFFVariable.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/Function.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/Function.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionAlias.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionAlias.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionCompiler.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionCompiler.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionCopy.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionCopy.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionCopyDir.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionCopyDir.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionCSAssembly.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionCSAssembly.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionDLL.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionDLL.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionExec.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionExec.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionExecutable.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionExecutable.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionForEach.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionForEach.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionLibrary.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionLibrary.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionObjectList.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionObjectList.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionPrint.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionPrint.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionRemoveDir.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionRemoveDir.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionSettings.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionSettings.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionSLN.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionSLN.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionTest.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionTest.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionUnity.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionUnity.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionUsing.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionUsing.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionVCXProject.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionVCXProject.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionXCodeProject.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/BFF/Functions/FunctionXCodeProject.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Cache/Cache.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Cache/Cache.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Cache/CachePlugin.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Cache/CachePlugin.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Cache/OutputCache.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Cache/OutputCache.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Error.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Error.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/FBuild.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/FBuild.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/FBuildOptions.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/FBuildOptions.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/FLog.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/FLog.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/AliasNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/AliasNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/BuildTimeHistory.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/BuildTimeHistory.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/CompilerNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/CompilerNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/CopyDirNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/CopyDirNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/CopyFileNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/CopyFileNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/CSNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/CSNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/Dependencies.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/Dependencies.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/DirectoryListNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/DirectoryListNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/DLLNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/DLLNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/ExecNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/ExecNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/ExeNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/ExeNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/FileNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/FileNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/LibraryNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/LibraryNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/LinkerNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/LinkerNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/MetaData/Meta_Name.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/MetaData/Meta_Name.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/Node.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/Node.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/NodeGraph.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/NodeGraph.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/NodeProxy.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/NodeProxy.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/ObjectListNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/ObjectListNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/ObjectNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/ObjectNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/RemoveDirNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/RemoveDirNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/SLNNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/SLNNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/TestNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/TestNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/UnityNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/UnityNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/VCXProjectNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/VCXProjectNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/XCodeProjectNode.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Graph/XCodeProjectNode.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/Archiver.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/Archiver.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/Args.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/Args.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/BuildTrace.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/BuildTrace.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/CIncludeParser.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/CIncludeParser.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/Compressor.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/Compressor.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/FBuildStats.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/FBuildStats.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/MultiBuffer.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/MultiBuffer.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/ProjectGeneratorBase.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/ProjectGeneratorBase.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/Report.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/Report.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/ResponseFile.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/ResponseFile.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/SLNGenerator.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/SLNGenerator.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/ToolManifest.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/ToolManifest.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/VSProjectGenerator.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/VSProjectGenerator.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/XCodeProjectGenerator.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Helpers/XCodeProjectGenerator.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/PrecompiledHeader.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/PrecompiledHeader.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Protocol/Client.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Protocol/Client.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Protocol/Protocol.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Protocol/Protocol.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/Protocol/Server.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/Protocol/Server.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/Job.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/Job.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/JobQueue.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/JobQueue.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/JobQueueRemote.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/JobQueueRemote.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/ResourcePool.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/ResourcePool.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/WorkerBrokerage.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/WorkerBrokerage.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/WorkerThread.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/WorkerThread.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/WorkerThreadRemote.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildCore/WorkerPool/WorkerThreadRemote.cpp"
+
+
@@ -0,0 +1,93 @@
+// Auto-generated Unity file - do not modify
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/TestMain.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/TestMain.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/FBuildTest.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/FBuildTest.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestAlias.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestAlias.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestArgs.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestArgs.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestBFFParsing.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestBFFParsing.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestBuildAndLinkLibrary.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestBuildAndLinkLibrary.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestBuildFBuild.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestBuildFBuild.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCachePlugin.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCachePlugin.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCLR.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCLR.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCompiler.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCompiler.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCompressor.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCompressor.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCopy.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCopy.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCSharp.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCSharp.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCUDA.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestCUDA.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestDistributed.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestDistributed.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestDLL.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestDLL.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestExe.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestExe.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestExec.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestExec.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestGraph.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestGraph.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestIncludeParser.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestIncludeParser.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestObject.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestObject.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestObjectList.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestObjectList.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestPrecompiledHeaders.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestPrecompiledHeaders.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestProjectGeneration.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestProjectGeneration.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestResources.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestResources.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestTest.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestTest.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestUnity.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestUnity.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestVariableStack.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestVariableStack.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestWarnings.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestWarnings.cpp"
+
+//#pragma message( "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestZW.cpp" )
+#include "/root/repo/Code/Tools/FBuild/FBuildTest/Tests/TestZW.cpp"
+
+
@@ -0,0 +1,3 @@
+// Auto-generated Unity file - do not modify
+
+
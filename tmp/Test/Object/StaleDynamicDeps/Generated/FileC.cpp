@@ -0,0 +1 @@
+#include "/root/repo/tmp/Test/Object/StaleDynamicDeps/GeneratedInput/FileC.h"
@@ -0,0 +1,5986 @@
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
@@ -0,0 +1,82 @@
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
@@ -0,0 +1,19 @@
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
+// padding
@@ -0,0 +1,6 @@
+// Auto-generated Unity file - do not modify
+
+//#pragma message( "/root/repo/tmp/Test/Unity/Balance/Input/a_large.cpp" )
+#include "/root/repo/tmp/Test/Unity/Balance/Input/a_large.cpp"
+
+
@@ -0,0 +1,18 @@
+// Auto-generated Unity file - do not modify
+
+//#pragma message( "/root/repo/tmp/Test/Unity/Balance/Input/b.cpp" )
+#include "/root/repo/tmp/Test/Unity/Balance/Input/b.cpp"
+
+//#pragma message( "/root/repo/tmp/Test/Unity/Balance/Input/c.cpp" )
+#include "/root/repo/tmp/Test/Unity/Balance/Input/c.cpp"
+
+//#pragma message( "/root/repo/tmp/Test/Unity/Balance/Input/d.cpp" )
+#include "/root/repo/tmp/Test/Unity/Balance/Input/d.cpp"
+
+//#pragma message( "/root/repo/tmp/Test/Unity/Balance/Input/e.cpp" )
+#include "/root/repo/tmp/Test/Unity/Balance/Input/e.cpp"
+
+//#pragma message( "/root/repo/tmp/Test/Unity/Balance/Input/f.cpp" )
+#include "/root/repo/tmp/Test/Unity/Balance/Input/f.cpp"
+
+
@@ -0,0 +1 @@
+// b - modified
\ No newline at end of file
@@ -0,0 +1,12 @@
+// Auto-generated Unity file - do not modify
+
+//#pragma message( "/root/repo/tmp/Test/Unity/IsolateChanged/Input/a.cpp" )
+#include "/root/repo/tmp/Test/Unity/IsolateChanged/Input/a.cpp"
+
+//#pragma message( "/root/repo/tmp/Test/Unity/IsolateChanged/Input/b.cpp" )
+#include "/root/repo/tmp/Test/Unity/IsolateChanged/Input/b.cpp"
+
+//#pragma message( "/root/repo/tmp/Test/Unity/IsolateChanged/Input/c.cpp" )
+#include "/root/repo/tmp/Test/Unity/IsolateChanged/Input/c.cpp"
+
+